@@ -0,0 +1,189 @@
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifdef _WIN32
+
+#ifdef _WIN32_WINNT
+#undef _WIN32_WINNT
+#endif
+
+#define _WIN32_WINNT _WIN32_WINNT_WIN7
+
+#include <windows.h>
+#include <psapi.h>
+
+#endif
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include "benchmark.h"
+
+Benchmark::Benchmark(int window_count, QObject *parent) : QObject(parent)
+{
+    m_window_count = window_count;
+    m_initial_memory = 0;
+}
+
+void Benchmark::start()
+{
+    flushEvents();
+
+    m_initial_memory = residentMemory();
+
+    QTextStream(stdout) << "Windows: " << m_window_count << "\n";
+
+    m_timer.start();
+    openWindows();
+    report("Open", m_timer.elapsed());
+
+    m_timer.start();
+    toggleTheme();
+    report("Theme", m_timer.elapsed());
+
+    m_timer.start();
+    moveWindows();
+    report("Move", m_timer.elapsed());
+
+    m_timer.start();
+    closeWindows();
+    report("Close", m_timer.elapsed());
+
+    qApp->quit();
+}
+
+void Benchmark::openWindows()
+{
+    const QRect available_geometry = qApp->primaryScreen()->availableGeometry();
+
+    for (int i = 0; i < m_window_count; i++)
+    {
+        MainWindow *mw = new MainWindow();
+
+        const int x = available_geometry.x() + (i * 8) % qMax(available_geometry.width() - mw->width(), 1);
+        const int y = available_geometry.y() + (i * 8) % qMax(available_geometry.height() - mw->height(), 1);
+
+        mw->move(x, y);
+        mw->show();
+
+        m_window_list.append(mw);
+    }
+
+    flushEvents();
+}
+
+void Benchmark::toggleTheme()
+{
+    for (int i = 0; i < 2; i++)
+    {
+        qGoodStateHolder->setCurrentThemeDark(!qGoodStateHolder->isCurrentThemeDark());
+
+        if (qGoodStateHolder->isCurrentThemeDark())
+            QGoodWindow::setAppDarkTheme();
+        else
+            QGoodWindow::setAppLightTheme();
+
+        flushEvents();
+    }
+}
+
+void Benchmark::moveWindows()
+{
+    for (const QPointer<MainWindow> &mw : m_window_list)
+    {
+        if (mw)
+            mw->move(mw->pos() + QPoint(16, 16));
+    }
+
+    flushEvents();
+}
+
+void Benchmark::closeWindows()
+{
+    for (const QPointer<MainWindow> &mw : m_window_list)
+    {
+        if (mw)
+            mw->close();
+    }
+
+    m_window_list.clear();
+
+    flushEvents();
+}
+
+void Benchmark::flushEvents()
+{
+    for (int i = 0; i < 3; i++)
+    {
+        QCoreApplication::processEvents();
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    }
+}
+
+void Benchmark::report(const QString &phase, qint64 elapsed)
+{
+    const qint64 memory = residentMemory();
+    const qint64 memory_delta = memory - m_initial_memory;
+
+    QTextStream out(stdout);
+
+    out << phase.leftJustified(6)
+        << " total: " << elapsed << " ms"
+        << ", per window: " << QString::number(double(elapsed) / qMax(m_window_count, 1), 'f', 3) << " ms";
+
+    if (memory >= 0)
+    {
+        out << ", memory: " << memory / 1024 << " KiB"
+            << ", per window: " << memory_delta / qMax(m_window_count, 1) / 1024 << " KiB";
+    }
+
+    out << "\n";
+}
+
+qint64 Benchmark::residentMemory()
+{
+#if defined _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return qint64(counters.WorkingSetSize);
+
+    return -1;
+#elif defined __linux__
+    QFile file("/proc/self/statm");
+
+    if (!file.open(QFile::ReadOnly))
+        return -1;
+
+    const QList<QByteArray> fields = file.readAll().split(' ');
+
+    if (fields.size() < 2)
+        return -1;
+
+    return fields.at(1).toLongLong() * sysconf(_SC_PAGESIZE);
+#else
+    return -1;
+#endif
+}
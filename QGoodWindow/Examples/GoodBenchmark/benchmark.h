@@ -0,0 +1,57 @@
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <QtCore>
+#include "mainwindow.h"
+
+class Benchmark : public QObject
+{
+    Q_OBJECT
+public:
+    explicit Benchmark(int window_count, QObject *parent = nullptr);
+
+    void start();
+
+private:
+    //Functions
+    void openWindows();
+    void toggleTheme();
+    void moveWindows();
+    void closeWindows();
+    void flushEvents();
+    void report(const QString &phase, qint64 elapsed);
+
+    static qint64 residentMemory();
+
+    //Variables
+    int m_window_count;
+    qint64 m_initial_memory;
+    QList<QPointer<MainWindow>> m_window_list;
+    QElapsedTimer m_timer;
+};
+
+#endif // BENCHMARK_H
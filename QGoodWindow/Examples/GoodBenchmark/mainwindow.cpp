@@ -0,0 +1,48 @@
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "mainwindow.h"
+
+MainWindow::MainWindow(QWidget *parent) : QGoodWindow(parent)
+{
+    setAttribute(Qt::WA_DeleteOnClose);
+
+    m_good_central_widget = new QGoodCentralWidget(this);
+
+    QLabel *label = new QLabel("Benchmark", m_good_central_widget);
+    label->setAlignment(Qt::AlignCenter);
+
+    m_good_central_widget->setCentralWidget(label);
+    setCentralWidget(m_good_central_widget);
+
+    setWindowIcon(qApp->style()->standardIcon(QStyle::SP_DesktopIcon));
+    setWindowTitle("Good Benchmark");
+
+    resize(320, 240);
+}
+
+MainWindow::~MainWindow()
+{
+
+}
@@ -1,49 +1,49 @@
-#The MIT License (MIT)
-
-#Copyright © 2021-2023 Antonio Dias (https://github.com/antonypro)
-
-#Permission is hereby granted, free of charge, to any person obtaining a copy
-#of this software and associated documentation files (the "Software"), to deal
-#in the Software without restriction, including without limitation the rights
-#to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-#copies of the Software, and to permit persons to whom the Software is
-#furnished to do so, subject to the following conditions:
-
-#The above copyright notice and this permission notice shall be included in all
-#copies or substantial portions of the Software.
-
-#THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-#IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-#FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-#AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-#LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-#OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-#SOFTWARE.
-
-QT += core gui widgets
-
-win32:equals(QT_MAJOR_VERSION, 5){
-QT += winextras
-}
-
-equals(QT_MAJOR_VERSION, 6){
-QT += openglwidgets
-win32:LIBS += -lopengl32
-}
-
-CONFIG += c++11
-
-#CONFIG += no_qgoodwindow #This flag disable QGoodWindow
-
-include($$PWD/../../QGoodWindow/QGoodWindow.pri)
-
-include($$PWD/../../QGoodCentralWidget/QGoodCentralWidget.pri)
-
-SOURCES += \
-    main.cpp \
-    mainwindow.cpp \
-    glwidget.cpp
-
-HEADERS += \
-    mainwindow.h \
-    glwidget.h
+#The MIT License (MIT)
+
+#Copyright © 2021-2023 Antonio Dias (https://github.com/antonypro)
+
+#Permission is hereby granted, free of charge, to any person obtaining a copy
+#of this software and associated documentation files (the "Software"), to deal
+#in the Software without restriction, including without limitation the rights
+#to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#copies of the Software, and to permit persons to whom the Software is
+#furnished to do so, subject to the following conditions:
+
+#The above copyright notice and this permission notice shall be included in all
+#copies or substantial portions of the Software.
+
+#THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+#SOFTWARE.
+
+QT += core gui widgets
+
+win32:equals(QT_MAJOR_VERSION, 5){
+QT += winextras
+}
+
+equals(QT_MAJOR_VERSION, 6){
+QT += openglwidgets
+win32:LIBS += -lopengl32
+}
+
+CONFIG += c++11
+
+#CONFIG += no_qgoodwindow #This flag disable QGoodWindow
+
+include($$PWD/../../QGoodWindow/QGoodWindow.pri)
+
+include($$PWD/../../QGoodCentralWidget/QGoodCentralWidget.pri)
+
+SOURCES += \
+    main.cpp \
+    mainwindow.cpp \
+    glwidget.cpp
+
+HEADERS += \
+    mainwindow.h \
+    glwidget.h
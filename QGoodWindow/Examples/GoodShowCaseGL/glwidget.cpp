@@ -1,233 +1,233 @@
-/****************************************************************************
-**
-** Copyright (C) 2015 The Qt Company Ltd.
-** Contact: http://www.qt.io/licensing/
-**
-** This file is part of the examples of the Qt Toolkit.
-**
-** $QT_BEGIN_LICENSE:BSD$
-** You may use this file under the terms of the BSD license as follows:
-**
-** "Redistribution and use in source and binary forms, with or without
-** modification, are permitted provided that the following conditions are
-** met:
-**   * Redistributions of source code must retain the above copyright
-**     notice, this list of conditions and the following disclaimer.
-**   * Redistributions in binary form must reproduce the above copyright
-**     notice, this list of conditions and the following disclaimer in
-**     the documentation and/or other materials provided with the
-**     distribution.
-**   * Neither the name of The Qt Company Ltd nor the names of its
-**     contributors may be used to endorse or promote products derived
-**     from this software without specific prior written permission.
-**
-**
-** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
-** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
-** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
-** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
-** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
-** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
-** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
-** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE."
-**
-** $QT_END_LICENSE$
-**
-****************************************************************************/
-
-#include "glwidget.h"
-
-GLWidget::GLWidget(QWidget *parent) : QOpenGLWidget(parent)
-{
-    m_angle = float(0);
-    m_clear_color = QColor(0, 38, 64);
-}
-
-GLWidget::~GLWidget()
-{
-    makeCurrent();
-    m_vbo.destroy();
-    for (int i = 0; i < 6; i++)
-        delete m_textures[i];
-    delete m_program;
-    doneCurrent();
-}
-
-void GLWidget::rotate()
-{
-    m_angle++;
-
-    if (m_angle > float(360))
-        m_angle = 0;
-
-    update();
-}
-
-void GLWidget::initializeGL()
-{
-#ifdef QT_VERSION_QT5
-    initializeOpenGLFunctions();
-#endif
-
-    makeObject();
-
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_CULL_FACE);
-
-#define PROGRAM_VERTEX_ATTRIBUTE 0
-#define PROGRAM_TEXCOORD_ATTRIBUTE 1
-
-    QOpenGLShader *vshader = new QOpenGLShader(QOpenGLShader::Vertex, this);
-    const char *vsrc =
-            "attribute highp vec4 vertex;\n"
-            "attribute mediump vec4 texCoord;\n"
-            "varying mediump vec4 texc;\n"
-            "uniform mediump mat4 matrix;\n"
-            "void main(void)\n"
-            "{\n"
-            "    gl_Position = matrix * vertex;\n"
-            "    texc = texCoord;\n"
-            "}\n";
-    vshader->compileSourceCode(vsrc);
-
-    QOpenGLShader *fshader = new QOpenGLShader(QOpenGLShader::Fragment, this);
-    const char *fsrc =
-            "uniform sampler2D texture;\n"
-            "varying mediump vec4 texc;\n"
-            "void main(void)\n"
-            "{\n"
-            "    gl_FragColor = texture2D(texture, texc.st);\n"
-            "}\n";
-    fshader->compileSourceCode(fsrc);
-
-    m_program = new QOpenGLShaderProgram;
-    m_program->addShader(vshader);
-    m_program->addShader(fshader);
-    m_program->bindAttributeLocation("vertex", PROGRAM_VERTEX_ATTRIBUTE);
-    m_program->bindAttributeLocation("texCoord", PROGRAM_TEXCOORD_ATTRIBUTE);
-    m_program->link();
-
-    m_program->bind();
-    m_program->setUniformValue("texture", 0);
-}
-
-void GLWidget::paintGL()
-{
-    glClearColor(m_clear_color.redF(), m_clear_color.greenF(),
-                 m_clear_color.blueF(), m_clear_color.alphaF());
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-    float width = float(this->width());
-    float height = float(this->height());
-
-    float top, bottom, right, left;
-    float ratio = width / height;
-
-    if (width > height)
-    {
-        top = 0.5f;
-        bottom = -top;
-        right = top * ratio;
-        left = -right;
-    }
-    else
-    {
-        right = 0.5f;
-        left = -right;
-        top = right / ratio;
-        bottom = -top;
-    }
-
-    QMatrix4x4 m;
-    m.ortho(left, right, bottom, top, 4.0f, 15.0f);
-    m.translate(0.0f, 0.0f, -10.0f);
-    m.rotate(m_angle, 1.0f, 1.0f, 1.0f);
-    m.rotate(m_angle, 1.0f, 1.0f, 0.0f);
-    m.rotate(m_angle, 0.0f, 0.0f, 1.0f);
-
-    m_program->setUniformValue("matrix", m);
-    m_program->enableAttributeArray(PROGRAM_VERTEX_ATTRIBUTE);
-    m_program->enableAttributeArray(PROGRAM_TEXCOORD_ATTRIBUTE);
-    m_program->setAttributeBuffer(PROGRAM_VERTEX_ATTRIBUTE, GL_FLOAT,
-                                  0, 3, 5 * sizeof(GLfloat));
-    m_program->setAttributeBuffer(PROGRAM_TEXCOORD_ATTRIBUTE, GL_FLOAT,
-                                  3 * sizeof(GLfloat), 2, 5 * sizeof(GLfloat));
-
-    for (int i = 0; i < 6; i++)
-    {
-        m_textures[i]->bind();
-        glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-    }
-}
-
-void GLWidget::resizeGL(int width, int height)
-{
-    int side = qMin(width, height);
-    glViewport((width - side) / 2, (height - side) / 2, side, side);
-}
-
-void GLWidget::makeObject()
-{
-    static const int coords[6][4][3] = {
-        { { +1, -1, -1 }, { -1, -1, -1 }, { -1, +1, -1 }, { +1, +1, -1 } },
-        { { +1, +1, -1 }, { -1, +1, -1 }, { -1, +1, +1 }, { +1, +1, +1 } },
-        { { +1, -1, +1 }, { +1, -1, -1 }, { +1, +1, -1 }, { +1, +1, +1 } },
-        { { -1, -1, -1 }, { -1, -1, +1 }, { -1, +1, +1 }, { -1, +1, -1 } },
-        { { +1, -1, +1 }, { -1, -1, +1 }, { -1, -1, -1 }, { +1, -1, -1 } },
-        { { -1, -1, +1 }, { +1, -1, +1 }, { +1, +1, +1 }, { -1, +1, +1 } }
-    };
-
-    for (int j = 0; j < 6; j++)
-    {
-        QImage img = QImage(2, 2, QImage::Format_RGB32);
-
-        switch (j)
-        {
-        case 0:
-            img.fill(Qt::black);
-            break;
-        case 1:
-            img.fill(Qt::yellow);
-            break;
-        case 2:
-            img.fill(Qt::red);
-            break;
-        case 3:
-            img.fill(Qt::green);
-            break;
-        case 4:
-            img.fill(Qt::blue);
-            break;
-        case 5:
-            img.fill(Qt::white);
-            break;
-        default:
-            break;
-        }
-
-        m_textures[j] = new QOpenGLTexture(img);
-    }
-
-    QVector<GLfloat> vertData;
-
-    for (int i = 0; i < 6; i++)
-    {
-        for (int j = 0; j < 4; j++)
-        {
-            // vertex position
-            vertData.append(0.2 * coords[i][j][0]);
-            vertData.append(0.2 * coords[i][j][1]);
-            vertData.append(0.2 * coords[i][j][2]);
-            // texture coordinate
-            vertData.append(j == 0 || j == 3);
-            vertData.append(j == 0 || j == 1);
-        }
-    }
-
-    m_vbo.create();
-    m_vbo.bind();
-    m_vbo.allocate(vertData.constData(), int(vertData.count() * sizeof(GLfloat)));
-}
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the examples of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:BSD$
+** You may use this file under the terms of the BSD license as follows:
+**
+** "Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are
+** met:
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in
+**     the documentation and/or other materials provided with the
+**     distribution.
+**   * Neither the name of The Qt Company Ltd nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE."
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "glwidget.h"
+
+GLWidget::GLWidget(QWidget *parent) : QOpenGLWidget(parent)
+{
+    m_angle = float(0);
+    m_clear_color = QColor(0, 38, 64);
+}
+
+GLWidget::~GLWidget()
+{
+    makeCurrent();
+    m_vbo.destroy();
+    for (int i = 0; i < 6; i++)
+        delete m_textures[i];
+    delete m_program;
+    doneCurrent();
+}
+
+void GLWidget::rotate()
+{
+    m_angle++;
+
+    if (m_angle > float(360))
+        m_angle = 0;
+
+    update();
+}
+
+void GLWidget::initializeGL()
+{
+#ifdef QT_VERSION_QT5
+    initializeOpenGLFunctions();
+#endif
+
+    makeObject();
+
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+
+#define PROGRAM_VERTEX_ATTRIBUTE 0
+#define PROGRAM_TEXCOORD_ATTRIBUTE 1
+
+    QOpenGLShader *vshader = new QOpenGLShader(QOpenGLShader::Vertex, this);
+    const char *vsrc =
+            "attribute highp vec4 vertex;\n"
+            "attribute mediump vec4 texCoord;\n"
+            "varying mediump vec4 texc;\n"
+            "uniform mediump mat4 matrix;\n"
+            "void main(void)\n"
+            "{\n"
+            "    gl_Position = matrix * vertex;\n"
+            "    texc = texCoord;\n"
+            "}\n";
+    vshader->compileSourceCode(vsrc);
+
+    QOpenGLShader *fshader = new QOpenGLShader(QOpenGLShader::Fragment, this);
+    const char *fsrc =
+            "uniform sampler2D texture;\n"
+            "varying mediump vec4 texc;\n"
+            "void main(void)\n"
+            "{\n"
+            "    gl_FragColor = texture2D(texture, texc.st);\n"
+            "}\n";
+    fshader->compileSourceCode(fsrc);
+
+    m_program = new QOpenGLShaderProgram;
+    m_program->addShader(vshader);
+    m_program->addShader(fshader);
+    m_program->bindAttributeLocation("vertex", PROGRAM_VERTEX_ATTRIBUTE);
+    m_program->bindAttributeLocation("texCoord", PROGRAM_TEXCOORD_ATTRIBUTE);
+    m_program->link();
+
+    m_program->bind();
+    m_program->setUniformValue("texture", 0);
+}
+
+void GLWidget::paintGL()
+{
+    glClearColor(m_clear_color.redF(), m_clear_color.greenF(),
+                 m_clear_color.blueF(), m_clear_color.alphaF());
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    float width = float(this->width());
+    float height = float(this->height());
+
+    float top, bottom, right, left;
+    float ratio = width / height;
+
+    if (width > height)
+    {
+        top = 0.5f;
+        bottom = -top;
+        right = top * ratio;
+        left = -right;
+    }
+    else
+    {
+        right = 0.5f;
+        left = -right;
+        top = right / ratio;
+        bottom = -top;
+    }
+
+    QMatrix4x4 m;
+    m.ortho(left, right, bottom, top, 4.0f, 15.0f);
+    m.translate(0.0f, 0.0f, -10.0f);
+    m.rotate(m_angle, 1.0f, 1.0f, 1.0f);
+    m.rotate(m_angle, 1.0f, 1.0f, 0.0f);
+    m.rotate(m_angle, 0.0f, 0.0f, 1.0f);
+
+    m_program->setUniformValue("matrix", m);
+    m_program->enableAttributeArray(PROGRAM_VERTEX_ATTRIBUTE);
+    m_program->enableAttributeArray(PROGRAM_TEXCOORD_ATTRIBUTE);
+    m_program->setAttributeBuffer(PROGRAM_VERTEX_ATTRIBUTE, GL_FLOAT,
+                                  0, 3, 5 * sizeof(GLfloat));
+    m_program->setAttributeBuffer(PROGRAM_TEXCOORD_ATTRIBUTE, GL_FLOAT,
+                                  3 * sizeof(GLfloat), 2, 5 * sizeof(GLfloat));
+
+    for (int i = 0; i < 6; i++)
+    {
+        m_textures[i]->bind();
+        glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
+    }
+}
+
+void GLWidget::resizeGL(int width, int height)
+{
+    int side = qMin(width, height);
+    glViewport((width - side) / 2, (height - side) / 2, side, side);
+}
+
+void GLWidget::makeObject()
+{
+    static const int coords[6][4][3] = {
+        { { +1, -1, -1 }, { -1, -1, -1 }, { -1, +1, -1 }, { +1, +1, -1 } },
+        { { +1, +1, -1 }, { -1, +1, -1 }, { -1, +1, +1 }, { +1, +1, +1 } },
+        { { +1, -1, +1 }, { +1, -1, -1 }, { +1, +1, -1 }, { +1, +1, +1 } },
+        { { -1, -1, -1 }, { -1, -1, +1 }, { -1, +1, +1 }, { -1, +1, -1 } },
+        { { +1, -1, +1 }, { -1, -1, +1 }, { -1, -1, -1 }, { +1, -1, -1 } },
+        { { -1, -1, +1 }, { +1, -1, +1 }, { +1, +1, +1 }, { -1, +1, +1 } }
+    };
+
+    for (int j = 0; j < 6; j++)
+    {
+        QImage img = QImage(2, 2, QImage::Format_RGB32);
+
+        switch (j)
+        {
+        case 0:
+            img.fill(Qt::black);
+            break;
+        case 1:
+            img.fill(Qt::yellow);
+            break;
+        case 2:
+            img.fill(Qt::red);
+            break;
+        case 3:
+            img.fill(Qt::green);
+            break;
+        case 4:
+            img.fill(Qt::blue);
+            break;
+        case 5:
+            img.fill(Qt::white);
+            break;
+        default:
+            break;
+        }
+
+        m_textures[j] = new QOpenGLTexture(img);
+    }
+
+    QVector<GLfloat> vertData;
+
+    for (int i = 0; i < 6; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            // vertex position
+            vertData.append(0.2 * coords[i][j][0]);
+            vertData.append(0.2 * coords[i][j][1]);
+            vertData.append(0.2 * coords[i][j][2]);
+            // texture coordinate
+            vertData.append(j == 0 || j == 3);
+            vertData.append(j == 0 || j == 1);
+        }
+    }
+
+    m_vbo.create();
+    m_vbo.bind();
+    m_vbo.allocate(vertData.constData(), int(vertData.count() * sizeof(GLfloat)));
+}
@@ -1,276 +1,355 @@
-/*
-The MIT License (MIT)
-
-Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#include "captionbutton.h"
-
-CaptionButton::CaptionButton(IconType type, QWidget *parent) : QWidget(parent)
-{
-    setVisible(false);
-
-    m_type = type;
-    m_is_active = false;
-    m_is_under_mouse = false;
-    m_is_pressed = false;
-    m_icon_dark = false;
-
-    setColors();
-    drawIcons();
-}
-
-CaptionButton::~CaptionButton()
-{
-
-}
-
-QPixmap CaptionButton::loadSVG(const QString &svg_path, int w, int h)
-{
-    QPixmap pix = QIcon(svg_path).pixmap(w, h);
-    return pix;
-}
-
-void CaptionButton::paintIcons(const QPixmap &pix_in, bool dark,
-                               QPixmap *pix_active_out, QPixmap *pix_inactive_out)
-{
-    QImage img_active = pix_in.toImage();
-    QImage img_inactive = img_active;
-
-    const qreal grayed_reduction = qreal(0.40);
-
-    for (int y = 0; y < img_inactive.height(); y++)
-    {
-        QRgb *pixel_ptr = reinterpret_cast<QRgb*>(img_inactive.scanLine(y));
-
-        for (int x = 0; x < img_inactive.width(); x++)
-        {
-            QRgb pixel = pixel_ptr[x];
-
-            QRgb rgba = qRgba(qRound(qRed(pixel) * grayed_reduction),
-                              qRound(qGreen(pixel) * grayed_reduction),
-                              qRound(qBlue(pixel) * grayed_reduction),
-                              qAlpha(pixel));
-
-            pixel_ptr[x] = rgba;
-        }
-    }
-
-    if (dark)
-    {
-        img_active.invertPixels();
-        img_inactive.invertPixels();
-    }
-
-    if (pix_active_out)
-        *pix_active_out = QPixmap::fromImage(img_active);
-
-    if (pix_inactive_out)
-        *pix_inactive_out = QPixmap::fromImage(img_inactive);
-}
-
-void CaptionButton::drawIcons()
-{
-    const int size = 10;
-
-    const int w = size;
-    const int h = size;
-
-    switch (m_type)
-    {
-    case IconType::Minimize:
-    {
-        QPixmap icon = loadSVG(":/icons/minimize.svg", w, h);
-
-        paintIcons(icon, m_icon_dark, &m_active_icon, &m_inactive_icon);
-
-        break;
-    }
-    case IconType::Restore:
-    {
-        QPixmap icon = loadSVG(":/icons/restore.svg", w, h);
-
-        paintIcons(icon, m_icon_dark, &m_active_icon, &m_inactive_icon);
-
-        break;
-    }
-    case IconType::Maximize:
-    {
-        QPixmap icon = loadSVG(":/icons/maximize.svg", w, h);
-
-        paintIcons(icon, m_icon_dark, &m_active_icon, &m_inactive_icon);
-
-        break;
-    }
-    case IconType::Close:
-    {
-        QPixmap icon = loadSVG(":/icons/close.svg", w, h);
-
-        paintIcons(icon, m_icon_dark, &m_active_icon, &m_inactive_icon);
-
-        if (m_icon_dark)
-            paintIcons(icon, false/*dark*/, &m_close_icon_hover, nullptr);
-
-        break;
-    }
-    }
-}
-
-void CaptionButton::setColors()
-{
-    if (m_icon_dark)
-    {
-        if (m_type == IconType::Close)
-        {
-            m_normal = QColor("transparent");
-            m_hover = QColor("#F00000");
-            m_pressed = QColor("#F1707A");
-        }
-        else
-        {
-            m_normal = QColor("transparent");
-            m_hover = QColor("#E5E5E5");
-            m_pressed = QColor("#CACACB");
-        }
-    }
-    else
-    {
-        if (m_type == IconType::Close)
-        {
-            m_normal = QColor("transparent");
-            m_hover = QColor("#F00000");
-            m_pressed = QColor("#F1707A");
-        }
-        else
-        {
-            m_normal = QColor("transparent");
-            m_hover = QColor("#505050");
-            m_pressed = QColor("#3F3F3F");
-        }
-    }
-
-    update();
-}
-
-void CaptionButton::setIconMode(bool icon_dark)
-{
-    m_icon_dark = icon_dark;
-
-    drawIcons();
-    setColors();
-
-    update();
-}
-
-void CaptionButton::setActive(bool is_active)
-{
-    m_is_active = is_active;
-
-    update();
-}
-
-void CaptionButton::setState(int state)
-{
-    switch (state)
-    {
-    case QEvent::HoverEnter:
-    {
-        m_is_under_mouse = true;
-
-        update();
-
-        break;
-    }
-    case QEvent::HoverLeave:
-    {
-        m_is_under_mouse = false;
-
-        update();
-
-        break;
-    }
-    case QEvent::MouseButtonPress:
-    {
-        m_is_pressed = true;
-
-        m_is_under_mouse = true;
-
-        update();
-
-        break;
-    }
-    case QEvent::MouseButtonRelease:
-    {
-        m_is_pressed = false;
-
-        m_is_under_mouse = false;
-
-        update();
-
-        break;
-    }
-    default:
-        break;
-    }
-}
-
-void CaptionButton::paintEvent(QPaintEvent *event)
-{
-    Q_UNUSED(event)
-
-    QPixmap current_icon = m_active_icon;
-    QColor current_color = m_normal;
-
-    //Change icon if needed
-    if (m_is_under_mouse)
-    {
-        if (m_type == IconType::Close && m_icon_dark)
-            current_icon = m_close_icon_hover;
-    }
-    else
-    {
-        if (!m_is_active)
-            current_icon = m_inactive_icon;
-    }
-
-    //Change background color if needed
-    if (m_is_pressed)
-    {
-        if (m_is_under_mouse)
-            current_color = m_pressed;
-    }
-    else
-    {
-        if (m_is_under_mouse)
-            current_color = m_hover;
-    }
-
-    QPainter painter(this);
-    painter.setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
-    painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-
-    painter.fillRect(rect(), current_color);
-
-    QRect target_rect;
-    target_rect = current_icon.rect();
-    target_rect.moveCenter(rect().center());
-    painter.drawPixmap(target_rect, current_icon);
-}
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "captionbutton.h"
+#include "captionsprites.h"
+#include "src/pixelkernels.h"
+
+CaptionButtonRenderer::CaptionButtonRenderer(IconType type)
+{
+    m_type = type;
+    m_is_active = false;
+    m_is_under_mouse = false;
+    m_is_pressed = false;
+    m_icon_dark = false;
+    m_pixel_ratio = 1;
+
+    //Icons are rasterized on first paint.
+    m_icons_dirty = true;
+
+    setColors();
+}
+
+CaptionButtonRenderer::IconType CaptionButtonRenderer::type() const
+{
+    return m_type;
+}
+
+QPixmap CaptionButtonRenderer::loadIcon(const QString &name, int size, qreal pixel_ratio)
+{
+    const int pixel_size = qRound(size * pixel_ratio);
+
+    QImage image;
+
+    //Use the sprites baked at build time when available for this size,
+    //avoiding loading the SVG image plugin.
+    for (const CaptionSprite &sprite : caption_sprites)
+    {
+        if (sprite.size == pixel_size && name == QLatin1String(sprite.name))
+        {
+            image = QImage(reinterpret_cast<const uchar*>(sprite.data), sprite.size, sprite.size,
+                           sprite.size * int(sizeof(quint32)), QImage::Format_ARGB32_Premultiplied);
+            break;
+        }
+    }
+
+    if (image.isNull())
+        image = loadSVG(QString(":/icons/%0.svg").arg(name), pixel_size, pixel_size).toImage();
+
+    QPixmap pix = QPixmap::fromImage(image);
+    pix.setDevicePixelRatio(pixel_ratio);
+
+    return pix;
+}
+
+QPixmap CaptionButtonRenderer::loadSVG(const QString &svg_path, int w, int h)
+{
+    QPixmap pix = QIcon(svg_path).pixmap(w, h);
+    return pix;
+}
+
+void CaptionButtonRenderer::paintIcons(const QPixmap &pix_in, bool dark,
+                                       QPixmap *pix_active_out, QPixmap *pix_inactive_out)
+{
+    QImage img_active = pix_in.toImage();
+    img_active.setDevicePixelRatio(pix_in.devicePixelRatio());
+    QImage img_inactive = img_active;
+
+    const qreal grayed_reduction = qreal(0.40);
+
+    PixelKernels::scaleRgb(&img_inactive, grayed_reduction);
+
+    if (dark)
+    {
+        PixelKernels::invertRgb(&img_active);
+        PixelKernels::invertRgb(&img_inactive);
+    }
+
+    if (pix_active_out)
+        *pix_active_out = QPixmap::fromImage(img_active);
+
+    if (pix_inactive_out)
+        *pix_inactive_out = QPixmap::fromImage(img_inactive);
+}
+
+void CaptionButtonRenderer::drawIcons()
+{
+    const int size = 10;
+
+    switch (m_type)
+    {
+    case IconType::Minimize:
+    {
+        QPixmap icon = loadIcon("minimize", size, m_pixel_ratio);
+
+        paintIcons(icon, m_icon_dark, &m_active_icon, &m_inactive_icon);
+
+        break;
+    }
+    case IconType::Restore:
+    {
+        QPixmap icon = loadIcon("restore", size, m_pixel_ratio);
+
+        paintIcons(icon, m_icon_dark, &m_active_icon, &m_inactive_icon);
+
+        break;
+    }
+    case IconType::Maximize:
+    {
+        QPixmap icon = loadIcon("maximize", size, m_pixel_ratio);
+
+        paintIcons(icon, m_icon_dark, &m_active_icon, &m_inactive_icon);
+
+        break;
+    }
+    case IconType::Close:
+    {
+        QPixmap icon = loadIcon("close", size, m_pixel_ratio);
+
+        paintIcons(icon, m_icon_dark, &m_active_icon, &m_inactive_icon);
+
+        if (m_icon_dark)
+            paintIcons(icon, false/*dark*/, &m_close_icon_hover, nullptr);
+
+        break;
+    }
+    }
+}
+
+void CaptionButtonRenderer::setColors()
+{
+    if (m_icon_dark)
+    {
+        if (m_type == IconType::Close)
+        {
+            m_normal = QColor("transparent");
+            m_hover = QColor("#F00000");
+            m_pressed = QColor("#F1707A");
+        }
+        else
+        {
+            m_normal = QColor("transparent");
+            m_hover = QColor("#E5E5E5");
+            m_pressed = QColor("#CACACB");
+        }
+    }
+    else
+    {
+        if (m_type == IconType::Close)
+        {
+            m_normal = QColor("transparent");
+            m_hover = QColor("#F00000");
+            m_pressed = QColor("#F1707A");
+        }
+        else
+        {
+            m_normal = QColor("transparent");
+            m_hover = QColor("#505050");
+            m_pressed = QColor("#3F3F3F");
+        }
+    }
+}
+
+void CaptionButtonRenderer::setIconMode(bool icon_dark)
+{
+    if (m_icon_dark == icon_dark)
+        return;
+
+    m_icon_dark = icon_dark;
+
+    m_icons_dirty = true;
+    setColors();
+}
+
+bool CaptionButtonRenderer::setActive(bool is_active)
+{
+    if (m_is_active == is_active)
+        return false;
+
+    m_is_active = is_active;
+
+    return true;
+}
+
+bool CaptionButtonRenderer::setState(int state)
+{
+    const bool was_under_mouse = m_is_under_mouse;
+    const bool was_pressed = m_is_pressed;
+
+    switch (state)
+    {
+    case QEvent::HoverEnter:
+    {
+        m_is_under_mouse = true;
+
+        break;
+    }
+    case QEvent::HoverLeave:
+    {
+        m_is_under_mouse = false;
+
+        break;
+    }
+    case QEvent::MouseButtonPress:
+    {
+        m_is_pressed = true;
+
+        m_is_under_mouse = true;
+
+        break;
+    }
+    case QEvent::MouseButtonRelease:
+    {
+        m_is_pressed = false;
+
+        m_is_under_mouse = false;
+
+        break;
+    }
+    default:
+        break;
+    }
+
+    return (m_is_under_mouse != was_under_mouse || m_is_pressed != was_pressed);
+}
+
+void CaptionButtonRenderer::paint(QPainter *painter, const QRect &rect)
+{
+    const qreal pixel_ratio = painter->device()->devicePixelRatioF();
+
+    if (!qFuzzyCompare(m_pixel_ratio, pixel_ratio))
+    {
+        m_pixel_ratio = pixel_ratio;
+        m_icons_dirty = true;
+    }
+
+    if (m_icons_dirty)
+    {
+        drawIcons();
+        m_icons_dirty = false;
+    }
+
+    QPixmap current_icon = m_active_icon;
+    QColor current_color = m_normal;
+
+    //Change icon if needed
+    if (m_is_under_mouse)
+    {
+        if (m_type == IconType::Close && m_icon_dark)
+            current_icon = m_close_icon_hover;
+    }
+    else
+    {
+        if (!m_is_active)
+            current_icon = m_inactive_icon;
+    }
+
+    //Change background color if needed
+    if (m_is_pressed)
+    {
+        if (m_is_under_mouse)
+            current_color = m_pressed;
+    }
+    else
+    {
+        if (m_is_under_mouse)
+            current_color = m_hover;
+    }
+
+    painter->save();
+    painter->setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
+    painter->setCompositionMode(QPainter::CompositionMode_SourceOver);
+
+    painter->fillRect(rect, current_color);
+
+    QRect target_rect;
+    target_rect = QRect(QPoint(0, 0), current_icon.size() / current_icon.devicePixelRatio());
+    target_rect.moveCenter(rect.center());
+    painter->drawPixmap(target_rect, current_icon);
+
+    painter->restore();
+}
+
+qint64 CaptionButtonRenderer::pixmapBytes() const
+{
+    qint64 bytes = 0;
+
+    for (const QPixmap *pixmap : {&m_inactive_icon, &m_active_icon, &m_close_icon_hover})
+        bytes += qint64(pixmap->width()) * qint64(pixmap->height()) * pixmap->depth() / 8;
+
+    return bytes;
+}
+
+CaptionButton::CaptionButton(IconType type, QWidget *parent) : QWidget(parent),
+    m_renderer(type)
+{
+    setVisible(false);
+}
+
+CaptionButton::~CaptionButton()
+{
+
+}
+
+void CaptionButton::setIconMode(bool icon_dark)
+{
+    m_renderer.setIconMode(icon_dark);
+
+    update();
+}
+
+void CaptionButton::setActive(bool is_active)
+{
+    if (m_renderer.setActive(is_active))
+        update();
+}
+
+void CaptionButton::setState(int state)
+{
+    if (m_renderer.setState(state))
+        update();
+}
+
+qint64 CaptionButton::pixmapBytes() const
+{
+    return m_renderer.pixmapBytes();
+}
+
+void CaptionButton::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event)
+
+    QPainter painter(this);
+    m_renderer.paint(&painter, rect());
+}
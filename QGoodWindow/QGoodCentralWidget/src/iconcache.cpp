@@ -0,0 +1,78 @@
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "iconcache.h"
+#include "src/pixelkernels.h"
+
+//Pixmaps of the same icon at the same size and pixel ratio are shared by all
+//windows and dialogs, the grayed variant is computed on first use.
+//They live in QPixmapCache, which is cleared with the application.
+
+QString IconCache::cacheKey(const QIcon &icon, const QSize &size, qreal pixel_ratio)
+{
+    return QString("qgoodwindow_icon_%0_%1x%2_%3")
+            .arg(icon.cacheKey()).arg(size.width()).arg(size.height()).arg(pixel_ratio);
+}
+
+QPixmap IconCache::pixmap(const QIcon &icon, const QSize &size, qreal pixel_ratio)
+{
+    if (icon.isNull())
+        return QPixmap();
+
+    const QString key = cacheKey(icon, size, pixel_ratio);
+
+    QPixmap pixmap;
+
+    if (!QPixmapCache::find(key, &pixmap))
+    {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        pixmap = icon.pixmap(size, pixel_ratio);
+#else
+        pixmap = icon.pixmap(size * pixel_ratio);
+#endif
+
+        QPixmapCache::insert(key, pixmap);
+    }
+
+    return pixmap;
+}
+
+QPixmap IconCache::grayedPixmap(const QIcon &icon, const QSize &size, qreal pixel_ratio)
+{
+    if (icon.isNull())
+        return QPixmap();
+
+    const QString key = cacheKey(icon, size, pixel_ratio) + "_grayed";
+
+    QPixmap pixmap;
+
+    if (!QPixmapCache::find(key, &pixmap))
+    {
+        pixmap = PixelKernels::grayedPixmap(IconCache::pixmap(icon, size, pixel_ratio));
+
+        QPixmapCache::insert(key, pixmap);
+    }
+
+    return pixmap;
+}
@@ -1,54 +1,55 @@
-/*
-The MIT License (MIT)
-
-Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#ifndef ICONWIDGET_H
-#define ICONWIDGET_H
-
-#include <QtCore>
-#include <QtGui>
-#include <QtWidgets>
-
-//\cond HIDDEN_SYMBOLS
-class IconWidget : public QWidget
-{
-    Q_OBJECT
-public:
-    explicit IconWidget(QWidget *parent = nullptr);
-
-public Q_SLOTS:
-    void setPixmap(const QPixmap &pixmap);
-    void setActive(bool active);
-
-private:
-    //Functions
-    void paintEvent(QPaintEvent *event);
-
-    //Variables
-    QPixmap m_pixmap;
-    QPixmap m_grayed_pixmap;
-    bool m_active;
-};
-//\endcond
-
-#endif // ICONWIDGET_H
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ICONWIDGET_H
+#define ICONWIDGET_H
+
+#include <QtCore>
+#include <QtGui>
+#include <QtWidgets>
+#include <QGoodWindow>
+#include "iconcache.h"
+
+//\cond HIDDEN_SYMBOLS
+class IconWidget : public QWidget
+{
+    Q_OBJECT
+public:
+    explicit IconWidget(QWidget *parent = nullptr);
+
+public Q_SLOTS:
+    void setIcon(const QIcon &icon);
+    void setActive(bool active);
+
+private:
+    //Functions
+    void paintEvent(QPaintEvent *event);
+
+    //Variables
+    QIcon m_icon;
+    bool m_active;
+};
+//\endcond
+
+#endif // ICONWIDGET_H
@@ -1,832 +1,1389 @@
-/*
-The MIT License (MIT)
-
-Copyright © 2022-2023 Antonio Dias (https://github.com/antonypro)
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#include "qgoodcentralwidget.h"
-
-#ifdef QGOODWINDOW
-#include "titlebar.h"
-#define BORDERCOLOR QColor(24, 131, 215)
-#endif
-
-QGoodCentralWidget::QGoodCentralWidget(QGoodWindow *gw) : QWidget(gw)
-{
-    m_gw = gw;
-
-    m_gw->installEventFilter(this);
-
-    m_central_widget_place_holder = new QWidget(this);
-
-#ifdef QGOODWINDOW
-    m_left_widget_transparent_for_mouse = false;
-    m_right_widget_transparent_for_mouse = false;
-    m_center_widget_transparent_for_mouse = false;
-
-    m_frame_style = QString("QFrame#GoodFrame {%0}");
-
-    m_active_border_color = BORDERCOLOR;
-
-    m_caption_button_width = 36;
-
-    m_title_bar = new TitleBar(m_gw, this);
-    m_title_bar->setCaptionButtonWidth(m_caption_button_width);
-
-    m_title_bar->installEventFilter(this);
-
-    connect(m_gw, &QGoodWindow::captionButtonStateChanged, m_title_bar, &TitleBar::captionButtonStateChanged);
-
-    connect(m_title_bar, &TitleBar::showMinimized, m_gw, &QGoodWindow::showMinimized);
-    connect(m_title_bar, &TitleBar::showNormal, m_gw, &QGoodWindow::showNormal);
-    connect(m_title_bar, &TitleBar::showMaximized, m_gw, &QGoodWindow::showMaximized);
-    connect(m_title_bar, &TitleBar::closeWindow, m_gw, &QGoodWindow::close);
-
-    connect(m_gw, &QGoodWindow::windowTitleChanged, m_title_bar, [=](const QString &title){
-        m_title_bar->setTitle(title);
-    });
-
-    connect(m_gw, &QGoodWindow::windowIconChanged, m_title_bar, [=](const QIcon &icon){
-        if (!icon.isNull())
-        {
-            const int pix_size = 16;
-            m_title_bar->setIcon(icon.pixmap(pix_size, pix_size));
-        }
-    });
-
-    m_draw_borders = !QGoodWindow::shouldBordersBeDrawnBySystem();
-
-#ifdef Q_OS_MAC
-    auto caption_buttons_visibility_changed_func = [=]{
-        if (m_gw->isNativeCaptionButtonsVisibleOnMac())
-        {
-            setCaptionButtonsVisible(false);
-            setIconVisible(false);
-
-            QRect rect = m_gw->titleBarButtonsRectOnMacOS();
-            m_title_bar->m_left_margin_widget_place_holder->setFixedSize(rect.x() * 2 + rect.width(), rect.y() + rect.height());
-            m_title_bar->m_left_widget_place_holder->setVisible(true);
-        }
-        else
-        {
-            setCaptionButtonsVisible(true);
-            setIconVisible(true);
-
-            m_title_bar->m_left_margin_widget_place_holder->setFixedSize(0, 0);
-            m_title_bar->m_left_widget_place_holder->setVisible(false);
-        }
-    };
-
-    connect(m_gw, &QGoodWindow::captionButtonsVisibilityChangedOnMacOS, this, caption_buttons_visibility_changed_func);
-
-    caption_buttons_visibility_changed_func();
-#endif
-
-    m_title_bar_visible = true;
-    m_caption_buttons_visible = true;
-    m_title_visible = true;
-    m_icon_visible = true;
-    m_icon_width = 0;
-
-    m_frame = new QFrame(this);
-    m_frame->setObjectName("GoodFrame");
-
-    setUnifiedTitleBarAndCentralWidget(false);
-
-    QVBoxLayout *central_layout = new QVBoxLayout(this);
-    central_layout->setContentsMargins(0, 0, 0, 0);
-    central_layout->setSpacing(0);
-    central_layout->addWidget(m_frame);
-#else
-    QVBoxLayout *main_layout = new QVBoxLayout(this);
-    main_layout->setContentsMargins(0, 0, 0, 0);
-    main_layout->setSpacing(0);
-    main_layout->addWidget(m_central_widget_place_holder);
-#endif
-}
-
-QGoodCentralWidget::~QGoodCentralWidget()
-{
-
-}
-
-int QGoodCentralWidget::execDialogWithWindow(QDialog *dialog, QGoodWindow *parent_gw,
-                                             QGoodCentralWidget *base_gcw,
-                                             QWidget *left_title_bar_widget,
-                                             QWidget *right_title_bar_widget,
-                                             bool title_visible, bool icon_visible)
-{
-#ifdef QGOODWINDOW
-    dialog->setWindowFlags(Qt::Widget);
-
-    QGoodWindow *gw = new QGoodWindow(parent_gw);
-    gw->resize(dialog->size());
-    gw->setAttribute(Qt::WA_DeleteOnClose);
-
-#ifdef Q_OS_MAC
-    gw->setNativeCaptionButtonsVisibleOnMac(parent_gw->isNativeCaptionButtonsVisibleOnMac());
-#endif
-
-    QGoodCentralWidget *gcw = new QGoodCentralWidget(gw);
-    gcw->setCentralWidget(dialog);
-
-    gcw->setLeftTitleBarWidget(left_title_bar_widget);
-    gcw->setRightTitleBarWidget(right_title_bar_widget);
-
-    if (base_gcw)
-    {
-        if (base_gcw->titleBarColor() != QColor(Qt::transparent))
-            gcw->setTitleBarColor(base_gcw->titleBarColor());
-        gcw->setActiveBorderColor(base_gcw->activeBorderColor());
-        gcw->setTitleAlignment(base_gcw->titleAlignment());
-    }
-
-    gcw->setTitleVisible(title_visible);
-    gcw->setIconVisible(icon_visible);
-
-    gw->setCentralWidget(gcw);
-
-    return QGoodWindow::execDialog(dialog, gw, parent_gw);
-#else
-    Q_UNUSED(parent_gw)
-    Q_UNUSED(base_gcw)
-    Q_UNUSED(left_title_bar_widget)
-    Q_UNUSED(right_title_bar_widget)
-    Q_UNUSED(title_visible)
-    Q_UNUSED(icon_visible)
-    return dialog->exec();
-#endif
-}
-
-void QGoodCentralWidget::setUnifiedTitleBarAndCentralWidget(bool unified)
-{
-#ifdef QGOODWINDOW
-    if (m_frame->layout())
-        delete m_frame->layout();
-
-    if (!unified)
-    {
-        m_unified_title_bar_and_central_widget = false;
-        setTitleBarColor(QColor());
-
-        QVBoxLayout *main_layout = new QVBoxLayout(m_frame);
-        main_layout->setContentsMargins(0, 0, 0, 0);
-        main_layout->setSpacing(0);
-        main_layout->addWidget(m_title_bar);
-        main_layout->addWidget(m_central_widget_place_holder);
-    }
-    else
-    {
-        setTitleBarColor(QColor(Qt::transparent));
-        m_unified_title_bar_and_central_widget = true;
-
-        QStackedLayout *main_layout = new QStackedLayout(m_frame);
-        main_layout->setStackingMode(QStackedLayout::StackAll);
-        main_layout->setContentsMargins(0, 0, 0, 0);
-        main_layout->setSpacing(0);
-        main_layout->addWidget(m_title_bar);
-        main_layout->addWidget(m_central_widget_place_holder);
-    }
-#else
-    Q_UNUSED(unified)
-#endif
-}
-
-void QGoodCentralWidget::setTitleBarMask(const QRegion &mask)
-{
-#ifdef QGOODWINDOW
-    m_title_bar_mask = mask;
-    updateWindow();
-#else
-    Q_UNUSED(mask)
-#endif
-}
-
-QWidget *QGoodCentralWidget::setLeftTitleBarWidget(QWidget *widget, bool transparent_for_mouse)
-{
-#ifdef QGOODWINDOW
-    QWidget *return_widget = m_title_bar_left_widget;
-
-    m_title_bar_left_widget = widget;
-
-    m_left_widget_transparent_for_mouse = transparent_for_mouse;
-
-    m_title_bar->setLeftTitleBarWidget(m_title_bar_left_widget);
-
-    updateWindow();
-
-    return return_widget;
-#else
-    Q_UNUSED(widget)
-    Q_UNUSED(transparent_for_mouse)
-    return nullptr;
-#endif
-}
-
-QWidget *QGoodCentralWidget::setRightTitleBarWidget(QWidget *widget, bool transparent_for_mouse)
-{
-#ifdef QGOODWINDOW
-    QWidget *return_widget = m_title_bar_right_widget;
-
-    m_title_bar_right_widget = widget;
-
-    m_right_widget_transparent_for_mouse = transparent_for_mouse;
-
-    m_title_bar->setRightTitleBarWidget(m_title_bar_right_widget);
-
-    updateWindow();
-
-    return return_widget;
-#else
-    Q_UNUSED(widget)
-    Q_UNUSED(transparent_for_mouse)
-    return nullptr;
-#endif
-}
-
-QWidget *QGoodCentralWidget::setCenterTitleBarWidget(QWidget *widget, bool transparent_for_mouse)
-{
-#ifdef QGOODWINDOW
-    QWidget *return_widget = m_title_bar_center_widget;
-
-    m_title_bar_center_widget = widget;
-
-    m_center_widget_transparent_for_mouse = transparent_for_mouse;
-
-    m_title_bar->setCenterTitleBarWidget(m_title_bar_center_widget);
-
-    updateWindow();
-
-    return return_widget;
-#else
-    Q_UNUSED(widget)
-    Q_UNUSED(transparent_for_mouse)
-    return nullptr;
-#endif
-}
-
-void QGoodCentralWidget::setCentralWidget(QWidget *widget)
-{
-    if (!m_central_widget_place_holder)
-        return;
-
-    m_central_widget = widget;
-
-    if (m_central_widget_place_holder->layout())
-        delete m_central_widget_place_holder->layout();
-
-    QGridLayout *layout = new QGridLayout(m_central_widget_place_holder);
-    layout->setContentsMargins(0, 0, 0, 0);
-    layout->setSpacing(0);
-    layout->addWidget(m_central_widget);
-}
-
-void QGoodCentralWidget::setTitleAlignment(const Qt::Alignment &alignment)
-{
-#ifdef QGOODWINDOW
-    m_title_bar->setTitleAlignment(alignment);
-#else
-    Q_UNUSED(alignment)
-#endif
-}
-
-void QGoodCentralWidget::setTitleBarColor(const QColor &color)
-{
-#ifdef QGOODWINDOW
-    if (m_unified_title_bar_and_central_widget)
-        return;
-
-    m_title_bar_color = color;
-    m_title_bar->m_title_bar_color = m_title_bar_color;
-    m_title_bar->setTheme();
-#else
-    Q_UNUSED(color)
-#endif
-}
-
-void QGoodCentralWidget::setActiveBorderColor(const QColor &color)
-{
-#ifdef QGOODWINDOW
-    if (color.isValid())
-        m_active_border_color = color;
-    else
-        m_active_border_color = BORDERCOLOR;
-
-    updateWindow();
-#else
-    Q_UNUSED(color)
-#endif
-}
-
-void QGoodCentralWidget::setTitleBarVisible(bool visible)
-{
-#ifdef QGOODWINDOW
-    m_title_bar_visible = visible;
-    m_title_bar->setVisible(m_title_bar_visible);
-    m_title_bar->setEnabled(m_title_bar_visible);
-#ifdef Q_OS_MAC
-    m_gw->setNativeCaptionButtonsVisibleOnMac(visible);
-#endif
-    updateWindow();
-#else
-    Q_UNUSED(visible)
-#endif
-}
-
-void QGoodCentralWidget::setCaptionButtonsVisible(bool visible)
-{
-#ifdef QGOODWINDOW
-    m_caption_buttons_visible = visible;
-
-    m_title_bar->m_caption_buttons->setVisible(m_caption_buttons_visible);
-    m_title_bar->m_caption_buttons->setEnabled(m_caption_buttons_visible);
-
-    if (!m_caption_buttons_visible)
-    {
-        m_gw->setMinimizeMask(QRegion());
-        m_gw->setMaximizeMask(QRegion());
-        m_gw->setCloseMask(QRegion());
-    }
-
-    updateWindow();
-#else
-    Q_UNUSED(visible)
-#endif
-}
-
-void QGoodCentralWidget::setTitleVisible(bool visible)
-{
-#ifdef QGOODWINDOW
-    m_title_visible = visible;
-    m_title_bar->m_title_widget->setVisible(m_title_visible);
-    m_title_bar->m_title_widget->setEnabled(m_title_visible);
-    updateWindow();
-#else
-    Q_UNUSED(visible)
-#endif
-}
-
-void QGoodCentralWidget::setIconVisible(bool visible)
-{
-#ifdef QGOODWINDOW
-    m_icon_visible = visible;
-    m_title_bar->m_icon_widget->setVisible(m_icon_visible);
-    m_title_bar->m_icon_widget->setEnabled(m_icon_visible);
-    updateWindow();
-#else
-    Q_UNUSED(visible)
-#endif
-}
-
-void QGoodCentralWidget::setIconWidth(int width)
-{
-#ifdef QGOODWINDOW
-    m_icon_width = width;
-    updateWindow();
-#else
-    Q_UNUSED(width)
-#endif
-}
-
-void QGoodCentralWidget::setTitleBarHeight(int height)
-{
-#ifdef QGOODWINDOW
-    m_title_bar->setFixedHeight(height);
-    m_title_bar->setCaptionButtonWidth(m_caption_button_width);
-    updateWindow();
-#else
-    Q_UNUSED(height)
-#endif
-}
-
-void QGoodCentralWidget::setCaptionButtonWidth(int width)
-{
-#ifdef QGOODWINDOW
-    m_caption_button_width = width;
-    m_title_bar->setCaptionButtonWidth(m_caption_button_width);
-    updateWindow();
-#else
-    Q_UNUSED(width)
-#endif
-}
-
-bool QGoodCentralWidget::isUnifiedTitleBarAndCentralWidget() const
-{
-#ifdef QGOODWINDOW
-    return m_unified_title_bar_and_central_widget;
-#else
-    return false;
-#endif
-}
-
-QWidget *QGoodCentralWidget::leftTitleBarWidget() const
-{
-#ifdef QGOODWINDOW
-    return m_title_bar_left_widget;
-#else
-    return nullptr;
-#endif
-}
-
-QWidget *QGoodCentralWidget::rightTitleBarWidget() const
-{
-#ifdef QGOODWINDOW
-    return m_title_bar_right_widget;
-#else
-    return nullptr;
-#endif
-}
-
-QWidget *QGoodCentralWidget::centerTitleBarWidget() const
-{
-#ifdef QGOODWINDOW
-    return m_title_bar_center_widget;
-#else
-    return nullptr;
-#endif
-}
-
-QWidget *QGoodCentralWidget::centralWidget() const
-{
-    return m_central_widget;
-}
-
-Qt::Alignment QGoodCentralWidget::titleAlignment() const
-{
-#ifdef QGOODWINDOW
-    return m_title_bar->titleAlignment();
-#else
-    return Qt::Alignment(0);
-#endif
-}
-
-QColor QGoodCentralWidget::titleBarColor() const
-{
-#ifdef QGOODWINDOW
-    return m_title_bar_color;
-#else
-    return QColor();
-#endif
-}
-
-QColor QGoodCentralWidget::activeBorderColor() const
-{
-#ifdef QGOODWINDOW
-    return m_active_border_color;
-#else
-    return QColor();
-#endif
-}
-
-bool QGoodCentralWidget::isTitleBarVisible() const
-{
-#ifdef QGOODWINDOW
-    return m_title_bar->isVisible();
-#else
-    return true;
-#endif
-}
-
-bool QGoodCentralWidget::isCaptionButtonsVisible() const
-{
-#ifdef QGOODWINDOW
-    return m_caption_buttons_visible;
-#else
-    return true;
-#endif
-}
-
-bool QGoodCentralWidget::isTitleVisible() const
-{
-#ifdef QGOODWINDOW
-    return m_title_visible;
-#else
-    return true;
-#endif
-}
-
-bool QGoodCentralWidget::isIconVisible() const
-{
-#ifdef QGOODWINDOW
-    return m_icon_visible;
-#else
-    return true;
-#endif
-}
-
-int QGoodCentralWidget::iconWidth() const
-{
-#ifdef QGOODWINDOW
-    return m_icon_width;
-#else
-    return 0;
-#endif
-}
-
-int QGoodCentralWidget::titleBarHeight() const
-{
-#ifdef QGOODWINDOW
-    return m_title_bar->height();
-#else
-    return 0;
-#endif
-}
-
-int QGoodCentralWidget::captionButtonWidth() const
-{
-#ifdef QGOODWINDOW
-    return m_caption_button_width;
-#else
-    return 0;
-#endif
-}
-
-void QGoodCentralWidget::updateWindow()
-{
-#ifdef QGOODWINDOW
-    QTimer::singleShot(0, this, &QGoodCentralWidget::updateWindowLater);
-#endif
-}
-
-void QGoodCentralWidget::updateWindowLater()
-{
-#ifdef QGOODWINDOW
-    if (!m_gw)
-        return;
-
-    if (!m_gw->isVisible() || m_gw->isMinimized())
-        return;
-
-    bool window_active = m_gw->isActiveWindow();
-    bool window_no_state = m_gw->windowState().testFlag(Qt::WindowNoState);
-    bool draw_borders = m_draw_borders;
-    bool is_maximized = m_gw->isMaximized();
-    bool is_full_screen = m_gw->isFullScreen();
-    int title_bar_width = m_title_bar->width();
-    int title_bar_height = m_title_bar->height();
-
-    int icon_width = m_icon_width;
-
-    if (m_icon_visible)
-        icon_width = m_title_bar->m_icon_widget->width();
-
-    QString border_str = "none;";
-
-    if (draw_borders && window_no_state)
-    {
-        if (window_active)
-            border_str = QString("border: 1px solid %0;").arg(m_active_border_color.name());
-        else
-            border_str = "border: 1px solid #AAAAAA;";
-    }
-
-#ifdef Q_OS_LINUX
-    border_str.append("border-radius: 8px;");
-#endif
-
-    m_frame->setStyleSheet(m_frame_style.arg(border_str));
-
-    m_title_bar->setMaximized(is_maximized && !is_full_screen);
-
-    m_title_bar->setVisible(m_title_bar_visible && !is_full_screen);
-
-    if (!is_full_screen)
-    {
-        m_gw->setTitleBarHeight(m_title_bar_visible ? title_bar_height : 0);
-
-        m_gw->setIconWidth(icon_width);
-
-        QRegion left_mask;
-        QRegion right_mask;
-        QRegion center_mask;
-
-        if (m_title_bar_left_widget)
-        {
-            QWidgetList list;
-
-            if (!m_left_widget_transparent_for_mouse)
-                list.append(m_title_bar_left_widget);
-
-            list.append(m_title_bar_left_widget->findChildren<QWidget*>());
-
-            for (QWidget *widget : list)
-            {
-                if (!widget->testAttribute(Qt::WA_TransparentForMouseEvents))
-                {
-                    if (!widget->mask().isNull())
-                    {
-                        left_mask += widget->mask().translated(m_title_bar->m_left_widget_place_holder->pos());
-                    }
-                    else
-                    {
-                        QRect geom = widget->geometry();
-
-                        if (geom.width() > m_title_bar_left_widget->width())
-                            geom.setWidth(m_title_bar_left_widget->width());
-
-                        left_mask += geom.translated(m_title_bar->m_left_widget_place_holder->pos());
-                    }
-                }
-            }
-        }
-
-        if (m_title_bar_right_widget)
-        {
-            QWidgetList list;
-
-            if (!m_right_widget_transparent_for_mouse)
-                list.append(m_title_bar_right_widget);
-
-            list.append(m_title_bar_right_widget->findChildren<QWidget*>());
-
-            for (QWidget *widget : list)
-            {
-                if (!widget->testAttribute(Qt::WA_TransparentForMouseEvents))
-                {
-                    if (!widget->mask().isNull())
-                    {
-                        right_mask += widget->mask().translated(m_title_bar->m_right_widget_place_holder->pos());
-                    }
-                    else
-                    {
-                        QRect geom = widget->geometry();
-
-                        if (geom.width() > m_title_bar_right_widget->width())
-                            geom.setWidth(m_title_bar_right_widget->width());
-
-                        right_mask += geom.translated(m_title_bar->m_right_widget_place_holder->pos());
-                    }
-                }
-            }
-        }
-
-        if (m_title_bar_center_widget)
-        {
-            QWidgetList list;
-
-            if (!m_center_widget_transparent_for_mouse)
-                list.append(m_title_bar_center_widget);
-
-            list.append(m_title_bar_center_widget->findChildren<QWidget*>());
-
-            for (QWidget *widget : list)
-            {
-                if (!widget->testAttribute(Qt::WA_TransparentForMouseEvents))
-                {
-                    if (!widget->mask().isNull())
-                    {
-                        center_mask += widget->mask().translated(m_title_bar->m_center_widget_place_holder->pos());
-                    }
-                    else
-                    {
-                        QRect geom = widget->geometry();
-
-                        if (geom.width() > m_title_bar_center_widget->width())
-                            geom.setWidth(m_title_bar_center_widget->width());
-
-                        center_mask += geom.translated(m_title_bar->m_center_widget_place_holder->pos());
-                    }
-                }
-            }
-        }
-
-        QRegion title_bar_mask;
-
-        if (!m_title_bar_mask.isEmpty())
-            title_bar_mask = m_title_bar_mask;
-        else
-            title_bar_mask -= m_gw->titleBarRect();
-
-        title_bar_mask += left_mask;
-        title_bar_mask += center_mask;
-        title_bar_mask += right_mask;
-
-        m_gw->setTitleBarMask(title_bar_mask);
-
-        if (m_caption_buttons_visible)
-        {
-            QRect min_rect = m_title_bar->minimizeButtonRect();
-            QRect max_rect = m_title_bar->maximizeButtonRect();
-            QRect cls_rect = m_title_bar->closeButtonRect();
-
-            min_rect.moveLeft(title_bar_width - cls_rect.width() - max_rect.width() - min_rect.width());
-            max_rect.moveLeft(title_bar_width - cls_rect.width() - max_rect.width());
-            cls_rect.moveLeft(title_bar_width - cls_rect.width());
-
-            m_gw->setMinimizeMask(min_rect);
-            m_gw->setMaximizeMask(max_rect);
-            m_gw->setCloseMask(cls_rect);
-        }
-    }
-
-    m_title_bar->setActive(window_active);
-
-    m_title_bar->updateWindow();
-#endif
-}
-
-bool QGoodCentralWidget::eventFilter(QObject *watched, QEvent *event)
-{
-#ifdef QGOODWINDOW
-    if (watched == m_gw)
-    {
-        switch (event->type())
-        {
-        case QEvent::Show:
-        case QEvent::Resize:
-        case QEvent::WindowStateChange:
-        case QEvent::WindowActivate:
-        case QEvent::WindowDeactivate:
-        {
-            updateWindow();
-            break;
-        }
-        default:
-            break;
-        }
-    }
-    else if (watched == m_title_bar)
-    {
-        switch (event->type())
-        {
-        case QEvent::Show:
-        {
-            updateWindow();
-            break;
-        }
-        default:
-            break;
-        }
-    }
-#endif
-    return QWidget::eventFilter(watched, event);
-}
-
-bool QGoodCentralWidget::event(QEvent *event)
-{
-#ifdef QGOODWINDOW
-#ifdef Q_OS_LINUX
-    switch (event->type())
-    {
-    case QEvent::Show:
-    case QEvent::Resize:
-    {
-        QTimer::singleShot(0, this, [=]{
-            if (!m_gw)
-                return;
-
-            if (!m_central_widget_place_holder)
-                return;
-
-            QRegion mask;
-
-            if (m_gw->isVisible() && m_gw->windowState().testFlag(Qt::WindowNoState))
-            {
-                const int radius = 8;
-
-                QBitmap bmp(m_central_widget_place_holder->size());
-                bmp.clear();
-
-                QPainter painter;
-                painter.begin(&bmp);
-                painter.setRenderHints(QPainter::Antialiasing);
-                painter.setPen(Qt::color1);
-                painter.setBrush(Qt::color1);
-                painter.drawRoundedRect(m_central_widget_place_holder->rect().adjusted(1, 1, -1, -1),
-                                        radius, radius, Qt::AbsoluteSize);
-                painter.end();
-
-                mask = bmp;
-            }
-
-            m_central_widget_place_holder->setMask(mask);
-        });
-
-        break;
-    }
-    default:
-        break;
-    }
-#endif
-#endif
-
-    return QWidget::event(event);
-}
+/*
+The MIT License (MIT)
+
+Copyright © 2022-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "qgoodcentralwidget.h"
+
+#ifdef QGOODWINDOW
+#include "titlebar.h"
+#include "windowpool.h"
+#define BORDERCOLOR QColor(24, 131, 215)
+#define ICONUPDATEINTERVAL 16 //One frame at 60 Hz
+#define LIVERESIZEINTERVAL 100 //Layout rate of the central widget while resizing
+#endif
+
+QGoodCentralWidget::QGoodCentralWidget(QGoodWindow *gw) : QWidget(gw)
+{
+    m_gw = gw;
+
+    m_gw->installEventFilter(this);
+
+    m_central_widget_place_holder = new QWidget(this);
+
+#ifdef QGOODWINDOW
+    m_left_widget_transparent_for_mouse = false;
+    m_right_widget_transparent_for_mouse = false;
+    m_center_widget_transparent_for_mouse = false;
+
+    m_frame_style = QString("QFrame#GoodFrame {%0}");
+
+    m_active_border_color = BORDERCOLOR;
+
+    m_caption_button_width = 36;
+
+    m_title_bar_visible = true;
+    m_caption_buttons_visible = true;
+    m_title_visible = true;
+    m_icon_visible = true;
+    m_icon_width = 0;
+
+    m_update_flags = 0;
+    m_update_pending = false;
+
+    m_flattened_geometry = false;
+
+    m_icon_update_pending = false;
+
+    m_live_resize_snapshot_enabled = false;
+
+    m_live_resize_timer = new QTimer(this);
+    m_live_resize_timer->setInterval(LIVERESIZEINTERVAL);
+    connect(m_live_resize_timer, &QTimer::timeout, this, &QGoodCentralWidget::updateLiveResizeSnapshot);
+
+    connect(m_gw, &QGoodWindow::liveResizeStarted, this, &QGoodCentralWidget::startLiveResizeSnapshot);
+    connect(m_gw, &QGoodWindow::liveResizeFinished, this, &QGoodCentralWidget::finishLiveResizeSnapshot);
+
+    m_title_bar = new TitleBar(m_gw, false/*single_widget*/, this);
+    m_title_bar->setCaptionButtonWidth(m_caption_button_width);
+
+    connectTitleBar();
+
+    connect(m_gw, &QGoodWindow::windowTitleChanged, this, [=](const QString &title){
+        m_title_bar->setTitle(title);
+    });
+
+    connect(m_gw, &QGoodWindow::windowIconChanged, this, [=](const QIcon &icon){
+        if (icon.isNull())
+            return;
+
+        m_window_icon = icon;
+
+        //Coalesce frequent icon changes, like progress badges, to one per frame.
+        if (m_icon_update_pending)
+            return;
+
+        m_icon_update_pending = true;
+
+        QTimer::singleShot(ICONUPDATEINTERVAL, this, [=]{
+            m_icon_update_pending = false;
+            m_title_bar->setIcon(m_window_icon);
+        });
+    });
+
+    m_draw_borders = !QGoodWindow::shouldBordersBeDrawnBySystem();
+
+#ifdef Q_OS_MAC
+    auto caption_buttons_visibility_changed_func = [=]{
+        if (m_gw->isNativeCaptionButtonsVisibleOnMac())
+        {
+            setCaptionButtonsVisible(false);
+            setIconVisible(false);
+
+            QRect rect = m_gw->titleBarButtonsRectOnMacOS();
+            m_title_bar->setLeftMargin(QSize(rect.x() * 2 + rect.width(), rect.y() + rect.height()));
+        }
+        else
+        {
+            setCaptionButtonsVisible(true);
+            setIconVisible(true);
+
+            m_title_bar->setLeftMargin(QSize(0, 0));
+        }
+    };
+
+    connect(m_gw, &QGoodWindow::captionButtonsVisibilityChangedOnMacOS, this, caption_buttons_visibility_changed_func);
+
+    caption_buttons_visibility_changed_func();
+#endif
+
+    m_frame = new QFrame(this);
+    m_frame->setObjectName("GoodFrame");
+
+    setUnifiedTitleBarAndCentralWidget(false);
+#else
+    QVBoxLayout *main_layout = new QVBoxLayout(this);
+    main_layout->setContentsMargins(0, 0, 0, 0);
+    main_layout->setSpacing(0);
+    main_layout->addWidget(m_central_widget_place_holder);
+#endif
+}
+
+QGoodCentralWidget::~QGoodCentralWidget()
+{
+
+}
+
+int QGoodCentralWidget::execDialogWithWindow(QDialog *dialog, QGoodWindow *parent_gw,
+                                             QGoodCentralWidget *base_gcw,
+                                             QWidget *left_title_bar_widget,
+                                             QWidget *right_title_bar_widget,
+                                             bool title_visible, bool icon_visible)
+{
+#ifdef QGOODWINDOW
+    if (dialog->isVisible())
+        return QDialog::Rejected;
+
+    QGoodWindow *gw = createDialogWindow(dialog, parent_gw, base_gcw,
+                                         left_title_bar_widget, right_title_bar_widget,
+                                         title_visible, icon_visible);
+
+    return QGoodWindow::execDialog(dialog, gw, parent_gw);
+#else
+    Q_UNUSED(parent_gw)
+    Q_UNUSED(base_gcw)
+    Q_UNUSED(left_title_bar_widget)
+    Q_UNUSED(right_title_bar_widget)
+    Q_UNUSED(title_visible)
+    Q_UNUSED(icon_visible)
+    return dialog->exec();
+#endif
+}
+
+bool QGoodCentralWidget::openDialogWithWindow(QDialog *dialog, QGoodWindow *parent_gw,
+                                              QGoodCentralWidget *base_gcw,
+                                              QWidget *left_title_bar_widget,
+                                              QWidget *right_title_bar_widget,
+                                              bool title_visible, bool icon_visible,
+                                              Qt::WindowModality modality)
+{
+#ifdef QGOODWINDOW
+    if (dialog->isVisible())
+        return false;
+
+    QGoodWindow *gw = createDialogWindow(dialog, parent_gw, base_gcw,
+                                         left_title_bar_widget, right_title_bar_widget,
+                                         title_visible, icon_visible);
+
+    if (!QGoodWindow::openDialog(dialog, gw, parent_gw, modality))
+    {
+        dialog->setParent(nullptr);
+        gw->deleteLater();
+        return false;
+    }
+
+    return true;
+#else
+    Q_UNUSED(parent_gw)
+    Q_UNUSED(base_gcw)
+    Q_UNUSED(left_title_bar_widget)
+    Q_UNUSED(right_title_bar_widget)
+    Q_UNUSED(title_visible)
+    Q_UNUSED(icon_visible)
+    dialog->setWindowModality(modality);
+    dialog->show();
+    return true;
+#endif
+}
+
+void QGoodCentralWidget::setWindowPoolSize(QGoodWindow *parent_gw, int count)
+{
+#ifdef QGOODWINDOW
+    WindowPool::instance()->setPoolSize(parent_gw, count);
+#else
+    Q_UNUSED(parent_gw)
+    Q_UNUSED(count)
+#endif
+}
+
+QGoodWindow *QGoodCentralWidget::takePooledWindow(QGoodWindow *parent_gw)
+{
+#ifdef QGOODWINDOW
+    return WindowPool::instance()->take(parent_gw)->m_gw;
+#else
+    QGoodWindow *gw = new QGoodWindow(parent_gw);
+    gw->setAttribute(Qt::WA_DeleteOnClose);
+    gw->setCentralWidget(new QGoodCentralWidget(gw));
+    return gw;
+#endif
+}
+
+#ifdef QGOODWINDOW
+QGoodWindow *QGoodCentralWidget::createDialogWindow(QDialog *dialog, QGoodWindow *parent_gw,
+                                                    QGoodCentralWidget *base_gcw,
+                                                    QWidget *left_title_bar_widget,
+                                                    QWidget *right_title_bar_widget,
+                                                    bool title_visible, bool icon_visible)
+{
+    dialog->setWindowFlags(Qt::Widget);
+
+    QGoodWindow *gw = nullptr;
+    QGoodCentralWidget *gcw = nullptr;
+
+    if (WindowPool::instance()->hasPool(parent_gw))
+    {
+        //Pooled windows return to the pool when closed.
+        gcw = WindowPool::instance()->take(parent_gw);
+        gw = gcw->m_gw;
+    }
+    else
+    {
+        gw = new QGoodWindow(parent_gw);
+        gw->setAttribute(Qt::WA_DeleteOnClose);
+
+        gcw = new QGoodCentralWidget(gw);
+        gw->setCentralWidget(gcw);
+    }
+
+    gw->resize(dialog->size());
+
+#ifdef Q_OS_MAC
+    gw->setNativeCaptionButtonsVisibleOnMac(parent_gw->isNativeCaptionButtonsVisibleOnMac());
+#endif
+
+    gcw->setCentralWidget(dialog);
+
+    gcw->setLeftTitleBarWidget(left_title_bar_widget);
+    gcw->setRightTitleBarWidget(right_title_bar_widget);
+
+    //Set every property, a pooled window may come from a previous dialog.
+    if (base_gcw && base_gcw->titleBarColor() != QColor(Qt::transparent))
+        gcw->setTitleBarColor(base_gcw->titleBarColor());
+    else
+        gcw->setTitleBarColor(QColor());
+
+    gcw->setActiveBorderColor(base_gcw ? base_gcw->activeBorderColor() : BORDERCOLOR);
+    gcw->setTitleAlignment(base_gcw ? base_gcw->titleAlignment() : Qt::AlignLeft);
+    gcw->setSingleWidgetTitleBar(base_gcw ? base_gcw->isSingleWidgetTitleBar() : false);
+
+    gcw->setTitleVisible(title_visible);
+    gcw->setIconVisible(icon_visible);
+
+    return gw;
+}
+#endif
+
+void QGoodCentralWidget::setUnifiedTitleBarAndCentralWidget(bool unified)
+{
+#ifdef QGOODWINDOW
+    if (!unified)
+    {
+        m_unified_title_bar_and_central_widget = false;
+        setTitleBarColor(QColor());
+    }
+    else
+    {
+        setTitleBarColor(QColor(Qt::transparent));
+        m_unified_title_bar_and_central_widget = true;
+    }
+
+    setupLayouts();
+#else
+    Q_UNUSED(unified)
+#endif
+}
+
+void QGoodCentralWidget::setFlattenedGeometry(bool flattened)
+{
+#ifdef QGOODWINDOW
+    if (m_flattened_geometry == flattened)
+        return;
+
+    m_flattened_geometry = flattened;
+
+    setupLayouts();
+
+    updateGeometry();
+#else
+    Q_UNUSED(flattened)
+#endif
+}
+
+void QGoodCentralWidget::setLiveResizeSnapshotEnabled(bool enabled)
+{
+#ifdef QGOODWINDOW
+    m_live_resize_snapshot_enabled = enabled;
+
+    if (!enabled)
+        finishLiveResizeSnapshot();
+#else
+    Q_UNUSED(enabled)
+#endif
+}
+
+void QGoodCentralWidget::setSingleWidgetTitleBar(bool single_widget)
+{
+#ifdef QGOODWINDOW
+    if (m_title_bar->isSingleWidget() == single_widget)
+        return;
+
+    TitleBar *old_title_bar = m_title_bar;
+
+    m_title_bar = new TitleBar(m_gw, single_widget, m_frame);
+    m_title_bar->setVisible(old_title_bar->isVisibleTo(this));
+    m_title_bar->setEnabled(old_title_bar->isEnabled());
+    m_title_bar->setFixedHeight(old_title_bar->height());
+    m_title_bar->setCaptionButtonWidth(m_caption_button_width);
+    m_title_bar->setTitleAlignment(old_title_bar->titleAlignment());
+    m_title_bar->setLeftMargin(old_title_bar->leftMargin());
+    m_title_bar->setCaptionButtonsVisible(m_caption_buttons_visible);
+    m_title_bar->setTitleVisible(m_title_visible);
+    m_title_bar->setIconVisible(m_icon_visible);
+    m_title_bar->setMaximized(old_title_bar->m_is_maximized);
+    m_title_bar->setActive(old_title_bar->m_active);
+
+    m_title_bar->m_title_bar_color = m_title_bar_color;
+    m_title_bar->setTheme();
+
+    m_title_bar->setTitle(m_gw->windowTitle());
+
+    if (!m_gw->windowIcon().isNull())
+        m_title_bar->setIcon(m_gw->windowIcon());
+
+    //Moves the title bar widgets to the new title bar.
+    m_title_bar->setLeftTitleBarWidget(m_title_bar_left_widget);
+    m_title_bar->setRightTitleBarWidget(m_title_bar_right_widget);
+    m_title_bar->setCenterTitleBarWidget(m_title_bar_center_widget);
+
+    connectTitleBar();
+
+    if (!m_flattened_geometry)
+        delete m_frame->layout()->replaceWidget(old_title_bar, m_title_bar);
+
+    delete old_title_bar;
+
+    updateFlattenedGeometry();
+
+    scheduleUpdate(UpdateAll);
+#else
+    Q_UNUSED(single_widget)
+#endif
+}
+
+void QGoodCentralWidget::setTitleBarMask(const QRegion &mask)
+{
+#ifdef QGOODWINDOW
+    if (m_title_bar_mask == mask)
+        return;
+
+    m_title_bar_mask = mask;
+    scheduleUpdate(UpdateMasks);
+#else
+    Q_UNUSED(mask)
+#endif
+}
+
+QWidget *QGoodCentralWidget::setLeftTitleBarWidget(QWidget *widget, bool transparent_for_mouse)
+{
+#ifdef QGOODWINDOW
+    QWidget *return_widget = m_title_bar_left_widget;
+
+    if (return_widget == widget && m_left_widget_transparent_for_mouse == transparent_for_mouse)
+        return return_widget;
+
+    m_title_bar_left_widget = widget;
+
+    m_left_widget_transparent_for_mouse = transparent_for_mouse;
+
+    m_title_bar->setLeftTitleBarWidget(m_title_bar_left_widget);
+
+    scheduleUpdate(UpdateMasks);
+
+    return return_widget;
+#else
+    Q_UNUSED(widget)
+    Q_UNUSED(transparent_for_mouse)
+    return nullptr;
+#endif
+}
+
+QWidget *QGoodCentralWidget::setRightTitleBarWidget(QWidget *widget, bool transparent_for_mouse)
+{
+#ifdef QGOODWINDOW
+    QWidget *return_widget = m_title_bar_right_widget;
+
+    if (return_widget == widget && m_right_widget_transparent_for_mouse == transparent_for_mouse)
+        return return_widget;
+
+    m_title_bar_right_widget = widget;
+
+    m_right_widget_transparent_for_mouse = transparent_for_mouse;
+
+    m_title_bar->setRightTitleBarWidget(m_title_bar_right_widget);
+
+    scheduleUpdate(UpdateMasks);
+
+    return return_widget;
+#else
+    Q_UNUSED(widget)
+    Q_UNUSED(transparent_for_mouse)
+    return nullptr;
+#endif
+}
+
+QWidget *QGoodCentralWidget::setCenterTitleBarWidget(QWidget *widget, bool transparent_for_mouse)
+{
+#ifdef QGOODWINDOW
+    QWidget *return_widget = m_title_bar_center_widget;
+
+    if (return_widget == widget && m_center_widget_transparent_for_mouse == transparent_for_mouse)
+        return return_widget;
+
+    m_title_bar_center_widget = widget;
+
+    m_center_widget_transparent_for_mouse = transparent_for_mouse;
+
+    m_title_bar->setCenterTitleBarWidget(m_title_bar_center_widget);
+
+    scheduleUpdate(UpdateMasks);
+
+    return return_widget;
+#else
+    Q_UNUSED(widget)
+    Q_UNUSED(transparent_for_mouse)
+    return nullptr;
+#endif
+}
+
+void QGoodCentralWidget::setCentralWidget(QWidget *widget)
+{
+    if (!m_central_widget_place_holder)
+        return;
+
+    m_central_widget = widget;
+
+    if (m_central_widget_place_holder->layout())
+        delete m_central_widget_place_holder->layout();
+
+#ifdef QGOODWINDOW
+    m_live_resize_timer->stop();
+    delete m_live_resize_snapshot;
+    delete m_live_resize_stand_in;
+
+    if (m_flattened_geometry)
+    {
+        if (m_central_widget)
+        {
+            m_central_widget->setParent(m_central_widget_place_holder);
+            m_central_widget->show();
+        }
+
+        updateFlattenedGeometry();
+
+        return;
+    }
+#endif
+
+    QGridLayout *layout = new QGridLayout(m_central_widget_place_holder);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->setSpacing(0);
+
+    if (m_central_widget)
+        layout->addWidget(m_central_widget);
+}
+
+void QGoodCentralWidget::setTitleAlignment(const Qt::Alignment &alignment)
+{
+#ifdef QGOODWINDOW
+    m_title_bar->setTitleAlignment(alignment);
+#else
+    Q_UNUSED(alignment)
+#endif
+}
+
+void QGoodCentralWidget::setTitleBarColor(const QColor &color)
+{
+#ifdef QGOODWINDOW
+    if (m_unified_title_bar_and_central_widget)
+        return;
+
+    if (m_title_bar_color == color)
+        return;
+
+    m_title_bar_color = color;
+    m_title_bar->m_title_bar_color = m_title_bar_color;
+    m_title_bar->setTheme();
+#else
+    Q_UNUSED(color)
+#endif
+}
+
+void QGoodCentralWidget::setActiveBorderColor(const QColor &color)
+{
+#ifdef QGOODWINDOW
+    const QColor active_border_color = (color.isValid() ? color : BORDERCOLOR);
+
+    if (m_active_border_color == active_border_color)
+        return;
+
+    m_active_border_color = active_border_color;
+
+    scheduleUpdate(UpdateBorderStyle);
+#else
+    Q_UNUSED(color)
+#endif
+}
+
+void QGoodCentralWidget::setTitleBarVisible(bool visible)
+{
+#ifdef QGOODWINDOW
+    if (m_title_bar_visible == visible)
+        return;
+
+    m_title_bar_visible = visible;
+    m_title_bar->setVisible(m_title_bar_visible);
+    m_title_bar->setEnabled(m_title_bar_visible);
+#ifdef Q_OS_MAC
+    m_gw->setNativeCaptionButtonsVisibleOnMac(visible);
+#endif
+    updateFlattenedGeometry();
+    scheduleUpdate(UpdateMasks | UpdateCaptionButtonRects);
+#else
+    Q_UNUSED(visible)
+#endif
+}
+
+void QGoodCentralWidget::setCaptionButtonsVisible(bool visible)
+{
+#ifdef QGOODWINDOW
+    if (m_caption_buttons_visible == visible)
+        return;
+
+    m_caption_buttons_visible = visible;
+
+    m_title_bar->setCaptionButtonsVisible(m_caption_buttons_visible);
+
+    if (!m_caption_buttons_visible)
+    {
+        m_gw->setMinimizeMask(QRegion());
+        m_gw->setMaximizeMask(QRegion());
+        m_gw->setCloseMask(QRegion());
+    }
+
+    scheduleUpdate(UpdateMasks | UpdateCaptionButtonRects);
+#else
+    Q_UNUSED(visible)
+#endif
+}
+
+void QGoodCentralWidget::setTitleVisible(bool visible)
+{
+#ifdef QGOODWINDOW
+    if (m_title_visible == visible)
+        return;
+
+    m_title_visible = visible;
+    m_title_bar->setTitleVisible(m_title_visible);
+#else
+    Q_UNUSED(visible)
+#endif
+}
+
+void QGoodCentralWidget::setIconVisible(bool visible)
+{
+#ifdef QGOODWINDOW
+    if (m_icon_visible == visible)
+        return;
+
+    m_icon_visible = visible;
+    m_title_bar->setIconVisible(m_icon_visible);
+    scheduleUpdate(UpdateMasks);
+#else
+    Q_UNUSED(visible)
+#endif
+}
+
+void QGoodCentralWidget::setIconWidth(int width)
+{
+#ifdef QGOODWINDOW
+    if (m_icon_width == width)
+        return;
+
+    m_icon_width = width;
+    scheduleUpdate(UpdateMasks);
+#else
+    Q_UNUSED(width)
+#endif
+}
+
+void QGoodCentralWidget::setTitleBarHeight(int height)
+{
+#ifdef QGOODWINDOW
+    if (m_title_bar->minimumHeight() == height && m_title_bar->maximumHeight() == height)
+        return;
+
+    m_title_bar->setFixedHeight(height);
+    m_title_bar->setCaptionButtonWidth(m_caption_button_width);
+    updateFlattenedGeometry();
+    scheduleUpdate(UpdateMasks | UpdateCaptionButtonRects);
+#else
+    Q_UNUSED(height)
+#endif
+}
+
+void QGoodCentralWidget::setCaptionButtonWidth(int width)
+{
+#ifdef QGOODWINDOW
+    if (m_caption_button_width == width)
+        return;
+
+    m_caption_button_width = width;
+    m_title_bar->setCaptionButtonWidth(m_caption_button_width);
+    scheduleUpdate(UpdateMasks | UpdateCaptionButtonRects);
+#else
+    Q_UNUSED(width)
+#endif
+}
+
+bool QGoodCentralWidget::isSingleWidgetTitleBar() const
+{
+#ifdef QGOODWINDOW
+    return m_title_bar->isSingleWidget();
+#else
+    return false;
+#endif
+}
+
+bool QGoodCentralWidget::isFlattenedGeometry() const
+{
+#ifdef QGOODWINDOW
+    return m_flattened_geometry;
+#else
+    return false;
+#endif
+}
+
+bool QGoodCentralWidget::isLiveResizeSnapshotEnabled() const
+{
+#ifdef QGOODWINDOW
+    return m_live_resize_snapshot_enabled;
+#else
+    return false;
+#endif
+}
+
+bool QGoodCentralWidget::isUnifiedTitleBarAndCentralWidget() const
+{
+#ifdef QGOODWINDOW
+    return m_unified_title_bar_and_central_widget;
+#else
+    return false;
+#endif
+}
+
+QWidget *QGoodCentralWidget::leftTitleBarWidget() const
+{
+#ifdef QGOODWINDOW
+    return m_title_bar_left_widget;
+#else
+    return nullptr;
+#endif
+}
+
+QWidget *QGoodCentralWidget::rightTitleBarWidget() const
+{
+#ifdef QGOODWINDOW
+    return m_title_bar_right_widget;
+#else
+    return nullptr;
+#endif
+}
+
+QWidget *QGoodCentralWidget::centerTitleBarWidget() const
+{
+#ifdef QGOODWINDOW
+    return m_title_bar_center_widget;
+#else
+    return nullptr;
+#endif
+}
+
+QWidget *QGoodCentralWidget::centralWidget() const
+{
+    return m_central_widget;
+}
+
+Qt::Alignment QGoodCentralWidget::titleAlignment() const
+{
+#ifdef QGOODWINDOW
+    return m_title_bar->titleAlignment();
+#else
+    return Qt::Alignment(0);
+#endif
+}
+
+QColor QGoodCentralWidget::titleBarColor() const
+{
+#ifdef QGOODWINDOW
+    return m_title_bar_color;
+#else
+    return QColor();
+#endif
+}
+
+QColor QGoodCentralWidget::activeBorderColor() const
+{
+#ifdef QGOODWINDOW
+    return m_active_border_color;
+#else
+    return QColor();
+#endif
+}
+
+bool QGoodCentralWidget::isTitleBarVisible() const
+{
+#ifdef QGOODWINDOW
+    return m_title_bar->isVisible();
+#else
+    return true;
+#endif
+}
+
+bool QGoodCentralWidget::isCaptionButtonsVisible() const
+{
+#ifdef QGOODWINDOW
+    return m_caption_buttons_visible;
+#else
+    return true;
+#endif
+}
+
+bool QGoodCentralWidget::isTitleVisible() const
+{
+#ifdef QGOODWINDOW
+    return m_title_visible;
+#else
+    return true;
+#endif
+}
+
+bool QGoodCentralWidget::isIconVisible() const
+{
+#ifdef QGOODWINDOW
+    return m_icon_visible;
+#else
+    return true;
+#endif
+}
+
+int QGoodCentralWidget::iconWidth() const
+{
+#ifdef QGOODWINDOW
+    return m_icon_width;
+#else
+    return 0;
+#endif
+}
+
+int QGoodCentralWidget::titleBarHeight() const
+{
+#ifdef QGOODWINDOW
+    return m_title_bar->height();
+#else
+    return 0;
+#endif
+}
+
+int QGoodCentralWidget::captionButtonWidth() const
+{
+#ifdef QGOODWINDOW
+    return m_caption_button_width;
+#else
+    return 0;
+#endif
+}
+
+void QGoodCentralWidget::setupLayouts()
+{
+#ifdef QGOODWINDOW
+    if (layout())
+        delete layout();
+
+    if (m_frame->layout())
+        delete m_frame->layout();
+
+    if (m_central_widget_place_holder->layout())
+        delete m_central_widget_place_holder->layout();
+
+    if (m_flattened_geometry)
+    {
+        //Geometries are computed on each resize by updateFlattenedGeometry().
+        updateFlattenedGeometry();
+        return;
+    }
+
+    QVBoxLayout *central_layout = new QVBoxLayout(this);
+    central_layout->setContentsMargins(0, 0, 0, 0);
+    central_layout->setSpacing(0);
+    central_layout->addWidget(m_frame);
+
+    if (!m_unified_title_bar_and_central_widget)
+    {
+        QVBoxLayout *main_layout = new QVBoxLayout(m_frame);
+        main_layout->setContentsMargins(0, 0, 0, 0);
+        main_layout->setSpacing(0);
+        main_layout->addWidget(m_title_bar);
+        main_layout->addWidget(m_central_widget_place_holder);
+    }
+    else
+    {
+        QStackedLayout *main_layout = new QStackedLayout(m_frame);
+        main_layout->setStackingMode(QStackedLayout::StackAll);
+        main_layout->setContentsMargins(0, 0, 0, 0);
+        main_layout->setSpacing(0);
+        main_layout->addWidget(m_title_bar);
+        main_layout->addWidget(m_central_widget_place_holder);
+    }
+
+    if (m_central_widget)
+        setCentralWidget(m_central_widget);
+#endif
+}
+
+void QGoodCentralWidget::updateFlattenedGeometry()
+{
+#ifdef QGOODWINDOW
+    if (!m_flattened_geometry)
+        return;
+
+    m_frame->setGeometry(rect());
+
+    const QRect contents_rect = m_frame->contentsRect();
+
+    QRect central_rect = contents_rect;
+
+    if (!m_title_bar->isHidden())
+    {
+        const QRect title_bar_rect = QRect(contents_rect.topLeft(),
+                                           QSize(contents_rect.width(), m_title_bar->minimumHeight()));
+
+        m_title_bar->setGeometry(title_bar_rect);
+
+        if (!m_unified_title_bar_and_central_widget)
+            central_rect.setTop(title_bar_rect.bottom() + 1);
+        else
+            m_title_bar->raise();
+    }
+
+    m_central_widget_place_holder->setGeometry(central_rect);
+
+    //While resizing with a snapshot, the central widget is laid out at a lower rate.
+    if (m_central_widget && !m_live_resize_snapshot)
+        m_central_widget->setGeometry(QRect(QPoint(0, 0), central_rect.size()));
+#endif
+}
+
+void QGoodCentralWidget::startLiveResizeSnapshot()
+{
+#ifdef QGOODWINDOW
+    if (!m_live_resize_snapshot_enabled || m_live_resize_snapshot)
+        return;
+
+    if (!m_central_widget || !m_central_widget->isVisible())
+        return;
+
+    //Keep the central widget at its geometry, out of the layout,
+    //covered by a snapshot of its contents anchored to the top left corner.
+    //An empty widget with the same size constraints takes its place in the layout.
+    QLayout *layout = m_central_widget_place_holder->layout();
+
+    if (layout && layout->indexOf(m_central_widget) >= 0)
+    {
+        QLayoutItem *central_item = layout->itemAt(layout->indexOf(m_central_widget));
+
+        m_live_resize_stand_in = new QWidget(m_central_widget_place_holder);
+        m_live_resize_stand_in->setMinimumSize(central_item->minimumSize());
+        m_live_resize_stand_in->setMaximumSize(central_item->maximumSize());
+        m_live_resize_stand_in->setSizePolicy(m_central_widget->sizePolicy());
+
+        delete layout->replaceWidget(m_central_widget, m_live_resize_stand_in);
+        m_live_resize_stand_in->show();
+    }
+
+    m_live_resize_snapshot = new QLabel(m_central_widget_place_holder);
+    m_live_resize_snapshot->setAlignment(Qt::AlignLeft | Qt::AlignTop);
+    m_live_resize_snapshot->setAutoFillBackground(true);
+    m_live_resize_snapshot->setPixmap(m_central_widget->grab());
+    m_live_resize_snapshot->setGeometry(m_central_widget_place_holder->rect());
+    m_live_resize_snapshot->show();
+    m_live_resize_snapshot->raise();
+
+    m_live_resize_timer->start();
+#endif
+}
+
+void QGoodCentralWidget::updateLiveResizeSnapshot()
+{
+#ifdef QGOODWINDOW
+    if (!m_live_resize_snapshot || !m_central_widget)
+        return;
+
+    const QRect rect = (m_live_resize_stand_in ? m_live_resize_stand_in->geometry() :
+                                                 m_central_widget_place_holder->rect());
+
+    if (m_central_widget->geometry() == rect)
+        return;
+
+    m_central_widget->setGeometry(rect);
+    m_live_resize_snapshot->setPixmap(m_central_widget->grab());
+#endif
+}
+
+void QGoodCentralWidget::finishLiveResizeSnapshot()
+{
+#ifdef QGOODWINDOW
+    m_live_resize_timer->stop();
+
+    if (!m_live_resize_snapshot)
+        return;
+
+    delete m_live_resize_snapshot;
+
+    //Put the central widget back in place of the stand-in and lay it out exactly now.
+    QLayout *layout = m_central_widget_place_holder->layout();
+
+    if (layout && m_live_resize_stand_in && m_central_widget)
+        delete layout->replaceWidget(m_live_resize_stand_in, m_central_widget);
+
+    delete m_live_resize_stand_in;
+
+    if (layout)
+        layout->activate();
+    else if (m_flattened_geometry)
+        updateFlattenedGeometry();
+#endif
+}
+
+QSize QGoodCentralWidget::flattenedSizeHint(const QSize &central_widget_size) const
+{
+#ifdef QGOODWINDOW
+    QSize size = central_widget_size.expandedTo(QSize(0, 0));
+
+    if (!m_unified_title_bar_and_central_widget && !m_title_bar->isHidden())
+        size.rheight() += m_title_bar->minimumHeight();
+
+    const int frame_width = m_frame->frameWidth();
+
+    size += QSize(frame_width * 2, frame_width * 2);
+
+    return size;
+#else
+    return central_widget_size;
+#endif
+}
+
+QSize QGoodCentralWidget::sizeHint() const
+{
+#ifdef QGOODWINDOW
+    if (m_flattened_geometry)
+        return flattenedSizeHint(m_central_widget ? m_central_widget->sizeHint() : QSize());
+#endif
+    return QWidget::sizeHint();
+}
+
+QSize QGoodCentralWidget::minimumSizeHint() const
+{
+#ifdef QGOODWINDOW
+    if (m_flattened_geometry)
+    {
+        QSize size;
+
+        if (m_central_widget)
+            size = m_central_widget->minimumSizeHint().expandedTo(m_central_widget->minimumSize());
+
+        return flattenedSizeHint(size);
+    }
+#endif
+    return QWidget::minimumSizeHint();
+}
+
+void QGoodCentralWidget::connectTitleBar()
+{
+#ifdef QGOODWINDOW
+    m_title_bar->installEventFilter(this);
+
+    connect(m_gw, &QGoodWindow::captionButtonStateChanged, m_title_bar, &TitleBar::captionButtonStateChanged);
+
+    connect(m_title_bar, &TitleBar::showMinimized, m_gw, &QGoodWindow::showMinimized);
+    connect(m_title_bar, &TitleBar::showNormal, m_gw, &QGoodWindow::showNormal);
+    connect(m_title_bar, &TitleBar::showMaximized, m_gw, &QGoodWindow::showMaximized);
+    connect(m_title_bar, &TitleBar::closeWindow, m_gw, &QGoodWindow::close);
+#endif
+}
+
+void QGoodCentralWidget::updateWindow()
+{
+#ifdef QGOODWINDOW
+    scheduleUpdate(UpdateAll);
+#endif
+}
+
+void QGoodCentralWidget::scheduleUpdate(int flags)
+{
+#ifdef QGOODWINDOW
+    m_update_flags |= flags;
+
+    //Only one update pending at a time, further requests just add their flags.
+    if (m_update_pending)
+        return;
+
+    m_update_pending = true;
+
+    QTimer::singleShot(0, this, &QGoodCentralWidget::updateWindowLater);
+#else
+    Q_UNUSED(flags)
+#endif
+}
+
+void QGoodCentralWidget::updateWindowLater()
+{
+#ifdef QGOODWINDOW
+    m_update_pending = false;
+
+    if (!m_gw)
+        return;
+
+    //Keep the flags until the window is shown again.
+    if (!m_gw->isVisible() || m_gw->isMinimized())
+        return;
+
+    const int flags = m_update_flags;
+
+    m_update_flags = 0;
+
+    bool window_active = m_gw->isActiveWindow();
+    bool window_no_state = m_gw->windowState().testFlag(Qt::WindowNoState);
+    bool draw_borders = m_draw_borders;
+    bool is_maximized = m_gw->isMaximized();
+    bool is_full_screen = m_gw->isFullScreen();
+    int title_bar_width = m_title_bar->width();
+    int title_bar_height = m_title_bar->height();
+
+    int icon_width = m_icon_width;
+
+    if (m_icon_visible)
+        icon_width = m_title_bar->iconWidth();
+
+    if (flags & UpdateBorderStyle)
+    {
+        QString border_str = "none;";
+
+        if (draw_borders && window_no_state)
+        {
+            if (window_active)
+                border_str = QString("border: 1px solid %0;").arg(m_active_border_color.name());
+            else
+                border_str = "border: 1px solid #AAAAAA;";
+        }
+
+#ifdef Q_OS_LINUX
+        border_str.append("border-radius: 8px;");
+#endif
+
+        const QString frame_style = m_frame_style.arg(border_str);
+
+        //Setting a style sheet repolishes the whole frame, only do it when changed.
+        if (m_frame->styleSheet() != frame_style)
+            m_frame->setStyleSheet(frame_style);
+    }
+
+    if (flags & UpdateCaptionButtonRects)
+        m_title_bar->setMaximized(is_maximized && !is_full_screen);
+
+    if (flags & UpdateMasks)
+        m_title_bar->setVisible(m_title_bar_visible && !is_full_screen);
+
+    //Border width and title bar visibility changes the central rect.
+    if (flags & (UpdateBorderStyle | UpdateMasks))
+        updateFlattenedGeometry();
+
+    if (!is_full_screen && (flags & UpdateMasks))
+    {
+        const int gw_title_bar_height = (m_title_bar_visible ? title_bar_height : 0);
+
+        if (m_gw->titleBarHeight() != gw_title_bar_height)
+            m_gw->setTitleBarHeight(gw_title_bar_height);
+
+        if (m_gw->iconWidth() != icon_width)
+            m_gw->setIconWidth(icon_width);
+
+        QRegion left_mask;
+        QRegion right_mask;
+        QRegion center_mask;
+
+        if (m_title_bar_left_widget)
+        {
+            //Title bar widget position, either inside the place holder or directly on the title bar.
+            const QPoint origin = m_title_bar_left_widget->mapTo(m_title_bar, QPoint(0, 0));
+
+            QWidgetList list;
+
+            if (!m_left_widget_transparent_for_mouse)
+                list.append(m_title_bar_left_widget);
+
+            list.append(m_title_bar_left_widget->findChildren<QWidget*>());
+
+            for (QWidget *widget : list)
+            {
+                if (!widget->testAttribute(Qt::WA_TransparentForMouseEvents))
+                {
+                    if (!widget->mask().isNull())
+                    {
+                        left_mask += widget->mask().translated(origin);
+                    }
+                    else
+                    {
+                        QRect geom = (widget != m_title_bar_left_widget) ? widget->geometry() : widget->rect();
+
+                        if (geom.width() > m_title_bar_left_widget->width())
+                            geom.setWidth(m_title_bar_left_widget->width());
+
+                        left_mask += geom.translated(origin);
+                    }
+                }
+            }
+        }
+
+        if (m_title_bar_right_widget)
+        {
+            //Title bar widget position, either inside the place holder or directly on the title bar.
+            const QPoint origin = m_title_bar_right_widget->mapTo(m_title_bar, QPoint(0, 0));
+
+            QWidgetList list;
+
+            if (!m_right_widget_transparent_for_mouse)
+                list.append(m_title_bar_right_widget);
+
+            list.append(m_title_bar_right_widget->findChildren<QWidget*>());
+
+            for (QWidget *widget : list)
+            {
+                if (!widget->testAttribute(Qt::WA_TransparentForMouseEvents))
+                {
+                    if (!widget->mask().isNull())
+                    {
+                        right_mask += widget->mask().translated(origin);
+                    }
+                    else
+                    {
+                        QRect geom = (widget != m_title_bar_right_widget) ? widget->geometry() : widget->rect();
+
+                        if (geom.width() > m_title_bar_right_widget->width())
+                            geom.setWidth(m_title_bar_right_widget->width());
+
+                        right_mask += geom.translated(origin);
+                    }
+                }
+            }
+        }
+
+        if (m_title_bar_center_widget)
+        {
+            //Title bar widget position, either inside the place holder or directly on the title bar.
+            const QPoint origin = m_title_bar_center_widget->mapTo(m_title_bar, QPoint(0, 0));
+
+            QWidgetList list;
+
+            if (!m_center_widget_transparent_for_mouse)
+                list.append(m_title_bar_center_widget);
+
+            list.append(m_title_bar_center_widget->findChildren<QWidget*>());
+
+            for (QWidget *widget : list)
+            {
+                if (!widget->testAttribute(Qt::WA_TransparentForMouseEvents))
+                {
+                    if (!widget->mask().isNull())
+                    {
+                        center_mask += widget->mask().translated(origin);
+                    }
+                    else
+                    {
+                        QRect geom = (widget != m_title_bar_center_widget) ? widget->geometry() : widget->rect();
+
+                        if (geom.width() > m_title_bar_center_widget->width())
+                            geom.setWidth(m_title_bar_center_widget->width());
+
+                        center_mask += geom.translated(origin);
+                    }
+                }
+            }
+        }
+
+        QRegion title_bar_mask;
+
+        if (!m_title_bar_mask.isEmpty())
+            title_bar_mask = m_title_bar_mask;
+        else
+            title_bar_mask -= m_gw->titleBarRect();
+
+        title_bar_mask += left_mask;
+        title_bar_mask += center_mask;
+        title_bar_mask += right_mask;
+
+        if (m_gw->titleBarMask() != title_bar_mask)
+            m_gw->setTitleBarMask(title_bar_mask);
+    }
+
+    if (!is_full_screen && (flags & UpdateCaptionButtonRects) && m_caption_buttons_visible)
+    {
+        QRect min_rect = m_title_bar->minimizeButtonRect();
+        QRect max_rect = m_title_bar->maximizeButtonRect();
+        QRect cls_rect = m_title_bar->closeButtonRect();
+
+        min_rect.moveLeft(title_bar_width - cls_rect.width() - max_rect.width() - min_rect.width());
+        max_rect.moveLeft(title_bar_width - cls_rect.width() - max_rect.width());
+        cls_rect.moveLeft(title_bar_width - cls_rect.width());
+
+        if (m_gw->minimizeMask() != QRegion(min_rect))
+            m_gw->setMinimizeMask(min_rect);
+
+        if (m_gw->maximizeMask() != QRegion(max_rect))
+            m_gw->setMaximizeMask(max_rect);
+
+        if (m_gw->closeMask() != QRegion(cls_rect))
+            m_gw->setCloseMask(cls_rect);
+    }
+
+    if (flags & UpdateActiveState)
+        m_title_bar->setActive(window_active);
+
+    if (flags & UpdateMasks)
+        m_title_bar->updateWindow();
+#endif
+}
+
+bool QGoodCentralWidget::eventFilter(QObject *watched, QEvent *event)
+{
+#ifdef QGOODWINDOW
+    if (watched == m_gw)
+    {
+        switch (event->type())
+        {
+        case QEvent::Show:
+        {
+            scheduleUpdate(UpdateAll);
+            break;
+        }
+        case QEvent::Resize:
+        {
+            scheduleUpdate(UpdateMasks | UpdateCaptionButtonRects);
+            break;
+        }
+        case QEvent::WindowStateChange:
+        {
+            scheduleUpdate(UpdateBorderStyle | UpdateMasks | UpdateCaptionButtonRects);
+            break;
+        }
+        case QEvent::WindowActivate:
+        case QEvent::WindowDeactivate:
+        {
+            scheduleUpdate(UpdateBorderStyle | UpdateActiveState);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    else if (watched == m_title_bar)
+    {
+        switch (event->type())
+        {
+        case QEvent::Show:
+        {
+            scheduleUpdate(UpdateMasks | UpdateCaptionButtonRects);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+#endif
+    return QWidget::eventFilter(watched, event);
+}
+
+bool QGoodCentralWidget::event(QEvent *event)
+{
+#ifdef QGOODWINDOW
+    switch (event->type())
+    {
+    case QEvent::Resize:
+    {
+        //One geometry pass per resize when the layouts are flattened.
+        updateFlattenedGeometry();
+
+        if (m_live_resize_snapshot)
+            m_live_resize_snapshot->setGeometry(m_central_widget_place_holder->rect());
+
+        break;
+    }
+    default:
+        break;
+    }
+
+#ifdef Q_OS_LINUX
+    switch (event->type())
+    {
+    case QEvent::Show:
+    case QEvent::Resize:
+    {
+        QTimer::singleShot(0, this, [=]{
+            if (!m_gw)
+                return;
+
+            if (!m_central_widget_place_holder)
+                return;
+
+            QRegion mask;
+
+            if (m_gw->isVisible() && m_gw->windowState().testFlag(Qt::WindowNoState))
+            {
+                const int radius = 8;
+
+                QBitmap bmp(m_central_widget_place_holder->size());
+                bmp.clear();
+
+                QPainter painter;
+                painter.begin(&bmp);
+                painter.setRenderHints(QPainter::Antialiasing);
+                painter.setPen(Qt::color1);
+                painter.setBrush(Qt::color1);
+                painter.drawRoundedRect(m_central_widget_place_holder->rect().adjusted(1, 1, -1, -1),
+                                        radius, radius, Qt::AbsoluteSize);
+                painter.end();
+
+                mask = bmp;
+            }
+
+            m_central_widget_place_holder->setMask(mask);
+        });
+
+        break;
+    }
+    default:
+        break;
+    }
+#endif
+#endif
+
+    return QWidget::event(event);
+}
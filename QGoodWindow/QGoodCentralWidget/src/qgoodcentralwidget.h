@@ -1,204 +1,293 @@
-/*
-The MIT License (MIT)
-
-Copyright © 2022-2023 Antonio Dias (https://github.com/antonypro)
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#ifndef QGOODCENTRALWIDGET_H
-#define QGOODCENTRALWIDGET_H
-
-#include <QGoodWindow>
-
-#include "qgoodcentralwidget_global.h"
-
-#ifdef QGOODWINDOW
-class TitleBar;
-#endif
-
-/** **QGoodCentralWidget** class contains the public API's to control the behavior of **QGoodWindow**. */
-class QGOODWINDOW_SHARED_EXPORT QGoodCentralWidget : public QWidget
-{
-    Q_OBJECT
-public:
-    /** Constructor of *QGoodCentralWidget*, is mandatory pass a valid instance of the parent *QGoodWindow*. */
-    explicit QGoodCentralWidget(QGoodWindow *gw);
-    /** Destructor of *QGoodCentralWidget*. */
-    ~QGoodCentralWidget();
-
-    /** Utility for showing a modal *QDialog* with customized title bar and borders.
-        Pass the *QDialog* and the parent *QGoodWindow* and optionally a *QGoodCentralWidget* for mimic
-        it's colors on the new window. Optionally pass a left title bar widget,
-        a right title bar widget and set the visibility
-        of title and icon on the new window. */
-    static int execDialogWithWindow(QDialog *dialog, QGoodWindow *parent_gw,
-                                    QGoodCentralWidget *base_gcw = nullptr,
-                                    QWidget *left_title_bar_widget = nullptr,
-                                    QWidget *right_title_bar_widget = nullptr,
-                                    bool title_visible = true, bool icon_visible = true);
-
-public Q_SLOTS:
-    /** Set the title bar and the central widget unified. */
-    void setUnifiedTitleBarAndCentralWidget(bool unified);
-
-    /** Set the title bar mask, the title bar widgets masks united with this mask. */
-    void setTitleBarMask(const QRegion &mask);
-
-    /** Set the left title bar widget and returns the previous widget or nullptr if none, delete this widget as needed.
-        If the widget is transparent for mouse, but not it's children's set \e transparent_for_mouse to true. */
-    QWidget *setLeftTitleBarWidget(QWidget *widget, bool transparent_for_mouse = false);
-
-    /** Set the right title bar widget and returns the previous widget or nullptr if none, delete this widget as needed.
-        If the widget is transparent for mouse, but not it's children's set \e transparent_for_mouse to true. */
-    QWidget *setRightTitleBarWidget(QWidget *widget, bool transparent_for_mouse = false);
-
-    /** Set the center title bar widget and returns the previous widget or nullptr if none, delete this widget as needed.
-        If the widget is transparent for mouse, but not it's children's set \e transparent_for_mouse to true. */
-    QWidget *setCenterTitleBarWidget(QWidget *widget, bool transparent_for_mouse = false);
-
-    /** Set the central widget of *QGoodCentralWidget*. */
-    void setCentralWidget(QWidget *widget);
-
-    /** Set the alignment of *QGoodCentralWidget* title on the title bar.
-        Note: If align to center and also set a central title bar widget
-        the title will be aligned to the left.*/
-    void setTitleAlignment(const Qt::Alignment &alignment);
-
-    /** Set the color of *QGoodCentralWidget* title bar. */
-    void setTitleBarColor(const QColor &color);
-
-    /** Set the color of *QGoodCentralWidget* border. */
-    void setActiveBorderColor(const QColor &color);
-
-    /** Change the visibility of *QGoodCentralWidget* title bar. */
-    void setTitleBarVisible(bool visible);
-
-    /** Change the visibility of *QGoodCentralWidget* caption buttons. */
-    void setCaptionButtonsVisible(bool visible);
-
-    /** Change the visibility of *QGoodCentralWidget* title bar title. */
-    void setTitleVisible(bool visible);
-
-    /** Change the visibility of *QGoodCentralWidget* title bar icon. */
-    void setIconVisible(bool visible);
-
-    /** Change the width of *QGoodCentralWidget* title bar icon,
-     * width higher than 0 will hide the *QGoodCentralWidget* provided icon,
-     * this is useful when showing own icons. */
-    void setIconWidth(int width);
-
-    /** Change the title bar height to \e height multiplied to current pixel ratio. */
-    void setTitleBarHeight(int height);
-
-    /** Change the caption button width to \e width multiplied to current pixel ratio. */
-    void setCaptionButtonWidth(int width);
-
-    /** Returns if the title bar and the central widget are unified. */
-    bool isUnifiedTitleBarAndCentralWidget() const;
-
-    /** Returns the left *QGoodCentralWidget* title bar widget or nullptr if none is set. */
-    QWidget *leftTitleBarWidget() const;
-
-    /** Returns the right *QGoodCentralWidget* title bar widget or nullptr if none is set. */
-    QWidget *rightTitleBarWidget() const;
-
-    /** Returns the center *QGoodCentralWidget* title bar widget or nullptr if none is set. */
-    QWidget *centerTitleBarWidget() const;
-
-    /** Returns the *QGoodCentralWidget* central widget or nullptr if none is set. */
-    QWidget *centralWidget() const;
-
-    /** Returns the alignment of *QGoodCentralWidget* title on the title bar. */
-    Qt::Alignment titleAlignment() const;
-
-    /** Returns the *QGoodCentralWidget* title bar color. */
-    QColor titleBarColor() const;
-
-    /** Returns the *QGoodCentralWidget* border color. */
-    QColor activeBorderColor() const;
-
-    /** Returns if the *QGoodCentralWidget* title bar is visible or not. */
-    bool isTitleBarVisible() const;
-
-    /** Returns if the *QGoodCentralWidget* caption buttons are visible or not. */
-    bool isCaptionButtonsVisible() const;
-
-    /** Returns if the *QGoodCentralWidget* title bar title is visible or not. */
-    bool isTitleVisible() const;
-
-    /** Returns if the *QGoodCentralWidget* title bar icon is visible or not. */
-    bool isIconVisible() const;
-
-    /** Returns the customized icon width. */
-    int iconWidth() const;
-
-    /** Returns the *QGoodCentralWidget* title bar height. */
-    int titleBarHeight() const;
-
-    /** Returns the *QGoodCentralWidget* title bar caption button width. */
-    int captionButtonWidth() const;
-
-    /** Update the *QGoodCentralWidget* state, it's called internally
-        and must be called if changing *QGoodCentralWidget* metrics
-        like hide or show a title bar widget. */
-    void updateWindow();
-
-protected:
-    //\cond HIDDEN_SYMBOLS
-    //Functions
-    bool eventFilter(QObject *watched, QEvent *event);
-    bool event(QEvent *event);
-    //\endcond
-
-private:
-    //\cond HIDDEN_SYMBOLS
-    //Functions
-    void updateWindowLater();
-
-    //Variables
-    QPointer<QGoodWindow> m_gw;
-    QPointer<QWidget> m_central_widget_place_holder;
-    QPointer<QWidget> m_central_widget;
-#ifdef QGOODWINDOW
-    bool m_unified_title_bar_and_central_widget;
-    QRegion m_title_bar_mask;
-    bool m_left_widget_transparent_for_mouse;
-    bool m_right_widget_transparent_for_mouse;
-    bool m_center_widget_transparent_for_mouse;
-    int m_caption_button_width;
-    bool m_draw_borders;
-    QFrame *m_frame;
-    QString m_frame_style;
-    TitleBar *m_title_bar;
-    QPointer<QWidget> m_title_bar_left_widget;
-    QPointer<QWidget> m_title_bar_right_widget;
-    QPointer<QWidget> m_title_bar_center_widget;
-    QColor m_title_bar_color;
-    QColor m_active_border_color;
-    bool m_title_bar_visible;
-    bool m_caption_buttons_visible;
-    bool m_title_visible;
-    bool m_icon_visible;
-    int m_icon_width;
-#endif
-    //\endcond
-};
-
-#endif // QGOODCENTRALWIDGET_H
+/*
+The MIT License (MIT)
+
+Copyright © 2022-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef QGOODCENTRALWIDGET_H
+#define QGOODCENTRALWIDGET_H
+
+#include <QGoodWindow>
+
+#include "qgoodcentralwidget_global.h"
+
+#ifdef QGOODWINDOW
+class TitleBar;
+#endif
+
+/** **QGoodCentralWidget** class contains the public API's to control the behavior of **QGoodWindow**. */
+class QGOODWINDOW_SHARED_EXPORT QGoodCentralWidget : public QWidget
+{
+    Q_OBJECT
+public:
+    /** Constructor of *QGoodCentralWidget*, is mandatory pass a valid instance of the parent *QGoodWindow*. */
+    explicit QGoodCentralWidget(QGoodWindow *gw);
+    /** Destructor of *QGoodCentralWidget*. */
+    ~QGoodCentralWidget();
+
+    /** Utility for showing a modal *QDialog* with customized title bar and borders.
+        Pass the *QDialog* and the parent *QGoodWindow* and optionally a *QGoodCentralWidget* for mimic
+        it's colors on the new window. Optionally pass a left title bar widget,
+        a right title bar widget and set the visibility
+        of title and icon on the new window. */
+    static int execDialogWithWindow(QDialog *dialog, QGoodWindow *parent_gw,
+                                    QGoodCentralWidget *base_gcw = nullptr,
+                                    QWidget *left_title_bar_widget = nullptr,
+                                    QWidget *right_title_bar_widget = nullptr,
+                                    bool title_visible = true, bool icon_visible = true);
+
+    /** Utility for showing a *QDialog* with customized title bar and borders without blocking,
+        like *QDialog::open()* no nested event loop is started, the result is reported by
+        the *QDialog::finished()* signal, the dialog isn't deleted when its window closes.
+        Several dialogs can be open at once, \e modality choose if the dialog blocks
+        it's parent window, the whole application or nothing.
+        Returns false if the dialog couldn't be shown. */
+    static bool openDialogWithWindow(QDialog *dialog, QGoodWindow *parent_gw,
+                                     QGoodCentralWidget *base_gcw = nullptr,
+                                     QWidget *left_title_bar_widget = nullptr,
+                                     QWidget *right_title_bar_widget = nullptr,
+                                     bool title_visible = true, bool icon_visible = true,
+                                     Qt::WindowModality modality = Qt::WindowModal);
+
+    /** Keep \e count windows with parent \e parent_gw, each one with a *QGoodCentralWidget*,
+        built ahead during idle time, pass a null \e parent_gw for document windows.
+        The dialog utilities and *takePooledWindow()* use them, so a dialog window appears
+        in the next frame. Pass 0 to release the pool. On Windows closed windows aren't reused,
+        each one is replaced by a new window built during idle time. */
+    static void setWindowPoolSize(QGoodWindow *parent_gw, int count);
+
+    /** Returns a hidden window with parent \e parent_gw from the pool, or a new one if the pool is empty,
+        its central widget is a *QGoodCentralWidget*. When the window is closed the widgets set in the
+        *QGoodCentralWidget* are deleted, the window title, icon and title bar visibility are reset
+        and the window returns to the pool. */
+    static QGoodWindow *takePooledWindow(QGoodWindow *parent_gw = nullptr);
+
+public Q_SLOTS:
+    /** Set the title bar and the central widget unified. */
+    void setUnifiedTitleBarAndCentralWidget(bool unified);
+
+    /** Paint the title bar icon, title and caption buttons in a single widget,
+        only the left, right and center title bar widgets remain child widgets.
+        Reduces the widgets count and the layout and paint work of each window. */
+    void setSingleWidgetTitleBar(bool single_widget);
+
+    /** Compute the title bar, caption buttons and central widget geometries directly on each resize
+        instead of using nested layouts, the central widget fills the area below the title bar.
+        Best used together with single widget title bar. */
+    void setFlattenedGeometry(bool flattened);
+
+    /** While the system resizes the window, cover the central widget with a snapshot of its contents
+        anchored to the top left corner and lay out the real widget only a few times per second,
+        then lay it out exactly when the resize finishes. The title bar is laid out as usual.
+        The size constraints of the central widget still apply during the resize.
+        Useful for central widgets that are slow to lay out. Works on Windows and Linux. */
+    void setLiveResizeSnapshotEnabled(bool enabled);
+
+    /** Set the title bar mask, the title bar widgets masks united with this mask. */
+    void setTitleBarMask(const QRegion &mask);
+
+    /** Set the left title bar widget and returns the previous widget or nullptr if none, delete this widget as needed.
+        If the widget is transparent for mouse, but not it's children's set \e transparent_for_mouse to true. */
+    QWidget *setLeftTitleBarWidget(QWidget *widget, bool transparent_for_mouse = false);
+
+    /** Set the right title bar widget and returns the previous widget or nullptr if none, delete this widget as needed.
+        If the widget is transparent for mouse, but not it's children's set \e transparent_for_mouse to true. */
+    QWidget *setRightTitleBarWidget(QWidget *widget, bool transparent_for_mouse = false);
+
+    /** Set the center title bar widget and returns the previous widget or nullptr if none, delete this widget as needed.
+        If the widget is transparent for mouse, but not it's children's set \e transparent_for_mouse to true. */
+    QWidget *setCenterTitleBarWidget(QWidget *widget, bool transparent_for_mouse = false);
+
+    /** Set the central widget of *QGoodCentralWidget*. */
+    void setCentralWidget(QWidget *widget);
+
+    /** Set the alignment of *QGoodCentralWidget* title on the title bar.
+        Note: If align to center and also set a central title bar widget
+        the title will be aligned to the left.*/
+    void setTitleAlignment(const Qt::Alignment &alignment);
+
+    /** Set the color of *QGoodCentralWidget* title bar. */
+    void setTitleBarColor(const QColor &color);
+
+    /** Set the color of *QGoodCentralWidget* border. */
+    void setActiveBorderColor(const QColor &color);
+
+    /** Change the visibility of *QGoodCentralWidget* title bar. */
+    void setTitleBarVisible(bool visible);
+
+    /** Change the visibility of *QGoodCentralWidget* caption buttons. */
+    void setCaptionButtonsVisible(bool visible);
+
+    /** Change the visibility of *QGoodCentralWidget* title bar title. */
+    void setTitleVisible(bool visible);
+
+    /** Change the visibility of *QGoodCentralWidget* title bar icon. */
+    void setIconVisible(bool visible);
+
+    /** Change the width of *QGoodCentralWidget* title bar icon,
+     * width higher than 0 will hide the *QGoodCentralWidget* provided icon,
+     * this is useful when showing own icons. */
+    void setIconWidth(int width);
+
+    /** Change the title bar height to \e height multiplied to current pixel ratio. */
+    void setTitleBarHeight(int height);
+
+    /** Change the caption button width to \e width multiplied to current pixel ratio. */
+    void setCaptionButtonWidth(int width);
+
+    /** Returns if the title bar and the central widget are unified. */
+    bool isUnifiedTitleBarAndCentralWidget() const;
+
+    /** Returns if the title bar icon, title and caption buttons are painted in a single widget. */
+    bool isSingleWidgetTitleBar() const;
+
+    /** Returns if the geometries are computed directly instead of using layouts. */
+    bool isFlattenedGeometry() const;
+
+    /** Returns if the central widget is replaced by a snapshot while the window is resized by the system. */
+    bool isLiveResizeSnapshotEnabled() const;
+
+    /** Returns the left *QGoodCentralWidget* title bar widget or nullptr if none is set. */
+    QWidget *leftTitleBarWidget() const;
+
+    /** Returns the right *QGoodCentralWidget* title bar widget or nullptr if none is set. */
+    QWidget *rightTitleBarWidget() const;
+
+    /** Returns the center *QGoodCentralWidget* title bar widget or nullptr if none is set. */
+    QWidget *centerTitleBarWidget() const;
+
+    /** Returns the *QGoodCentralWidget* central widget or nullptr if none is set. */
+    QWidget *centralWidget() const;
+
+    /** Returns the alignment of *QGoodCentralWidget* title on the title bar. */
+    Qt::Alignment titleAlignment() const;
+
+    /** Returns the *QGoodCentralWidget* title bar color. */
+    QColor titleBarColor() const;
+
+    /** Returns the *QGoodCentralWidget* border color. */
+    QColor activeBorderColor() const;
+
+    /** Returns if the *QGoodCentralWidget* title bar is visible or not. */
+    bool isTitleBarVisible() const;
+
+    /** Returns if the *QGoodCentralWidget* caption buttons are visible or not. */
+    bool isCaptionButtonsVisible() const;
+
+    /** Returns if the *QGoodCentralWidget* title bar title is visible or not. */
+    bool isTitleVisible() const;
+
+    /** Returns if the *QGoodCentralWidget* title bar icon is visible or not. */
+    bool isIconVisible() const;
+
+    /** Returns the customized icon width. */
+    int iconWidth() const;
+
+    /** Returns the *QGoodCentralWidget* title bar height. */
+    int titleBarHeight() const;
+
+    /** Returns the *QGoodCentralWidget* title bar caption button width. */
+    int captionButtonWidth() const;
+
+    /** Update the *QGoodCentralWidget* state, it's called internally
+        and must be called if changing *QGoodCentralWidget* metrics
+        like hide or show a title bar widget. */
+    void updateWindow();
+
+protected:
+    //\cond HIDDEN_SYMBOLS
+    //Functions
+    bool eventFilter(QObject *watched, QEvent *event);
+    bool event(QEvent *event);
+    QSize sizeHint() const;
+    QSize minimumSizeHint() const;
+    //\endcond
+
+private:
+    //\cond HIDDEN_SYMBOLS
+    friend class WindowPool;
+
+    enum UpdateFlag
+    {
+        UpdateBorderStyle = 0x1,
+        UpdateMasks = 0x2,
+        UpdateCaptionButtonRects = 0x4,
+        UpdateActiveState = 0x8,
+        UpdateAll = UpdateBorderStyle | UpdateMasks | UpdateCaptionButtonRects | UpdateActiveState
+    };
+
+    //Functions
+#ifdef QGOODWINDOW
+    static QGoodWindow *createDialogWindow(QDialog *dialog, QGoodWindow *parent_gw,
+                                           QGoodCentralWidget *base_gcw,
+                                           QWidget *left_title_bar_widget,
+                                           QWidget *right_title_bar_widget,
+                                           bool title_visible, bool icon_visible);
+#endif
+    void setupLayouts();
+    void updateFlattenedGeometry();
+    QSize flattenedSizeHint(const QSize &central_widget_size) const;
+    void startLiveResizeSnapshot();
+    void updateLiveResizeSnapshot();
+    void finishLiveResizeSnapshot();
+    void connectTitleBar();
+    void scheduleUpdate(int flags);
+    void updateWindowLater();
+
+    //Variables
+    QPointer<QGoodWindow> m_gw;
+    QPointer<QWidget> m_central_widget_place_holder;
+    QPointer<QWidget> m_central_widget;
+#ifdef QGOODWINDOW
+    bool m_unified_title_bar_and_central_widget;
+    QRegion m_title_bar_mask;
+    bool m_left_widget_transparent_for_mouse;
+    bool m_right_widget_transparent_for_mouse;
+    bool m_center_widget_transparent_for_mouse;
+    int m_caption_button_width;
+    bool m_draw_borders;
+    QFrame *m_frame;
+    QString m_frame_style;
+    TitleBar *m_title_bar;
+    QPointer<QWidget> m_title_bar_left_widget;
+    QPointer<QWidget> m_title_bar_right_widget;
+    QPointer<QWidget> m_title_bar_center_widget;
+    QColor m_title_bar_color;
+    QColor m_active_border_color;
+    bool m_title_bar_visible;
+    bool m_caption_buttons_visible;
+    bool m_title_visible;
+    bool m_icon_visible;
+    int m_icon_width;
+    int m_update_flags;
+    bool m_update_pending;
+    bool m_flattened_geometry;
+    bool m_live_resize_snapshot_enabled;
+    QPointer<QLabel> m_live_resize_snapshot;
+    QPointer<QWidget> m_live_resize_stand_in;
+    QTimer *m_live_resize_timer;
+    QIcon m_window_icon;
+    bool m_icon_update_pending;
+#endif
+    //\endcond
+};
+
+#endif // QGOODCENTRALWIDGET_H
@@ -1,627 +1,1376 @@
-/*
-The MIT License (MIT)
-
-Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#include "titlebar.h"
-
-TitleBar::TitleBar(QGoodWindow *gw, QWidget *parent) : QFrame(parent)
-{
-    m_layout_spacing = 0;
-
-    // Get Layout Spacing
-    {
-        QString old_style;
-
-        if (!qApp->style()->objectName().startsWith("fusion"))
-        {
-            old_style = qApp->style()->objectName();
-            qApp->setStyle(QStyleFactory::create("fusion"));
-        }
-
-        QWidget widget;
-
-        QHBoxLayout *layout = new QHBoxLayout(&widget);
-
-        m_layout_spacing = layout->spacing();
-
-        if (!old_style.isEmpty())
-        {
-            qApp->setStyle(QStyleFactory::create(old_style));
-        }
-    }
-
-    m_gw = gw;
-
-    m_style = QString("TitleBar {background-color: %0;}");
-
-    connect(qGoodStateHolder, &QGoodStateHolder::currentThemeChanged, this, &TitleBar::setTheme);
-
-    setFixedHeight(29);
-
-    m_left_margin_widget_place_holder = new QWidget(this);
-    m_left_margin_widget_place_holder->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
-
-    m_icon_widget = new IconWidget(this);
-    m_icon_widget->setFixedWidth(29);
-
-    m_title_widget = new TitleWidget(this, this);
-
-    m_caption_buttons = new QWidget(this);
-    m_caption_buttons->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
-
-    m_min_btn = new CaptionButton(CaptionButton::IconType::Minimize, m_caption_buttons);
-
-    m_restore_btn = new CaptionButton(CaptionButton::IconType::Restore, m_caption_buttons);
-
-    m_max_btn = new CaptionButton(CaptionButton::IconType::Maximize, m_caption_buttons);
-
-    m_cls_btn = new CaptionButton(CaptionButton::IconType::Close, m_caption_buttons);
-
-    connect(m_min_btn, &CaptionButton::clicked, this, &TitleBar::showMinimized);
-    connect(m_restore_btn, &CaptionButton::clicked, this, &TitleBar::showNormal);
-    connect(m_max_btn, &CaptionButton::clicked, this, &TitleBar::showMaximized);
-    connect(m_cls_btn, &CaptionButton::clicked, this, &TitleBar::closeWindow);
-
-    QHBoxLayout *hlayout = new QHBoxLayout(m_caption_buttons);
-    hlayout->setContentsMargins(0, 0, 0, 0);
-    hlayout->setSpacing(0);
-
-    hlayout->addWidget(m_min_btn);
-    hlayout->addWidget(m_restore_btn);
-    hlayout->addWidget(m_max_btn);
-    hlayout->addWidget(m_cls_btn);
-
-    m_caption_buttons->adjustSize();
-
-    QStackedLayout *stacked_layout = new QStackedLayout(this);
-    stacked_layout->setStackingMode(QStackedLayout::StackAll);
-
-    QWidget *widget = new QWidget(this);
-
-    QHBoxLayout *layout = new QHBoxLayout(widget);
-    layout->setContentsMargins(0, 0, 0, 0);
-    layout->setSpacing(0);
-
-    stacked_layout->addWidget(widget);
-    stacked_layout->addWidget(m_title_widget);
-
-    m_left_widget_place_holder = new QWidget(this);
-    m_left_widget_place_holder->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
-    m_left_widget_place_holder->setVisible(false);
-    m_left_widget_place_holder->setEnabled(false);
-
-    m_right_widget_place_holder = new QWidget(this);
-    m_right_widget_place_holder->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
-    m_right_widget_place_holder->setVisible(false);
-    m_right_widget_place_holder->setEnabled(false);
-
-    m_center_widget_place_holder = new QWidget(this);
-    m_center_widget_place_holder->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
-    m_center_widget_place_holder->setVisible(false);
-    m_center_widget_place_holder->setEnabled(false);
-
-    m_center_spacer_item_left = new QSpacerItem(0, 0);
-    m_center_spacer_item_right = new QSpacerItem(0, 0);
-
-    layout->addWidget(m_left_margin_widget_place_holder);
-    layout->addWidget(m_icon_widget);
-    layout->addWidget(m_left_widget_place_holder);
-    layout->addStretch();
-    layout->addSpacerItem(m_center_spacer_item_left);
-    layout->addWidget(m_center_widget_place_holder);
-    layout->addSpacerItem(m_center_spacer_item_right);
-    layout->addStretch();
-    layout->addWidget(m_right_widget_place_holder);
-    layout->addWidget(m_caption_buttons);
-
-    QTimer::singleShot(0, this, [=]{
-        //All caption button starts in hidden state,
-        //showing them as needed.
-
-        if (isMinimizedButtonEnabled())
-        {
-            m_min_btn->setVisible(true);
-        }
-
-        if (isMaximizeButtonEnabled())
-        {
-            if (!isMaximized())
-                m_max_btn->setVisible(true);
-            else
-                m_restore_btn->setVisible(true);
-        }
-
-        m_cls_btn->setVisible(true);
-
-        m_caption_buttons->adjustSize();
-    });
-
-    m_active = true;
-
-    m_is_maximized = false;
-
-    setTheme();
-}
-
-void TitleBar::setTitle(const QString &title)
-{
-    m_title_widget->setText(title);
-}
-
-void TitleBar::setIcon(const QPixmap &icon)
-{
-    m_icon_widget->setPixmap(icon);
-}
-
-void TitleBar::setActive(bool active)
-{
-    m_active = active;
-
-    m_icon_widget->setActive(active);
-    m_title_widget->setActive(active);
-    m_min_btn->setActive(active);
-    m_restore_btn->setActive(active);
-    m_max_btn->setActive(active);
-    m_cls_btn->setActive(active);
-}
-
-void TitleBar::setTitleAlignment(const Qt::Alignment &alignment)
-{
-    m_title_widget->setTitleAlignment(alignment);
-}
-
-void TitleBar::setMaximized(bool maximized)
-{
-    m_is_maximized = maximized;
-
-    if (!isMaximizeButtonEnabled())
-        return;
-
-    if (maximized)
-    {
-        m_max_btn->setVisible(false);
-        m_restore_btn->setVisible(true);
-    }
-    else
-    {
-        m_restore_btn->setVisible(false);
-        m_max_btn->setVisible(true);
-    }
-
-    m_caption_buttons->adjustSize();
-}
-
-void TitleBar::setTheme()
-{
-    bool dark = qGoodStateHolder->isCurrentThemeDark();
-
-    setAttribute(Qt::WA_TranslucentBackground, false);
-
-    if (dark)
-    {
-        QTimer::singleShot(0, this, [=]{
-            if (m_title_bar_color == QColor(Qt::transparent))
-                setAttribute(Qt::WA_TranslucentBackground, true);
-            else if (m_title_bar_color.isValid())
-                setStyleSheet(m_style.arg(m_title_bar_color.name()));
-            else if (qApp->style()->objectName().startsWith("fusion"))
-                setStyleSheet(m_style.arg(qApp->palette().base().color().name()));
-            else
-                setStyleSheet(m_style.arg("#000000"));
-        });
-
-        //Light mode to contrast
-        m_min_btn->setIconMode(false);
-        m_max_btn->setIconMode(false);
-        m_restore_btn->setIconMode(false);
-        m_cls_btn->setIconMode(false);
-
-        m_title_widget->setTitleColor(QColor(255, 255, 255), QColor(150, 150, 150));
-
-        setActive(m_active);
-    }
-    else
-    {
-        QTimer::singleShot(0, this, [=]{
-            if (m_title_bar_color == QColor(Qt::transparent))
-                setAttribute(Qt::WA_TranslucentBackground, true);
-            else if (m_title_bar_color.isValid())
-                setStyleSheet(m_style.arg(m_title_bar_color.name()));
-            else if (qApp->style()->objectName().startsWith("fusion"))
-                setStyleSheet(m_style.arg(qApp->palette().base().color().name()));
-            else
-                setStyleSheet(m_style.arg("#FFFFFF"));
-        });
-
-        //Dark mode to contrast
-        m_min_btn->setIconMode(true);
-        m_max_btn->setIconMode(true);
-        m_restore_btn->setIconMode(true);
-        m_cls_btn->setIconMode(true);
-
-        m_title_widget->setTitleColor(QColor(0, 0, 0), QColor(150, 150, 150));
-
-        setActive(m_active);
-    }
-}
-
-void TitleBar::setLeftTitleBarWidget(QWidget *widget)
-{
-    if (m_left_widget_place_holder->layout())
-        delete m_left_widget_place_holder->layout();
-
-    m_left_widget = widget;
-
-    if (m_left_widget)
-    {
-        QGridLayout *layout = new QGridLayout(m_left_widget_place_holder);
-        layout->setContentsMargins(0, 0, m_layout_spacing, 0);
-        layout->setSpacing(0);
-        layout->addWidget(m_left_widget);
-
-        m_left_widget_place_holder->setVisible(true);
-        m_left_widget_place_holder->setEnabled(true);
-    }
-    else
-    {
-        m_left_widget_place_holder->setVisible(false);
-        m_left_widget_place_holder->setEnabled(false);
-    }
-}
-
-void TitleBar::setRightTitleBarWidget(QWidget *widget)
-{
-    if (m_right_widget_place_holder->layout())
-        delete m_right_widget_place_holder->layout();
-
-    m_right_widget = widget;
-
-    if (m_right_widget)
-    {
-        QGridLayout *layout = new QGridLayout(m_right_widget_place_holder);
-        layout->setContentsMargins(0, 0, m_layout_spacing, 0);
-        layout->setSpacing(0);
-        layout->addWidget(m_right_widget);
-
-        m_right_widget_place_holder->setVisible(true);
-        m_right_widget_place_holder->setEnabled(true);
-    }
-    else
-    {
-        m_right_widget_place_holder->setVisible(false);
-        m_right_widget_place_holder->setEnabled(false);
-    }
-}
-
-void TitleBar::setCenterTitleBarWidget(QWidget *widget)
-{
-    if (m_center_widget_place_holder->layout())
-        delete m_center_widget_place_holder->layout();
-
-    m_center_widget = widget;
-
-    if (m_center_widget)
-    {
-        QGridLayout *layout = new QGridLayout(m_center_widget_place_holder);
-        layout->setContentsMargins(0, 0, m_layout_spacing, 0);
-        layout->setSpacing(0);
-        layout->addWidget(m_center_widget);
-
-        m_center_widget_place_holder->setVisible(true);
-        m_center_widget_place_holder->setEnabled(true);
-    }
-    else
-    {
-        m_center_widget_place_holder->setVisible(false);
-        m_center_widget_place_holder->setEnabled(false);
-    }
-}
-
-void TitleBar::setCaptionButtonWidth(int width)
-{
-    m_min_btn->setFixedSize(width, height());
-    m_restore_btn->setFixedSize(width, height());
-    m_max_btn->setFixedSize(width, height());
-    m_cls_btn->setFixedSize(width, height());
-
-    m_caption_buttons->adjustSize();
-}
-
-Qt::Alignment TitleBar::titleAlignment()
-{
-    return m_title_widget->titleAlignment();
-}
-
-int TitleBar::captionButtonsWidth()
-{
-    return m_caption_buttons->width();
-}
-
-int TitleBar::leftWidth()
-{
-    QRect rect;
-
-    rect = rect.united(m_icon_widget->geometry());
-
-    rect = rect.united(m_left_widget_place_holder->geometry());
-
-    return rect.width();
-}
-
-int TitleBar::rightWidth()
-{
-    QRect rect;
-
-    rect = rect.united(m_caption_buttons->geometry());
-
-    rect = rect.united(m_right_widget_place_holder->geometry());
-
-    int width = rect.width() + layoutSpacing();
-
-    return width;
-}
-
-int TitleBar::layoutSpacing()
-{
-    return m_layout_spacing;
-}
-
-bool TitleBar::isMinimizedButtonEnabled()
-{
-    if (!m_gw)
-        return false;
-
-    return (m_gw->windowFlags() & Qt::WindowMinimizeButtonHint);
-}
-
-bool TitleBar::isMaximizeButtonEnabled()
-{
-    if (!m_gw)
-        return false;
-
-    return (m_gw->windowFlags() & Qt::WindowMaximizeButtonHint);
-}
-
-bool TitleBar::isCloseButtonEnabled()
-{
-    if (!m_gw)
-        return false;
-
-    return (m_gw->windowFlags() & Qt::WindowCloseButtonHint);
-}
-
-QRect TitleBar::minimizeButtonRect()
-{
-    if (m_min_btn->isVisible())
-        return m_min_btn->geometry();
-
-    return QRect();
-}
-
-QRect TitleBar::maximizeButtonRect()
-{
-    if (m_max_btn->isVisible())
-        return m_max_btn->geometry();
-    if (m_restore_btn->isVisible())
-        return m_restore_btn->geometry();
-
-    return QRect();
-}
-
-QRect TitleBar::closeButtonRect()
-{
-    if (m_cls_btn->isVisible())
-        return m_cls_btn->geometry();
-
-    return QRect();
-}
-
-void TitleBar::updateWindow()
-{
-    int left_width = leftWidth();
-
-    int right_width = rightWidth();
-
-    int distance = right_width - left_width;
-
-    int left_distance = 0;
-
-    int right_distance = 0;
-
-    if (distance > 0)
-        left_distance = qAbs(distance);
-    else
-        right_distance = qAbs(distance);
-
-    m_center_spacer_item_left->changeSize(left_distance, 0, QSizePolicy::Preferred, QSizePolicy::Expanding);
-
-    m_center_spacer_item_right->changeSize(right_distance, 0, QSizePolicy::Preferred, QSizePolicy::Expanding);
-}
-
-void TitleBar::captionButtonStateChanged(const QGoodWindow::CaptionButtonState &state)
-{
-    if (!m_caption_buttons->isVisible())
-        return;
-
-    switch (state)
-    {
-        // Hover enter
-    case QGoodWindow::CaptionButtonState::MinimizeHoverEnter:
-    {
-        m_min_btn->setState(QEvent::HoverEnter);
-
-        break;
-    }
-    case QGoodWindow::CaptionButtonState::MaximizeHoverEnter:
-    {
-        if (!m_is_maximized)
-            m_max_btn->setState(QEvent::HoverEnter);
-        else
-            m_restore_btn->setState(QEvent::HoverEnter);
-
-        break;
-    }
-    case QGoodWindow::CaptionButtonState::CloseHoverEnter:
-    {
-        m_cls_btn->setState(QEvent::HoverEnter);
-
-        break;
-    }
-        // Hover leave
-    case QGoodWindow::CaptionButtonState::MinimizeHoverLeave:
-    {
-        m_min_btn->setState(QEvent::HoverLeave);
-
-        break;
-    }
-    case QGoodWindow::CaptionButtonState::MaximizeHoverLeave:
-    {
-        if (!m_is_maximized)
-            m_max_btn->setState(QEvent::HoverLeave);
-        else
-            m_restore_btn->setState(QEvent::HoverLeave);
-
-        break;
-    }
-    case QGoodWindow::CaptionButtonState::CloseHoverLeave:
-    {
-        m_cls_btn->setState(QEvent::HoverLeave);
-
-        break;
-    }
-        // Mouse button press
-    case QGoodWindow::CaptionButtonState::MinimizePress:
-    {
-        m_min_btn->setState(QEvent::MouseButtonPress);
-
-        break;
-    }
-    case QGoodWindow::CaptionButtonState::MaximizePress:
-    {
-        if (!m_is_maximized)
-            m_max_btn->setState(QEvent::MouseButtonPress);
-        else
-            m_restore_btn->setState(QEvent::MouseButtonPress);
-
-        break;
-    }
-    case QGoodWindow::CaptionButtonState::ClosePress:
-    {
-        m_cls_btn->setState(QEvent::MouseButtonPress);
-
-        break;
-    }
-        // Mouse button release
-    case QGoodWindow::CaptionButtonState::MinimizeRelease:
-    {
-        m_min_btn->setState(QEvent::MouseButtonRelease);
-
-        break;
-    }
-    case QGoodWindow::CaptionButtonState::MaximizeRelease:
-    {
-        if (!m_is_maximized)
-            m_max_btn->setState(QEvent::MouseButtonRelease);
-        else
-            m_restore_btn->setState(QEvent::MouseButtonRelease);
-
-        break;
-    }
-    case QGoodWindow::CaptionButtonState::CloseRelease:
-    {
-        m_cls_btn->setState(QEvent::MouseButtonRelease);
-
-        break;
-    }
-        // Mouse button clicked
-    case QGoodWindow::CaptionButtonState::MinimizeClicked:
-    {
-        Q_EMIT m_min_btn->clicked();
-
-        break;
-    }
-    case QGoodWindow::CaptionButtonState::MaximizeClicked:
-    {
-        if (!m_is_maximized)
-            Q_EMIT m_max_btn->clicked();
-        else
-            Q_EMIT m_restore_btn->clicked();
-
-        break;
-    }
-    case QGoodWindow::CaptionButtonState::CloseClicked:
-    {
-        Q_EMIT m_cls_btn->clicked();
-
-        break;
-    }
-    default:
-        break;
-    }
-}
-
-bool TitleBar::event(QEvent *event)
-{
-#ifdef QGOODWINDOW
-#ifdef Q_OS_LINUX
-    switch (event->type())
-    {
-    case QEvent::Resize:
-    {
-        QRegion mask;
-
-        if (m_gw->windowState().testFlag(Qt::WindowNoState))
-        {
-            const int radius = 8;
-
-            QBitmap bmp(size());
-            bmp.clear();
-
-            QPainter painter;
-            painter.begin(&bmp);
-            painter.setRenderHints(QPainter::Antialiasing);
-            painter.setPen(Qt::color1);
-            painter.setBrush(Qt::color1);
-            QPainterPath path;
-            path.setFillRule(Qt::WindingFill);
-            path.addRoundedRect(rect(), radius, radius);
-            path.addRect(rect().adjusted(0, height() - radius, radius, radius));
-            path.addRect(rect().adjusted(width() - radius, height() - radius, radius, radius));
-            painter.drawPath(path.simplified());
-            painter.end();
-
-            mask = bmp;
-        }
-
-        setMask(mask);
-
-        break;
-    }
-    default:
-        break;
-    }
-#endif
-#endif
-
-    return QWidget::event(event);
-}
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "titlebar.h"
+
+#define ICONWIDTH 16
+#define ICONHEIGHT 16
+
+TitleBar::TitleBar(QGoodWindow *gw, bool single_widget, QWidget *parent) : QFrame(parent)
+{
+    m_layout_spacing = 0;
+
+    // Get Layout Spacing
+    {
+        QString old_style;
+
+        if (!qApp->style()->objectName().startsWith("fusion"))
+        {
+            old_style = qApp->style()->objectName();
+            qApp->setStyle(QStyleFactory::create("fusion"));
+        }
+
+        QWidget widget;
+
+        QHBoxLayout *layout = new QHBoxLayout(&widget);
+
+        m_layout_spacing = layout->spacing();
+
+        if (!old_style.isEmpty())
+        {
+            qApp->setStyle(QStyleFactory::create(old_style));
+        }
+    }
+
+    m_gw = gw;
+
+    m_single_widget = single_widget;
+
+    m_style = QString("TitleBar {background-color: %0;}");
+
+    connect(qGoodStateHolder, &QGoodStateHolder::currentThemeChanged, this, &TitleBar::setTheme);
+
+    setFixedHeight(29);
+
+    m_left_margin_widget_place_holder = nullptr;
+    m_icon_widget = nullptr;
+    m_title_widget = nullptr;
+    m_caption_buttons = nullptr;
+    m_min_btn = nullptr;
+    m_restore_btn = nullptr;
+    m_max_btn = nullptr;
+    m_cls_btn = nullptr;
+    m_layout = nullptr;
+    m_stacked_layout = nullptr;
+    m_center_spacer_item_left = nullptr;
+    m_center_spacer_item_right = nullptr;
+
+    m_min_renderer = nullptr;
+    m_restore_renderer = nullptr;
+    m_max_renderer = nullptr;
+    m_cls_renderer = nullptr;
+
+    m_alignment = Qt::AlignLeft;
+    m_caption_button_width = 0;
+    m_caption_buttons_visible = true;
+    m_title_visible = true;
+    m_icon_visible = true;
+    m_icon_dark = false;
+
+    m_active = true;
+
+    m_is_maximized = false;
+
+    if (!m_single_widget)
+        setupWidgets();
+
+    setTheme();
+}
+
+TitleBar::~TitleBar()
+{
+    delete m_min_renderer;
+    delete m_restore_renderer;
+    delete m_max_renderer;
+    delete m_cls_renderer;
+}
+
+void TitleBar::setupWidgets()
+{
+    //Only the layout skeleton is built here, the icon, title, caption buttons
+    //and place holders are created on first use, see createWidgets().
+
+    m_stacked_layout = new QStackedLayout(this);
+    m_stacked_layout->setStackingMode(QStackedLayout::StackAll);
+
+    QWidget *widget = new QWidget(this);
+
+    m_layout = new QHBoxLayout(widget);
+    m_layout->setContentsMargins(0, 0, 0, 0);
+    m_layout->setSpacing(0);
+
+    m_stacked_layout->addWidget(widget);
+
+    m_center_spacer_item_left = new QSpacerItem(0, 0);
+    m_center_spacer_item_right = new QSpacerItem(0, 0);
+
+    m_layout->addStretch();
+    m_layout->addSpacerItem(m_center_spacer_item_left);
+    m_layout->addSpacerItem(m_center_spacer_item_right);
+    m_layout->addStretch();
+}
+
+void TitleBar::createWidgets()
+{
+    //Called when the title bar is polished and on visibility changes afterwards,
+    //hidden sub components are never created.
+
+    if (m_single_widget || !testAttribute(Qt::WA_WState_Polished))
+        return;
+
+    if (m_icon_visible)
+        iconWidget();
+
+    if (m_title_visible)
+        titleWidget();
+
+    if (m_caption_buttons_visible)
+        captionButtons();
+}
+
+void TitleBar::insertLayoutWidget(QWidget *widget)
+{
+    //The stretches and center spacers always exist, the widgets are inserted
+    //in their place when created, keeping the order of the layout.
+
+    QWidget *left_widgets[] = {m_left_margin_widget_place_holder, m_icon_widget, m_left_widget_place_holder};
+    QWidget *right_widgets[] = {m_right_widget_place_holder, m_caption_buttons};
+
+    int index = 0;
+
+    for (QWidget *current_widget : left_widgets)
+    {
+        if (current_widget == widget)
+        {
+            m_layout->insertWidget(index, widget);
+            return;
+        }
+
+        if (current_widget)
+            index++;
+    }
+
+    //Stretch and left center spacer.
+    index += 2;
+
+    if (m_center_widget_place_holder == widget)
+    {
+        m_layout->insertWidget(index, widget);
+        return;
+    }
+
+    if (m_center_widget_place_holder)
+        index++;
+
+    //Right center spacer and stretch.
+    index += 2;
+
+    for (QWidget *current_widget : right_widgets)
+    {
+        if (current_widget == widget)
+        {
+            m_layout->insertWidget(index, widget);
+            return;
+        }
+
+        if (current_widget)
+            index++;
+    }
+}
+
+QWidget *TitleBar::leftMarginWidgetPlaceHolder()
+{
+    if (!m_left_margin_widget_place_holder)
+    {
+        m_left_margin_widget_place_holder = new QWidget(this);
+        m_left_margin_widget_place_holder->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
+
+        insertLayoutWidget(m_left_margin_widget_place_holder);
+    }
+
+    return m_left_margin_widget_place_holder;
+}
+
+IconWidget *TitleBar::iconWidget()
+{
+    if (!m_icon_widget)
+    {
+        m_icon_widget = new IconWidget(this);
+        m_icon_widget->setFixedWidth(29);
+        m_icon_widget->setIcon(m_icon);
+        m_icon_widget->setActive(m_active);
+        m_icon_widget->setVisible(m_icon_visible);
+        m_icon_widget->setEnabled(m_icon_visible);
+
+        insertLayoutWidget(m_icon_widget);
+    }
+
+    return m_icon_widget;
+}
+
+TitleWidget *TitleBar::titleWidget()
+{
+    if (!m_title_widget)
+    {
+        m_title_widget = new TitleWidget(this, this);
+        m_title_widget->setText(m_title);
+        m_title_widget->setTitleAlignment(m_alignment);
+        m_title_widget->setTitleColor(m_title_active_color, m_title_inactive_color);
+        m_title_widget->setActive(m_active);
+        m_title_widget->setVisible(m_title_visible);
+        m_title_widget->setEnabled(m_title_visible);
+
+        m_stacked_layout->addWidget(m_title_widget);
+    }
+
+    return m_title_widget;
+}
+
+QWidget *TitleBar::captionButtons()
+{
+    if (!m_caption_buttons)
+    {
+        m_caption_buttons = new QWidget(this);
+        m_caption_buttons->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
+
+        m_min_btn = new CaptionButton(CaptionButton::IconType::Minimize, m_caption_buttons);
+
+        m_restore_btn = new CaptionButton(CaptionButton::IconType::Restore, m_caption_buttons);
+
+        m_max_btn = new CaptionButton(CaptionButton::IconType::Maximize, m_caption_buttons);
+
+        m_cls_btn = new CaptionButton(CaptionButton::IconType::Close, m_caption_buttons);
+
+        connect(m_min_btn, &CaptionButton::clicked, this, &TitleBar::showMinimized);
+        connect(m_restore_btn, &CaptionButton::clicked, this, &TitleBar::showNormal);
+        connect(m_max_btn, &CaptionButton::clicked, this, &TitleBar::showMaximized);
+        connect(m_cls_btn, &CaptionButton::clicked, this, &TitleBar::closeWindow);
+
+        QHBoxLayout *hlayout = new QHBoxLayout(m_caption_buttons);
+        hlayout->setContentsMargins(0, 0, 0, 0);
+        hlayout->setSpacing(0);
+
+        for (CaptionButton *button : {m_min_btn, m_restore_btn, m_max_btn, m_cls_btn})
+        {
+            button->setIconMode(m_icon_dark);
+            button->setActive(m_active);
+            button->setFixedSize(m_caption_button_width, height());
+
+            hlayout->addWidget(button);
+        }
+
+        //All caption button starts in hidden state,
+        //showing them as needed.
+
+        if (isMinimizedButtonEnabled())
+        {
+            m_min_btn->setVisible(true);
+        }
+
+        if (isMaximizeButtonEnabled())
+        {
+            if (!m_is_maximized)
+                m_max_btn->setVisible(true);
+            else
+                m_restore_btn->setVisible(true);
+        }
+
+        m_cls_btn->setVisible(true);
+
+        m_caption_buttons->setVisible(m_caption_buttons_visible);
+        m_caption_buttons->setEnabled(m_caption_buttons_visible);
+
+        m_caption_buttons->adjustSize();
+
+        insertLayoutWidget(m_caption_buttons);
+    }
+
+    return m_caption_buttons;
+}
+
+QWidget *TitleBar::titleBarWidgetPlaceHolder(QPointer<QWidget> *widget_place_holder)
+{
+    if (!*widget_place_holder)
+    {
+        QWidget *place_holder = new QWidget(this);
+        place_holder->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
+        place_holder->setVisible(false);
+        place_holder->setEnabled(false);
+
+        *widget_place_holder = place_holder;
+
+        insertLayoutWidget(place_holder);
+    }
+
+    return *widget_place_holder;
+}
+
+void TitleBar::setTitle(const QString &title)
+{
+    if (m_title == title)
+        return;
+
+    m_title = title;
+
+    if (!m_single_widget)
+    {
+        if (m_title_widget)
+            m_title_widget->setText(title);
+
+        return;
+    }
+
+    if (m_title_visible)
+        update(titleArea());
+}
+
+void TitleBar::setIcon(const QIcon &icon)
+{
+    if (m_icon.cacheKey() == icon.cacheKey())
+        return;
+
+    m_icon = icon;
+
+    if (!m_single_widget)
+    {
+        if (m_icon_widget)
+            m_icon_widget->setIcon(icon);
+
+        return;
+    }
+
+    if (m_icon_visible)
+        update(m_icon_rect);
+}
+
+void TitleBar::setActive(bool active)
+{
+    const bool changed = (m_active != active);
+
+    m_active = active;
+
+    if (!m_single_widget)
+    {
+        if (m_icon_widget)
+            m_icon_widget->setActive(active);
+
+        if (m_title_widget)
+            m_title_widget->setActive(active);
+
+        if (m_caption_buttons)
+        {
+            m_min_btn->setActive(active);
+            m_restore_btn->setActive(active);
+            m_max_btn->setActive(active);
+            m_cls_btn->setActive(active);
+        }
+
+        return;
+    }
+
+    for (CaptionButtonRenderer *renderer : {m_min_renderer, m_restore_renderer, m_max_renderer, m_cls_renderer})
+    {
+        if (renderer)
+            renderer->setActive(active);
+    }
+
+    if (changed)
+        update();
+}
+
+void TitleBar::setTitleAlignment(const Qt::Alignment &alignment)
+{
+    switch (alignment)
+    {
+    case Qt::AlignLeft:
+    case Qt::AlignCenter:
+    case Qt::AlignRight:
+    {
+        m_alignment = alignment;
+        break;
+    }
+    default:
+    {
+        m_alignment = Qt::AlignLeft;
+        break;
+    }
+    }
+
+    if (!m_single_widget)
+    {
+        if (m_title_widget)
+            m_title_widget->setTitleAlignment(m_alignment);
+
+        return;
+    }
+
+    if (m_title_visible)
+        update(titleArea());
+}
+
+void TitleBar::setMaximized(bool maximized)
+{
+    if (m_is_maximized == maximized)
+        return;
+
+    m_is_maximized = maximized;
+
+    if (!isMaximizeButtonEnabled())
+        return;
+
+    if (m_single_widget)
+    {
+        update(m_max_rect);
+        return;
+    }
+
+    if (!m_caption_buttons)
+        return;
+
+    if (maximized)
+    {
+        m_max_btn->setVisible(false);
+        m_restore_btn->setVisible(true);
+    }
+    else
+    {
+        m_restore_btn->setVisible(false);
+        m_max_btn->setVisible(true);
+    }
+
+    m_caption_buttons->adjustSize();
+}
+
+void TitleBar::setTheme()
+{
+    bool dark = qGoodStateHolder->isCurrentThemeDark();
+
+    setAttribute(Qt::WA_TranslucentBackground, false);
+
+    QTimer::singleShot(0, this, [=]{
+        if (m_title_bar_color == QColor(Qt::transparent))
+            setAttribute(Qt::WA_TranslucentBackground, true);
+        else if (m_title_bar_color.isValid())
+            setStyleSheet(m_style.arg(m_title_bar_color.name()));
+        else if (qApp->style()->objectName().startsWith("fusion"))
+            setStyleSheet(m_style.arg(qApp->palette().base().color().name()));
+        else
+            setStyleSheet(m_style.arg(dark ? "#000000" : "#FFFFFF"));
+    });
+
+    //Dark icons on light theme and light icons on dark theme to contrast
+    m_icon_dark = !dark;
+
+    m_title_active_color = (dark ? QColor(255, 255, 255) : QColor(0, 0, 0));
+    m_title_inactive_color = QColor(150, 150, 150);
+
+    if (!m_single_widget)
+    {
+        if (m_caption_buttons)
+        {
+            m_min_btn->setIconMode(m_icon_dark);
+            m_max_btn->setIconMode(m_icon_dark);
+            m_restore_btn->setIconMode(m_icon_dark);
+            m_cls_btn->setIconMode(m_icon_dark);
+        }
+
+        if (m_title_widget)
+            m_title_widget->setTitleColor(m_title_active_color, m_title_inactive_color);
+    }
+    else
+    {
+        for (CaptionButtonRenderer *renderer : {m_min_renderer, m_restore_renderer, m_max_renderer, m_cls_renderer})
+        {
+            if (renderer)
+                renderer->setIconMode(m_icon_dark);
+        }
+
+        update();
+    }
+
+    setActive(m_active);
+}
+
+void TitleBar::setLeftTitleBarWidget(QWidget *widget)
+{
+    setTitleBarWidget(widget, &m_left_widget, &m_left_widget_place_holder);
+}
+
+void TitleBar::setRightTitleBarWidget(QWidget *widget)
+{
+    setTitleBarWidget(widget, &m_right_widget, &m_right_widget_place_holder);
+}
+
+void TitleBar::setCenterTitleBarWidget(QWidget *widget)
+{
+    setTitleBarWidget(widget, &m_center_widget, &m_center_widget_place_holder);
+}
+
+void TitleBar::setTitleBarWidget(QWidget *widget, QPointer<QWidget> *current_widget,
+                                 QPointer<QWidget> *widget_place_holder)
+{
+    if (m_single_widget)
+    {
+        QWidget *previous_widget = *current_widget;
+
+        //The previous widget stays owned by the title bar until deleted by the user.
+        if (previous_widget && previous_widget != widget && previous_widget->parentWidget() == this)
+            previous_widget->hide();
+
+        *current_widget = widget;
+
+        if (widget)
+        {
+            const bool hidden = (widget->testAttribute(Qt::WA_WState_ExplicitShowHide) &&
+                                 widget->testAttribute(Qt::WA_WState_Hidden));
+
+            widget->setParent(this);
+
+            if (!hidden)
+                widget->show();
+        }
+
+        layoutSingleWidget();
+
+        return;
+    }
+
+    *current_widget = widget;
+
+    //No place holder is needed until a widget is set.
+    if (!widget && !*widget_place_holder)
+        return;
+
+    QWidget *place_holder = titleBarWidgetPlaceHolder(widget_place_holder);
+
+    if (place_holder->layout())
+        delete place_holder->layout();
+
+    if (widget)
+    {
+        QGridLayout *layout = new QGridLayout(place_holder);
+        layout->setContentsMargins(0, 0, m_layout_spacing, 0);
+        layout->setSpacing(0);
+        layout->addWidget(widget);
+
+        place_holder->setVisible(true);
+        place_holder->setEnabled(true);
+    }
+    else
+    {
+        place_holder->setVisible(false);
+        place_holder->setEnabled(false);
+    }
+}
+
+void TitleBar::setCaptionButtonWidth(int width)
+{
+    m_caption_button_width = width;
+
+    if (m_single_widget)
+    {
+        layoutSingleWidget();
+        return;
+    }
+
+    if (!m_caption_buttons)
+        return;
+
+    m_min_btn->setFixedSize(width, height());
+    m_restore_btn->setFixedSize(width, height());
+    m_max_btn->setFixedSize(width, height());
+    m_cls_btn->setFixedSize(width, height());
+
+    m_caption_buttons->adjustSize();
+}
+
+void TitleBar::setCaptionButtonsVisible(bool visible)
+{
+    m_caption_buttons_visible = visible;
+
+    if (m_single_widget)
+    {
+        layoutSingleWidget();
+        return;
+    }
+
+    if (m_caption_buttons)
+    {
+        m_caption_buttons->setVisible(visible);
+        m_caption_buttons->setEnabled(visible);
+    }
+
+    createWidgets();
+}
+
+void TitleBar::setTitleVisible(bool visible)
+{
+    m_title_visible = visible;
+
+    if (m_single_widget)
+    {
+        update(titleArea());
+        return;
+    }
+
+    if (m_title_widget)
+    {
+        m_title_widget->setVisible(visible);
+        m_title_widget->setEnabled(visible);
+    }
+
+    createWidgets();
+}
+
+void TitleBar::setIconVisible(bool visible)
+{
+    m_icon_visible = visible;
+
+    if (m_single_widget)
+    {
+        layoutSingleWidget();
+        return;
+    }
+
+    if (m_icon_widget)
+    {
+        m_icon_widget->setVisible(visible);
+        m_icon_widget->setEnabled(visible);
+    }
+
+    createWidgets();
+}
+
+void TitleBar::setLeftMargin(const QSize &size)
+{
+    m_left_margin = size;
+
+    if (m_single_widget)
+    {
+        layoutSingleWidget();
+        return;
+    }
+
+    if (m_left_margin_widget_place_holder || !size.isNull())
+        leftMarginWidgetPlaceHolder()->setFixedSize(size);
+
+    if (m_left_widget_place_holder || !size.isNull())
+        titleBarWidgetPlaceHolder(&m_left_widget_place_holder)->setVisible(!size.isNull() || m_left_widget);
+}
+
+bool TitleBar::isSingleWidget()
+{
+    return m_single_widget;
+}
+
+Qt::Alignment TitleBar::titleAlignment()
+{
+    return m_alignment;
+}
+
+QSize TitleBar::leftMargin()
+{
+    return m_left_margin;
+}
+
+int TitleBar::iconWidth()
+{
+    if (m_single_widget)
+        return m_icon_rect.width();
+
+    if (!m_icon_widget)
+        return 0;
+
+    return m_icon_widget->width();
+}
+
+int TitleBar::captionButtonsWidth()
+{
+    if (m_single_widget)
+        return m_caption_buttons_rect.width();
+
+    if (!m_caption_buttons)
+        return 0;
+
+    return m_caption_buttons->width();
+}
+
+int TitleBar::leftWidth()
+{
+    QRect rect;
+
+    if (m_single_widget)
+    {
+        rect = rect.united(m_icon_rect);
+
+        rect = rect.united(m_left_rect);
+
+        return rect.width();
+    }
+
+    if (m_icon_widget)
+        rect = rect.united(m_icon_widget->geometry());
+
+    if (m_left_widget_place_holder)
+        rect = rect.united(m_left_widget_place_holder->geometry());
+
+    return rect.width();
+}
+
+int TitleBar::rightWidth()
+{
+    QRect rect;
+
+    if (m_single_widget)
+    {
+        rect = rect.united(m_caption_buttons_rect);
+
+        rect = rect.united(m_right_rect);
+    }
+    else
+    {
+        if (m_caption_buttons)
+            rect = rect.united(m_caption_buttons->geometry());
+
+        if (m_right_widget_place_holder)
+            rect = rect.united(m_right_widget_place_holder->geometry());
+    }
+
+    int width = rect.width() + layoutSpacing();
+
+    return width;
+}
+
+int TitleBar::layoutSpacing()
+{
+    return m_layout_spacing;
+}
+
+bool TitleBar::isMinimizedButtonEnabled()
+{
+    if (!m_gw)
+        return false;
+
+    return (m_gw->windowFlags() & Qt::WindowMinimizeButtonHint);
+}
+
+bool TitleBar::isMaximizeButtonEnabled()
+{
+    if (!m_gw)
+        return false;
+
+    return (m_gw->windowFlags() & Qt::WindowMaximizeButtonHint);
+}
+
+bool TitleBar::isCloseButtonEnabled()
+{
+    if (!m_gw)
+        return false;
+
+    return (m_gw->windowFlags() & Qt::WindowCloseButtonHint);
+}
+
+QRect TitleBar::minimizeButtonRect()
+{
+    if (m_single_widget)
+        return m_min_rect;
+
+    if (m_min_btn && m_min_btn->isVisible())
+        return m_min_btn->geometry();
+
+    return QRect();
+}
+
+QRect TitleBar::maximizeButtonRect()
+{
+    if (m_single_widget)
+        return m_max_rect;
+
+    if (m_max_btn && m_max_btn->isVisible())
+        return m_max_btn->geometry();
+    if (m_restore_btn && m_restore_btn->isVisible())
+        return m_restore_btn->geometry();
+
+    return QRect();
+}
+
+QRect TitleBar::closeButtonRect()
+{
+    if (m_single_widget)
+        return m_cls_rect;
+
+    if (m_cls_btn && m_cls_btn->isVisible())
+        return m_cls_btn->geometry();
+
+    return QRect();
+}
+
+void TitleBar::updateWindow()
+{
+    if (m_single_widget)
+    {
+        layoutSingleWidget();
+        return;
+    }
+
+    int left_width = leftWidth();
+
+    int right_width = rightWidth();
+
+    int distance = right_width - left_width;
+
+    int left_distance = 0;
+
+    int right_distance = 0;
+
+    if (distance > 0)
+        left_distance = qAbs(distance);
+    else
+        right_distance = qAbs(distance);
+
+    m_center_spacer_item_left->changeSize(left_distance, 0, QSizePolicy::Preferred, QSizePolicy::Expanding);
+
+    m_center_spacer_item_right->changeSize(right_distance, 0, QSizePolicy::Preferred, QSizePolicy::Expanding);
+}
+
+void TitleBar::captionButtonStateChanged(const QGoodWindow::CaptionButtonState &state)
+{
+    if (m_single_widget ? !m_caption_buttons_visible : (!m_caption_buttons || !m_caption_buttons->isVisible()))
+        return;
+
+    const CaptionButton::IconType maximize_type = (!m_is_maximized ?
+                                                       CaptionButton::IconType::Maximize :
+                                                       CaptionButton::IconType::Restore);
+
+    switch (state)
+    {
+        // Hover enter
+    case QGoodWindow::CaptionButtonState::MinimizeHoverEnter:
+    {
+        setCaptionButtonState(CaptionButton::IconType::Minimize, QEvent::HoverEnter);
+
+        break;
+    }
+    case QGoodWindow::CaptionButtonState::MaximizeHoverEnter:
+    {
+        setCaptionButtonState(maximize_type, QEvent::HoverEnter);
+
+        break;
+    }
+    case QGoodWindow::CaptionButtonState::CloseHoverEnter:
+    {
+        setCaptionButtonState(CaptionButton::IconType::Close, QEvent::HoverEnter);
+
+        break;
+    }
+        // Hover leave
+    case QGoodWindow::CaptionButtonState::MinimizeHoverLeave:
+    {
+        setCaptionButtonState(CaptionButton::IconType::Minimize, QEvent::HoverLeave);
+
+        break;
+    }
+    case QGoodWindow::CaptionButtonState::MaximizeHoverLeave:
+    {
+        setCaptionButtonState(maximize_type, QEvent::HoverLeave);
+
+        break;
+    }
+    case QGoodWindow::CaptionButtonState::CloseHoverLeave:
+    {
+        setCaptionButtonState(CaptionButton::IconType::Close, QEvent::HoverLeave);
+
+        break;
+    }
+        // Mouse button press
+    case QGoodWindow::CaptionButtonState::MinimizePress:
+    {
+        setCaptionButtonState(CaptionButton::IconType::Minimize, QEvent::MouseButtonPress);
+
+        break;
+    }
+    case QGoodWindow::CaptionButtonState::MaximizePress:
+    {
+        setCaptionButtonState(maximize_type, QEvent::MouseButtonPress);
+
+        break;
+    }
+    case QGoodWindow::CaptionButtonState::ClosePress:
+    {
+        setCaptionButtonState(CaptionButton::IconType::Close, QEvent::MouseButtonPress);
+
+        break;
+    }
+        // Mouse button release
+    case QGoodWindow::CaptionButtonState::MinimizeRelease:
+    {
+        setCaptionButtonState(CaptionButton::IconType::Minimize, QEvent::MouseButtonRelease);
+
+        break;
+    }
+    case QGoodWindow::CaptionButtonState::MaximizeRelease:
+    {
+        setCaptionButtonState(maximize_type, QEvent::MouseButtonRelease);
+
+        break;
+    }
+    case QGoodWindow::CaptionButtonState::CloseRelease:
+    {
+        setCaptionButtonState(CaptionButton::IconType::Close, QEvent::MouseButtonRelease);
+
+        break;
+    }
+        // Mouse button clicked
+    case QGoodWindow::CaptionButtonState::MinimizeClicked:
+    {
+        captionButtonClicked(CaptionButton::IconType::Minimize);
+
+        break;
+    }
+    case QGoodWindow::CaptionButtonState::MaximizeClicked:
+    {
+        captionButtonClicked(maximize_type);
+
+        break;
+    }
+    case QGoodWindow::CaptionButtonState::CloseClicked:
+    {
+        captionButtonClicked(CaptionButton::IconType::Close);
+
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void TitleBar::setCaptionButtonState(CaptionButton::IconType type, int state)
+{
+    if (!m_single_widget)
+    {
+        captionButton(type)->setState(state);
+        return;
+    }
+
+    //Repaint only the button that changed.
+    if (captionButtonRenderer(type)->setState(state))
+        update(captionButtonRect(type));
+}
+
+void TitleBar::captionButtonClicked(CaptionButton::IconType type)
+{
+    if (!m_single_widget)
+    {
+        Q_EMIT captionButton(type)->clicked();
+        return;
+    }
+
+    switch (type)
+    {
+    case CaptionButton::IconType::Minimize:
+    {
+        Q_EMIT showMinimized();
+        break;
+    }
+    case CaptionButton::IconType::Restore:
+    {
+        Q_EMIT showNormal();
+        break;
+    }
+    case CaptionButton::IconType::Maximize:
+    {
+        Q_EMIT showMaximized();
+        break;
+    }
+    case CaptionButton::IconType::Close:
+    {
+        Q_EMIT closeWindow();
+        break;
+    }
+    }
+}
+
+CaptionButton *TitleBar::captionButton(CaptionButton::IconType type)
+{
+    switch (type)
+    {
+    case CaptionButton::IconType::Minimize:
+        return m_min_btn;
+    case CaptionButton::IconType::Restore:
+        return m_restore_btn;
+    case CaptionButton::IconType::Maximize:
+        return m_max_btn;
+    case CaptionButton::IconType::Close:
+        return m_cls_btn;
+    }
+
+    return nullptr;
+}
+
+CaptionButtonRenderer *TitleBar::captionButtonRenderer(CaptionButton::IconType type)
+{
+    CaptionButtonRenderer **renderer = nullptr;
+
+    switch (type)
+    {
+    case CaptionButton::IconType::Minimize:
+    {
+        renderer = &m_min_renderer;
+        break;
+    }
+    case CaptionButton::IconType::Restore:
+    {
+        renderer = &m_restore_renderer;
+        break;
+    }
+    case CaptionButton::IconType::Maximize:
+    {
+        renderer = &m_max_renderer;
+        break;
+    }
+    case CaptionButton::IconType::Close:
+    {
+        renderer = &m_cls_renderer;
+        break;
+    }
+    }
+
+    if (!renderer)
+        return nullptr;
+
+    //Renderers are created on first use, their icons on first paint.
+    if (!*renderer)
+    {
+        *renderer = new CaptionButtonRenderer(type);
+        (*renderer)->setIconMode(m_icon_dark);
+        (*renderer)->setActive(m_active);
+    }
+
+    return *renderer;
+}
+
+QRect TitleBar::captionButtonRect(CaptionButton::IconType type)
+{
+    switch (type)
+    {
+    case CaptionButton::IconType::Minimize:
+        return m_min_rect;
+    case CaptionButton::IconType::Restore:
+    case CaptionButton::IconType::Maximize:
+        return m_max_rect;
+    case CaptionButton::IconType::Close:
+        return m_cls_rect;
+    }
+
+    return QRect();
+}
+
+QSize TitleBar::titleBarWidgetSize(QWidget *widget)
+{
+    QSize size = widget->sizeHint().expandedTo(widget->minimumSize());
+    size = size.expandedTo(QSize(0, 0)).boundedTo(widget->maximumSize());
+
+    //Same as the grid layout used in widgets mode, fill the height if the widget can grow.
+    if (widget->sizePolicy().verticalPolicy() & QSizePolicy::GrowFlag)
+        size.setHeight(qMin(height(), widget->maximumHeight()));
+    else
+        size.setHeight(qMin(size.height(), height()));
+
+    return size;
+}
+
+void TitleBar::layoutSingleWidget()
+{
+    const int title_bar_width = width();
+    const int title_bar_height = height();
+    const int button_width = m_caption_button_width;
+
+    QRect left_margin_rect;
+    QRect icon_rect;
+    QRect left_rect;
+    QRect right_rect;
+    QRect center_rect;
+    QRect caption_buttons_rect;
+    QRect min_rect;
+    QRect max_rect;
+    QRect cls_rect;
+
+    int left = 0;
+    int right = title_bar_width;
+
+    if (!m_left_margin.isEmpty())
+    {
+        left_margin_rect = QRect(left, (title_bar_height - m_left_margin.height()) / 2,
+                                 m_left_margin.width(), m_left_margin.height());
+
+        left += left_margin_rect.width();
+    }
+
+    if (m_icon_visible)
+    {
+        icon_rect = QRect(left, 0, 29, title_bar_height);
+
+        left += icon_rect.width();
+    }
+
+    if (m_left_widget && !m_left_widget->isHidden())
+    {
+        const QSize size = titleBarWidgetSize(m_left_widget);
+
+        left_rect = QRect(left, 0, size.width() + m_layout_spacing, title_bar_height);
+
+        m_left_widget->setGeometry(left, (title_bar_height - size.height()) / 2,
+                                   size.width(), size.height());
+
+        left += left_rect.width();
+    }
+
+    if (m_caption_buttons_visible)
+    {
+        right -= button_width;
+        cls_rect = QRect(right, 0, button_width, title_bar_height);
+
+        if (isMaximizeButtonEnabled())
+        {
+            right -= button_width;
+            max_rect = QRect(right, 0, button_width, title_bar_height);
+        }
+
+        if (isMinimizedButtonEnabled())
+        {
+            right -= button_width;
+            min_rect = QRect(right, 0, button_width, title_bar_height);
+        }
+
+        caption_buttons_rect = QRect(right, 0, title_bar_width - right, title_bar_height);
+    }
+
+    if (m_right_widget && !m_right_widget->isHidden())
+    {
+        const QSize size = titleBarWidgetSize(m_right_widget);
+
+        right -= size.width() + m_layout_spacing;
+
+        right_rect = QRect(right, 0, size.width() + m_layout_spacing, title_bar_height);
+
+        m_right_widget->setGeometry(right, (title_bar_height - size.height()) / 2,
+                                    size.width(), size.height());
+    }
+
+    if (m_center_widget && !m_center_widget->isHidden())
+    {
+        const QSize size = titleBarWidgetSize(m_center_widget);
+
+        const int center_width = size.width() + m_layout_spacing;
+
+        //Center on the whole title bar while fitting between left and right widgets.
+        const int x = qBound(left, (title_bar_width - center_width) / 2, qMax(left, right - center_width));
+
+        center_rect = QRect(x, 0, center_width, title_bar_height);
+
+        m_center_widget->setGeometry(x, (title_bar_height - size.height()) / 2,
+                                     size.width(), size.height());
+    }
+
+    const bool changed = (left_margin_rect != m_left_margin_rect ||
+                          icon_rect != m_icon_rect ||
+                          left_rect != m_left_rect ||
+                          right_rect != m_right_rect ||
+                          center_rect != m_center_rect ||
+                          caption_buttons_rect != m_caption_buttons_rect ||
+                          min_rect != m_min_rect ||
+                          max_rect != m_max_rect ||
+                          cls_rect != m_cls_rect);
+
+    m_left_margin_rect = left_margin_rect;
+    m_icon_rect = icon_rect;
+    m_left_rect = left_rect;
+    m_right_rect = right_rect;
+    m_center_rect = center_rect;
+    m_caption_buttons_rect = caption_buttons_rect;
+    m_min_rect = min_rect;
+    m_max_rect = max_rect;
+    m_cls_rect = cls_rect;
+
+    if (changed)
+        update();
+}
+
+void TitleBar::titleRects(QRect *left_rect, QRect *right_rect)
+{
+    *left_rect = m_left_margin_rect.united(m_icon_rect).united(m_left_rect);
+
+    if (m_caption_buttons_visible)
+        *right_rect = m_right_rect.united(m_caption_buttons_rect);
+    else
+        *right_rect = m_right_rect.united(QRect(width(), 0, 1, height()));
+}
+
+QRect TitleBar::titleArea()
+{
+    QRect left_rect;
+    QRect right_rect;
+
+    titleRects(&left_rect, &right_rect);
+
+    return QRect(QPoint(qMax(left_rect.right(), 0), 0), QPoint(right_rect.left(), height() - 1));
+}
+
+qint64 TitleBar::pixmapBytes() const
+{
+    qint64 bytes = 0;
+
+    for (CaptionButtonRenderer *renderer : {m_min_renderer, m_restore_renderer, m_max_renderer, m_cls_renderer})
+    {
+        if (renderer)
+            bytes += renderer->pixmapBytes();
+    }
+
+    return bytes;
+}
+
+void TitleBar::paintEvent(QPaintEvent *event)
+{
+    QFrame::paintEvent(event);
+
+    if (!m_single_widget)
+        return;
+
+    const QRect dirty_rect = event->rect();
+
+    QPainter painter(this);
+
+    if (m_icon_visible && dirty_rect.intersects(m_icon_rect))
+    {
+        const QSize icon_size = QSize(ICONWIDTH, ICONHEIGHT);
+        const qreal pixel_ratio = devicePixelRatioF();
+
+        painter.save();
+        painter.setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
+
+        painter.drawPixmap(m_icon_rect.x() + (m_icon_rect.width() - ICONWIDTH) / 2,
+                           m_icon_rect.y() + (m_icon_rect.height() - ICONHEIGHT) / 2,
+                           ICONWIDTH, ICONHEIGHT,
+                           (m_active ? IconCache::pixmap(m_icon, icon_size, pixel_ratio) :
+                                       IconCache::grayedPixmap(m_icon, icon_size, pixel_ratio)));
+
+        painter.restore();
+    }
+
+    if (m_title_visible && dirty_rect.intersects(titleArea()))
+    {
+        QRect left_rect;
+        QRect right_rect;
+
+        titleRects(&left_rect, &right_rect);
+
+        TitleWidget::drawTitle(&painter, size(), left_rect, right_rect, m_center_rect,
+                               m_title, m_alignment,
+                               m_active ? m_title_active_color : m_title_inactive_color,
+                               m_layout_spacing);
+    }
+
+    if (m_caption_buttons_visible)
+    {
+        if (dirty_rect.intersects(m_min_rect))
+            captionButtonRenderer(CaptionButton::IconType::Minimize)->paint(&painter, m_min_rect);
+
+        if (dirty_rect.intersects(m_max_rect))
+            captionButtonRenderer(m_is_maximized ?
+                                      CaptionButton::IconType::Restore :
+                                      CaptionButton::IconType::Maximize)->paint(&painter, m_max_rect);
+
+        if (dirty_rect.intersects(m_cls_rect))
+            captionButtonRenderer(CaptionButton::IconType::Close)->paint(&painter, m_cls_rect);
+    }
+}
+
+bool TitleBar::event(QEvent *event)
+{
+    if (event->type() == QEvent::Polish)
+    {
+        //Polished right before first show, by now the
+        //visibility of the sub components is known.
+        createWidgets();
+    }
+
+    if (m_single_widget)
+    {
+        switch (event->type())
+        {
+        case QEvent::Resize:
+        case QEvent::LayoutRequest:
+        case QEvent::ChildRemoved:
+        {
+            layoutSingleWidget();
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+#ifdef QGOODWINDOW
+#ifdef Q_OS_LINUX
+    switch (event->type())
+    {
+    case QEvent::Resize:
+    {
+        QRegion mask;
+
+        if (m_gw->windowState().testFlag(Qt::WindowNoState))
+        {
+            const int radius = 8;
+
+            QBitmap bmp(size());
+            bmp.clear();
+
+            QPainter painter;
+            painter.begin(&bmp);
+            painter.setRenderHints(QPainter::Antialiasing);
+            painter.setPen(Qt::color1);
+            painter.setBrush(Qt::color1);
+            QPainterPath path;
+            path.setFillRule(Qt::WindingFill);
+            path.addRoundedRect(rect(), radius, radius);
+            path.addRect(rect().adjusted(0, height() - radius, radius, radius));
+            path.addRect(rect().adjusted(width() - radius, height() - radius, radius, radius));
+            painter.drawPath(path.simplified());
+            painter.end();
+
+            mask = bmp;
+        }
+
+        setMask(mask);
+
+        break;
+    }
+    default:
+        break;
+    }
+#endif
+#endif
+
+    return QWidget::event(event);
+}
@@ -1,107 +1,167 @@
-/*
-The MIT License (MIT)
-
-Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#ifndef TITLEBAR_H
-#define TITLEBAR_H
-
-#include <QtCore>
-#include <QtGui>
-#include <QtWidgets>
-#include <QGoodWindow>
-#include "iconwidget.h"
-#include "titlewidget.h"
-#include "captionbutton.h"
-
-//\cond HIDDEN_SYMBOLS
-class TitleBar : public QFrame
-{
-    Q_OBJECT
-public:
-    explicit TitleBar(QGoodWindow *gw, QWidget *parent = nullptr);
-
-Q_SIGNALS:
-    void showMinimized();
-    void showNormal();
-    void showMaximized();
-    void closeWindow();
-
-public Q_SLOTS:
-    void setTitle(const QString &title);
-    void setIcon(const QPixmap &icon);
-    void setActive(bool active);
-    void setTitleAlignment(const Qt::Alignment &alignment);
-    void setMaximized(bool maximized);
-    void setTheme();
-    void setLeftTitleBarWidget(QWidget *widget);
-    void setRightTitleBarWidget(QWidget *widget);
-    void setCenterTitleBarWidget(QWidget *widget);
-    void setCaptionButtonWidth(int width);
-    Qt::Alignment titleAlignment();
-    int captionButtonsWidth();
-    int leftWidth();
-    int rightWidth();
-    int layoutSpacing();
-    bool isMinimizedButtonEnabled();
-    bool isMaximizeButtonEnabled();
-    bool isCloseButtonEnabled();
-    QRect minimizeButtonRect();
-    QRect maximizeButtonRect();
-    QRect closeButtonRect();
-    void updateWindow();
-    void captionButtonStateChanged(const QGoodWindow::CaptionButtonState &state);
-
-private:
-    //Functions
-    bool event(QEvent *event);
-
-    //Variable
-    QPointer<QGoodWindow> m_gw;
-    QWidget *m_left_margin_widget_place_holder;
-    IconWidget *m_icon_widget;
-    TitleWidget *m_title_widget;
-    QWidget *m_caption_buttons;
-    CaptionButton *m_min_btn;
-    CaptionButton *m_restore_btn;
-    CaptionButton *m_max_btn;
-    CaptionButton *m_cls_btn;
-    QPointer<QWidget> m_left_widget;
-    QPointer<QWidget> m_right_widget;
-    QPointer<QWidget> m_center_widget;
-    QPointer<QWidget> m_left_widget_place_holder;
-    QPointer<QWidget> m_right_widget_place_holder;
-    QPointer<QWidget> m_center_widget_place_holder;
-    QSpacerItem *m_center_spacer_item_left;
-    QSpacerItem *m_center_spacer_item_right;
-    int m_layout_spacing;
-    QString m_style;
-    bool m_active;
-    bool m_is_maximized;
-    QColor m_title_bar_color;
-
-    friend class QGoodCentralWidget;
-    friend class TitleWidget;
-};
-//\endcond
-
-#endif // TITLEBAR_H
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef TITLEBAR_H
+#define TITLEBAR_H
+
+#include <QtCore>
+#include <QtGui>
+#include <QtWidgets>
+#include <QGoodWindow>
+#include "iconwidget.h"
+#include "titlewidget.h"
+#include "captionbutton.h"
+
+//\cond HIDDEN_SYMBOLS
+class TitleBar : public QFrame, public QGoodWindowPixmapOwner
+{
+    Q_OBJECT
+    Q_INTERFACES(QGoodWindowPixmapOwner)
+public:
+    explicit TitleBar(QGoodWindow *gw, bool single_widget, QWidget *parent = nullptr);
+    ~TitleBar();
+
+    qint64 pixmapBytes() const;
+
+Q_SIGNALS:
+    void showMinimized();
+    void showNormal();
+    void showMaximized();
+    void closeWindow();
+
+public Q_SLOTS:
+    void setTitle(const QString &title);
+    void setIcon(const QIcon &icon);
+    void setActive(bool active);
+    void setTitleAlignment(const Qt::Alignment &alignment);
+    void setMaximized(bool maximized);
+    void setTheme();
+    void setLeftTitleBarWidget(QWidget *widget);
+    void setRightTitleBarWidget(QWidget *widget);
+    void setCenterTitleBarWidget(QWidget *widget);
+    void setCaptionButtonWidth(int width);
+    void setCaptionButtonsVisible(bool visible);
+    void setTitleVisible(bool visible);
+    void setIconVisible(bool visible);
+    void setLeftMargin(const QSize &size);
+    bool isSingleWidget();
+    Qt::Alignment titleAlignment();
+    QSize leftMargin();
+    int iconWidth();
+    int captionButtonsWidth();
+    int leftWidth();
+    int rightWidth();
+    int layoutSpacing();
+    bool isMinimizedButtonEnabled();
+    bool isMaximizeButtonEnabled();
+    bool isCloseButtonEnabled();
+    QRect minimizeButtonRect();
+    QRect maximizeButtonRect();
+    QRect closeButtonRect();
+    void updateWindow();
+    void captionButtonStateChanged(const QGoodWindow::CaptionButtonState &state);
+
+private:
+    //Functions
+    void setupWidgets();
+    void createWidgets();
+    void insertLayoutWidget(QWidget *widget);
+    QWidget *leftMarginWidgetPlaceHolder();
+    IconWidget *iconWidget();
+    TitleWidget *titleWidget();
+    QWidget *captionButtons();
+    QWidget *titleBarWidgetPlaceHolder(QPointer<QWidget> *widget_place_holder);
+    void setTitleBarWidget(QWidget *widget, QPointer<QWidget> *current_widget,
+                           QPointer<QWidget> *widget_place_holder);
+    void setCaptionButtonState(CaptionButton::IconType type, int state);
+    void captionButtonClicked(CaptionButton::IconType type);
+    CaptionButton *captionButton(CaptionButton::IconType type);
+    CaptionButtonRenderer *captionButtonRenderer(CaptionButton::IconType type);
+    QRect captionButtonRect(CaptionButton::IconType type);
+    QSize titleBarWidgetSize(QWidget *widget);
+    void layoutSingleWidget();
+    void titleRects(QRect *left_rect, QRect *right_rect);
+    QRect titleArea();
+    void paintEvent(QPaintEvent *event);
+    bool event(QEvent *event);
+
+    //Variable
+    QPointer<QGoodWindow> m_gw;
+    bool m_single_widget;
+    QWidget *m_left_margin_widget_place_holder;
+    IconWidget *m_icon_widget;
+    TitleWidget *m_title_widget;
+    QWidget *m_caption_buttons;
+    CaptionButton *m_min_btn;
+    CaptionButton *m_restore_btn;
+    CaptionButton *m_max_btn;
+    CaptionButton *m_cls_btn;
+    QPointer<QWidget> m_left_widget;
+    QPointer<QWidget> m_right_widget;
+    QPointer<QWidget> m_center_widget;
+    QPointer<QWidget> m_left_widget_place_holder;
+    QPointer<QWidget> m_right_widget_place_holder;
+    QPointer<QWidget> m_center_widget_place_holder;
+    QHBoxLayout *m_layout;
+    QStackedLayout *m_stacked_layout;
+    QSpacerItem *m_center_spacer_item_left;
+    QSpacerItem *m_center_spacer_item_right;
+    int m_layout_spacing;
+    QString m_style;
+    bool m_active;
+    bool m_is_maximized;
+    QColor m_title_bar_color;
+    QString m_title;
+    QIcon m_icon;
+    Qt::Alignment m_alignment;
+    QColor m_title_active_color;
+    QColor m_title_inactive_color;
+    QSize m_left_margin;
+    int m_caption_button_width;
+    bool m_caption_buttons_visible;
+    bool m_title_visible;
+    bool m_icon_visible;
+    bool m_icon_dark;
+
+    //Single widget mode
+    CaptionButtonRenderer *m_min_renderer;
+    CaptionButtonRenderer *m_restore_renderer;
+    CaptionButtonRenderer *m_max_renderer;
+    CaptionButtonRenderer *m_cls_renderer;
+    QRect m_left_margin_rect;
+    QRect m_icon_rect;
+    QRect m_left_rect;
+    QRect m_right_rect;
+    QRect m_center_rect;
+    QRect m_caption_buttons_rect;
+    QRect m_min_rect;
+    QRect m_max_rect;
+    QRect m_cls_rect;
+
+    friend class QGoodCentralWidget;
+    friend class TitleWidget;
+};
+//\endcond
+
+#endif // TITLEBAR_H
@@ -0,0 +1,290 @@
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "windowpool.h"
+#include "qgoodcentralwidget.h"
+
+WindowPool *WindowPool::instance()
+{
+    //Owned by the application, pooled windows are deleted before it quits.
+    static QPointer<WindowPool> instance;
+
+    if (!instance)
+        instance = new WindowPool();
+
+    return instance;
+}
+
+WindowPool::WindowPool() : QObject(qApp)
+{
+    m_fill_pending = false;
+
+    connect(qApp, &QCoreApplication::aboutToQuit, this, [=]{
+        for (QGoodWindow *parent_gw : m_pools.keys())
+            clear(parent_gw);
+    });
+}
+
+WindowPool::~WindowPool()
+{
+    for (QGoodWindow *parent_gw : m_pools.keys())
+        clear(parent_gw);
+}
+
+void WindowPool::setPoolSize(QGoodWindow *parent_gw, int count)
+{
+    count = qMax(count, 0);
+
+    if (count == 0)
+    {
+        clear(parent_gw);
+        return;
+    }
+
+    if (!m_pools.contains(parent_gw) && parent_gw)
+    {
+        connect(parent_gw, &QGoodWindow::destroyed, this, [=]{
+            m_pools.remove(parent_gw);
+        });
+    }
+
+    Pool &pool = m_pools[parent_gw];
+    pool.size = count;
+
+    while (pool.list.size() > count)
+    {
+        QGoodCentralWidget *gcw = pool.list.takeLast();
+
+        if (gcw)
+            gcw->m_gw->deleteLater();
+    }
+
+    fillLater();
+}
+
+bool WindowPool::hasPool(QGoodWindow *parent_gw) const
+{
+    return m_pools.contains(parent_gw);
+}
+
+QGoodCentralWidget *WindowPool::take(QGoodWindow *parent_gw)
+{
+    QGoodCentralWidget *gcw = nullptr;
+
+    auto it = m_pools.find(parent_gw);
+
+    if (it != m_pools.end())
+    {
+        while (!gcw && !it->list.isEmpty())
+            gcw = it->list.takeFirst();
+
+        fillLater();
+    }
+
+    if (!gcw)
+        gcw = create(parent_gw);
+
+    QGoodWindow *gw = gcw->m_gw;
+
+    m_taken_windows.insert(gw, parent_gw);
+
+    gw->installEventFilter(this);
+
+    return gcw;
+}
+
+void WindowPool::fillLater()
+{
+    if (m_fill_pending)
+        return;
+
+    m_fill_pending = true;
+
+    QTimer::singleShot(0, this, &WindowPool::fill);
+}
+
+void WindowPool::fill()
+{
+    m_fill_pending = false;
+
+    //Build one window per event loop iteration to keep the application responsive.
+    for (auto it = m_pools.begin(); it != m_pools.end(); ++it)
+    {
+        it->list.removeAll(nullptr);
+
+        if (it->list.size() >= it->size)
+            continue;
+
+        it->list.append(create(it.key()));
+
+        fillLater();
+
+        break;
+    }
+}
+
+QGoodCentralWidget *WindowPool::create(QGoodWindow *parent_gw)
+{
+    QGoodWindow *gw = new QGoodWindow(parent_gw);
+
+    connect(gw, &QGoodWindow::destroyed, this, [=]{
+        m_taken_windows.remove(gw);
+        m_window_defaults.remove(gw);
+    });
+
+    QGoodCentralWidget *gcw = new QGoodCentralWidget(gw);
+
+    gw->setCentralWidget(gcw);
+
+    //Build the title bar and apply the style now instead of when shown.
+    gw->ensurePolished();
+
+#ifndef Q_OS_WIN
+    Defaults defaults;
+    defaults.title = gw->windowTitle();
+    defaults.icon = gw->windowIcon();
+    m_window_defaults.insert(gw, defaults);
+#endif
+
+    return gcw;
+}
+
+void WindowPool::recycle(QGoodCentralWidget *gcw)
+{
+    QGoodWindow *gw = gcw->m_gw;
+
+    QGoodWindow *parent_gw = m_taken_windows.take(gw);
+
+    gw->removeEventFilter(this);
+
+    auto it = m_pools.find(parent_gw);
+
+#ifdef Q_OS_WIN
+    //The native window is destroyed on close, it's used only once,
+    //the pool still builds its replacement ahead during idle time.
+    const bool reuse = false;
+#else
+    const bool reuse = true;
+#endif
+
+    if (!reuse || it == m_pools.end() || it->list.size() >= it->size)
+    {
+        gw->deleteLater();
+        fillLater();
+        return;
+    }
+
+    //Like WA_DeleteOnClose, everything still inside the window is deleted.
+    QWidget *central_widget = gcw->centralWidget();
+
+    if (central_widget && gcw->isAncestorOf(central_widget))
+        delete central_widget;
+
+    gcw->setCentralWidget(nullptr);
+
+    for (QWidget *widget : {gcw->leftTitleBarWidget(), gcw->rightTitleBarWidget(), gcw->centerTitleBarWidget()})
+    {
+        if (widget && gcw->isAncestorOf(widget))
+            delete widget;
+    }
+
+    gcw->setLeftTitleBarWidget(nullptr);
+    gcw->setRightTitleBarWidget(nullptr);
+    gcw->setCenterTitleBarWidget(nullptr);
+
+    qDeleteAll(gw->findChildren<QShortcut*>(QString(), Qt::FindDirectChildrenOnly));
+
+    gcw->setTitleBarVisible(true);
+    gcw->setCaptionButtonsVisible(true);
+    gcw->setTitleVisible(true);
+    gcw->setIconVisible(true);
+    gcw->setIconWidth(0);
+
+    gw->setWindowModality(Qt::NonModal);
+    gw->setMinimumSize(0, 0);
+    gw->setMaximumSize(QWIDGETSIZE_MAX, QWIDGETSIZE_MAX);
+
+    const Defaults defaults = m_window_defaults.value(gw);
+    gw->setWindowTitle(defaults.title);
+    gw->setWindowIcon(defaults.icon);
+
+    it->list.append(gcw);
+}
+
+void WindowPool::clear(QGoodWindow *parent_gw)
+{
+    auto it = m_pools.find(parent_gw);
+
+    if (it == m_pools.end())
+        return;
+
+    for (QGoodCentralWidget *gcw : it->list)
+    {
+        if (gcw)
+            delete gcw->m_gw;
+    }
+
+    if (parent_gw)
+        disconnect(parent_gw, &QGoodWindow::destroyed, this, nullptr);
+
+    m_pools.erase(it);
+}
+
+bool WindowPool::eventFilter(QObject *watched, QEvent *event)
+{
+    switch (event->type())
+    {
+    case QEvent::Close:
+    {
+        QPointer<QGoodWindow> gw = qobject_cast<QGoodWindow*>(watched);
+
+        if (!gw || !m_taken_windows.contains(gw))
+            break;
+
+        //The close may still be ignored.
+        QTimer::singleShot(0, this, [=]{
+            if (!gw || gw->isVisible())
+                return;
+
+            QGoodCentralWidget *gcw = qobject_cast<QGoodCentralWidget*>(gw->centralWidget());
+
+            if (gcw)
+            {
+                recycle(gcw);
+            }
+            else
+            {
+                m_taken_windows.remove(gw);
+                gw->deleteLater();
+            }
+        });
+
+        break;
+    }
+    default:
+        break;
+    }
+
+    return QObject::eventFilter(watched, event);
+}
@@ -0,0 +1,79 @@
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef WINDOWPOOL_H
+#define WINDOWPOOL_H
+
+#include <QtCore>
+#include <QtGui>
+#include <QtWidgets>
+#include <QGoodWindow>
+
+class QGoodCentralWidget;
+
+//\cond HIDDEN_SYMBOLS
+class WindowPool : public QObject
+{
+    Q_OBJECT
+public:
+    static WindowPool *instance();
+
+    void setPoolSize(QGoodWindow *parent_gw, int count);
+    bool hasPool(QGoodWindow *parent_gw) const;
+    QGoodCentralWidget *take(QGoodWindow *parent_gw);
+
+private:
+    explicit WindowPool();
+    ~WindowPool();
+
+    struct Pool
+    {
+        int size = 0;
+        QList<QPointer<QGoodCentralWidget>> list;
+    };
+
+    //Title and icon of a window when it was built, restored when it returns to the pool.
+    struct Defaults
+    {
+        QString title;
+        QIcon icon;
+    };
+
+    //Functions
+    void fillLater();
+    void fill();
+    QGoodCentralWidget *create(QGoodWindow *parent_gw);
+    void recycle(QGoodCentralWidget *gcw);
+    void clear(QGoodWindow *parent_gw);
+    bool eventFilter(QObject *watched, QEvent *event);
+
+    //Variables
+    QHash<QGoodWindow*, Pool> m_pools;
+    QHash<QGoodWindow*, QGoodWindow*> m_taken_windows;
+    QHash<QGoodWindow*, Defaults> m_window_defaults;
+    bool m_fill_pending;
+};
+//\endcond
+
+#endif // WINDOWPOOL_H
@@ -0,0 +1,163 @@
+#The MIT License (MIT)
+
+#Copyright © 2022-2023 Antonio Dias (https://github.com/antonypro)
+
+#Permission is hereby granted, free of charge, to any person obtaining a copy
+#of this software and associated documentation files (the "Software"), to deal
+#in the Software without restriction, including without limitation the rights
+#to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#copies of the Software, and to permit persons to whom the Software is
+#furnished to do so, subject to the following conditions:
+
+#The above copyright notice and this permission notice shall be included in all
+#copies or substantial portions of the Software.
+
+#THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+#SOFTWARE.
+
+#Bakes the caption button SVG icons into premultiplied ARGB32 buffers,
+#written to src/captionsprites.h.
+#Run again whenever an icon in src/icons changes:
+#python3 tools/captionsprites.py
+
+import math
+import os
+import xml.etree.ElementTree as ET
+
+ICONS = ["minimize", "restore", "maximize", "close"]
+
+#Logical icon size, see CaptionButtonRenderer::drawIcons().
+ICON_SIZE = 10
+
+#Device pixel ratios baked, other ratios fall back to the SVG.
+SCALES = [1.0, 1.25, 1.5, 2.0, 3.0]
+
+#Sub samples per pixel axis used to compute the coverage.
+SAMPLES = 16
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+ICONS_DIR = os.path.join(ROOT, "src", "icons")
+OUTPUT = os.path.join(ROOT, "src", "captionsprites.h")
+
+NS = "{http://www.w3.org/2000/svg}"
+
+
+def line_polygon(x1, y1, x2, y2, half_width):
+    #Butt capped line stroke.
+    length = math.hypot(x2 - x1, y2 - y1)
+    nx = -(y2 - y1) / length * half_width
+    ny = (x2 - x1) / length * half_width
+    return [(x1 + nx, y1 + ny), (x2 + nx, y2 + ny), (x2 - nx, y2 - ny), (x1 - nx, y1 - ny)]
+
+
+def rect_polygon(x, y, w, h):
+    return [(x, y), (x + w, y), (x + w, y + h), (x, y + h)]
+
+
+def inside(polygon, px, py):
+    result = False
+    count = len(polygon)
+    for i in range(count):
+        x1, y1 = polygon[i]
+        x2, y2 = polygon[(i + 1) % count]
+        if (y1 > py) != (y2 > py):
+            if px < x1 + (py - y1) * (x2 - x1) / (y2 - y1):
+                result = not result
+    return result
+
+
+def load_shapes(name):
+    #Each shape is a pair of polygons, covered when inside the first and outside the second.
+    tree = ET.parse(os.path.join(ICONS_DIR, name + ".svg"))
+
+    shapes = []
+
+    for group in tree.iter(NS + "g"):
+        stroke_width = float(group.get("stroke-width", "1"))
+        half_width = stroke_width / 2
+
+        for element in group:
+            if element.tag == NS + "polyline":
+                points = [tuple(float(v) for v in p.split(",")) for p in element.get("points").split()]
+                for (x1, y1), (x2, y2) in zip(points, points[1:]):
+                    shapes.append((line_polygon(x1, y1, x2, y2, half_width), None))
+            elif element.tag == NS + "rect":
+                x = float(element.get("x"))
+                y = float(element.get("y"))
+                w = float(element.get("width"))
+                h = float(element.get("height"))
+                #Miter joined rect stroke.
+                shapes.append((rect_polygon(x - half_width, y - half_width, w + stroke_width, h + stroke_width),
+                               rect_polygon(x + half_width, y + half_width, w - stroke_width, h - stroke_width)))
+
+    return shapes
+
+
+def bake(shapes, size):
+    scale = size / ICON_SIZE
+    pixels = []
+
+    for y in range(size):
+        for x in range(size):
+            covered = 0
+            for sy in range(SAMPLES):
+                for sx in range(SAMPLES):
+                    px = (x + (sx + 0.5) / SAMPLES) / scale
+                    py = (y + (sy + 0.5) / SAMPLES) / scale
+                    for outer, inner in shapes:
+                        if inside(outer, px, py) and not (inner and inside(inner, px, py)):
+                            covered += 1
+                            break
+            alpha = round(covered * 255 / (SAMPLES * SAMPLES))
+            #White premultiplied by alpha.
+            pixels.append((alpha << 24) | (alpha << 16) | (alpha << 8) | alpha)
+
+    return pixels
+
+
+def main():
+    with open(os.path.join(ROOT, "tools", "captionsprites.py"), encoding="utf-8") as file:
+        license_lines = [line[1:] for line in file.read().splitlines()[:21]]
+
+    out = ["/*"] + license_lines + ["*/", ""]
+    out += ["//Generated by tools/captionsprites.py from src/icons, do not edit.", ""]
+    out += ["#ifndef CAPTIONSPRITES_H", "#define CAPTIONSPRITES_H", "", "#include <QtCore>", ""]
+    out += ["//\\cond HIDDEN_SYMBOLS", "struct CaptionSprite", "{",
+            "    const char *name;", "    int size;", "    const quint32 *data;", "};", ""]
+
+    table = []
+
+    for name in ICONS:
+        shapes = load_shapes(name)
+
+        for scale in SCALES:
+            size = int(math.floor(ICON_SIZE * scale + 0.5))
+            pixels = bake(shapes, size)
+            array = "caption_sprite_%s_%d" % (name, size)
+            table.append('    {"%s", %d, %s}' % (name, size, array))
+
+            out.append("static const quint32 %s[] =" % array)
+            out.append("{")
+            for row in range(0, len(pixels), 8):
+                out.append("    " + ", ".join("0x%08x" % p for p in pixels[row:row + 8]) + ",")
+            out[-1] = out[-1][:-1]
+            out.append("};")
+            out.append("")
+
+    out.append("static const CaptionSprite caption_sprites[] =")
+    out.append("{")
+    out.append(",\n".join(table))
+    out.append("};")
+    out += ["//\\endcond", "", "#endif // CAPTIONSPRITES_H", ""]
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\r\n") as file:
+        file.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,48 +1,48 @@
-/*
-The MIT License (MIT)
-
-Copyright © 2023 Antonio Dias (https://github.com/antonypro)
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#ifndef QGOODWINDOW_GLOBAL_H
-#define QGOODWINDOW_GLOBAL_H
-
-#include <QtCore/qglobal.h>
-
-#include "qgoodwindow_helper.h"
-
-#ifndef QGOODWINDOW_LIBRARY
-#define QGOODWINDOW_LIBRARY //Using shared library
-#endif
-
-#ifndef QGOODWINDOW_SHARED_EXPORT
-#ifdef QGOODWINDOW_LIBRARY
-#ifdef QGOODWINDOW_SHARED_LIBRARY
-#define QGOODWINDOW_SHARED_EXPORT Q_DECL_EXPORT
-#else
-#define QGOODWINDOW_SHARED_EXPORT Q_DECL_IMPORT
-#endif
-#else
-#define QGOODWINDOW_SHARED_EXPORT
-#endif
-#endif
-
-#endif // QGOODWINDOW_GLOBAL_H
+/*
+The MIT License (MIT)
+
+Copyright © 2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef QGOODWINDOW_GLOBAL_H
+#define QGOODWINDOW_GLOBAL_H
+
+#include <QtCore/qglobal.h>
+
+#include "qgoodwindow_helper.h"
+
+#ifndef QGOODWINDOW_LIBRARY
+#define QGOODWINDOW_LIBRARY //Using shared library
+#endif
+
+#ifndef QGOODWINDOW_SHARED_EXPORT
+#ifdef QGOODWINDOW_LIBRARY
+#ifdef QGOODWINDOW_SHARED_LIBRARY
+#define QGOODWINDOW_SHARED_EXPORT Q_DECL_EXPORT
+#else
+#define QGOODWINDOW_SHARED_EXPORT Q_DECL_IMPORT
+#endif
+#else
+#define QGOODWINDOW_SHARED_EXPORT
+#endif
+#endif
+
+#endif // QGOODWINDOW_GLOBAL_H
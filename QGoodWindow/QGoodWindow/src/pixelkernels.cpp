@@ -0,0 +1,527 @@
+/*
+The MIT License (MIT)
+
+Copyright © 2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "pixelkernels.h"
+
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#define PIXELKERNELS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined PIXELKERNELS_SSE2 && (defined __GNUC__ || defined _MSC_VER)
+#define PIXELKERNELS_AVX2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define PIXELKERNELS_TARGET_AVX2
+#else
+#define PIXELKERNELS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#if defined __ARM_NEON || defined __ARM_NEON__
+#define PIXELKERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+#define ALPHA_MASK 0xFF000000u
+#define RGB_MASK 0x00FFFFFFu
+
+namespace PixelKernels
+{
+namespace Scalar
+{
+inline quint32 scaleRgbPixel(quint32 pixel, quint32 factor)
+{
+    const quint32 r = ((((pixel >> 16) & 0xFF) * factor + 128) >> 8);
+    const quint32 g = ((((pixel >> 8) & 0xFF) * factor + 128) >> 8);
+    const quint32 b = (((pixel & 0xFF) * factor + 128) >> 8);
+
+    return (pixel & ALPHA_MASK) | (r << 16) | (g << 8) | b;
+}
+
+inline quint32 grayPixel(quint32 pixel)
+{
+    //Same weights as qGray().
+    const quint32 gray = (((pixel >> 16) & 0xFF) * 11 + ((pixel >> 8) & 0xFF) * 16 + (pixel & 0xFF) * 5) >> 5;
+
+    return (pixel & ALPHA_MASK) | (gray << 16) | (gray << 8) | gray;
+}
+
+inline quint32 invertPixel(quint32 pixel)
+{
+    //On premultiplied pixels the inverted channel is alpha minus channel.
+    const quint32 a = (pixel >> 24);
+    const quint32 r = (pixel >> 16) & 0xFF;
+    const quint32 g = (pixel >> 8) & 0xFF;
+    const quint32 b = pixel & 0xFF;
+
+    return (pixel & ALPHA_MASK) |
+            ((r < a ? a - r : 0) << 16) |
+            ((g < a ? a - g : 0) << 8) |
+            (b < a ? a - b : 0);
+}
+
+void scaleRgb(quint32 *pixels, int count, quint32 factor)
+{
+    for (int i = 0; i < count; i++)
+        pixels[i] = scaleRgbPixel(pixels[i], factor);
+}
+
+void grayscale(quint32 *pixels, int count)
+{
+    for (int i = 0; i < count; i++)
+        pixels[i] = grayPixel(pixels[i]);
+}
+
+void invertRgb(quint32 *pixels, int count)
+{
+    for (int i = 0; i < count; i++)
+        pixels[i] = invertPixel(pixels[i]);
+}
+}
+
+#ifdef PIXELKERNELS_SSE2
+namespace SSE2
+{
+int scaleRgb(quint32 *pixels, int count, quint32 factor)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha_mask = _mm_set1_epi32(int(ALPHA_MASK));
+    const __m128i mul = _mm_set1_epi16(short(factor));
+    const __m128i round = _mm_set1_epi16(128);
+
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i *ptr = reinterpret_cast<__m128i*>(pixels + i);
+        const __m128i src = _mm_loadu_si128(ptr);
+
+        __m128i lo = _mm_unpacklo_epi8(src, zero);
+        __m128i hi = _mm_unpackhi_epi8(src, zero);
+        lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(lo, mul), round), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(hi, mul), round), 8);
+
+        const __m128i scaled = _mm_packus_epi16(lo, hi);
+
+        _mm_storeu_si128(ptr, _mm_or_si128(_mm_andnot_si128(alpha_mask, scaled),
+                                           _mm_and_si128(alpha_mask, src)));
+    }
+
+    return i;
+}
+
+int grayscale(quint32 *pixels, int count)
+{
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    const __m128i alpha_mask = _mm_set1_epi32(int(ALPHA_MASK));
+    const __m128i r_weight = _mm_set1_epi32(11);
+    const __m128i b_weight = _mm_set1_epi32(5);
+
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i *ptr = reinterpret_cast<__m128i*>(pixels + i);
+        const __m128i src = _mm_loadu_si128(ptr);
+
+        const __m128i r = _mm_and_si128(_mm_srli_epi32(src, 16), byte_mask);
+        const __m128i g = _mm_and_si128(_mm_srli_epi32(src, 8), byte_mask);
+        const __m128i b = _mm_and_si128(src, byte_mask);
+
+        //The products fit in the low 16 bits of each lane.
+        __m128i gray = _mm_add_epi32(_mm_mullo_epi16(r, r_weight), _mm_slli_epi32(g, 4));
+        gray = _mm_add_epi32(gray, _mm_mullo_epi16(b, b_weight));
+        gray = _mm_srli_epi32(gray, 5);
+
+        gray = _mm_or_si128(gray, _mm_or_si128(_mm_slli_epi32(gray, 8), _mm_slli_epi32(gray, 16)));
+
+        _mm_storeu_si128(ptr, _mm_or_si128(gray, _mm_and_si128(alpha_mask, src)));
+    }
+
+    return i;
+}
+
+int invertRgb(quint32 *pixels, int count)
+{
+    const __m128i alpha_mask = _mm_set1_epi32(int(ALPHA_MASK));
+
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i *ptr = reinterpret_cast<__m128i*>(pixels + i);
+        const __m128i src = _mm_loadu_si128(ptr);
+
+        __m128i alpha = _mm_srli_epi32(src, 24);
+        alpha = _mm_or_si128(alpha, _mm_or_si128(_mm_slli_epi32(alpha, 8), _mm_slli_epi32(alpha, 16)));
+
+        const __m128i inverted = _mm_subs_epu8(alpha, _mm_andnot_si128(alpha_mask, src));
+
+        _mm_storeu_si128(ptr, _mm_or_si128(inverted, _mm_and_si128(alpha_mask, src)));
+    }
+
+    return i;
+}
+}
+#endif
+
+#ifdef PIXELKERNELS_AVX2
+namespace AVX2
+{
+bool isSupported()
+{
+#ifdef _MSC_VER
+    int info[4];
+
+    __cpuid(info, 0);
+
+    if (info[0] < 7)
+        return false;
+
+    __cpuid(info, 1);
+
+    const bool os_xsave = (info[2] & (1 << 27));
+    const bool avx = (info[2] & (1 << 28));
+
+    if (!os_xsave || !avx)
+        return false;
+
+    //OS must save the YMM registers.
+    if ((_xgetbv(0) & 0x6) != 0x6)
+        return false;
+
+    __cpuidex(info, 7, 0);
+
+    return (info[1] & (1 << 5));
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+PIXELKERNELS_TARGET_AVX2 int scaleRgb(quint32 *pixels, int count, quint32 factor)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i alpha_mask = _mm256_set1_epi32(int(ALPHA_MASK));
+    const __m256i mul = _mm256_set1_epi16(short(factor));
+    const __m256i round = _mm256_set1_epi16(128);
+
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i *ptr = reinterpret_cast<__m256i*>(pixels + i);
+        const __m256i src = _mm256_loadu_si256(ptr);
+
+        //Unpack and pack work per 128 bits lane, so the order is preserved.
+        __m256i lo = _mm256_unpacklo_epi8(src, zero);
+        __m256i hi = _mm256_unpackhi_epi8(src, zero);
+        lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(lo, mul), round), 8);
+        hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(hi, mul), round), 8);
+
+        const __m256i scaled = _mm256_packus_epi16(lo, hi);
+
+        _mm256_storeu_si256(ptr, _mm256_or_si256(_mm256_andnot_si256(alpha_mask, scaled),
+                                                 _mm256_and_si256(alpha_mask, src)));
+    }
+
+    return i;
+}
+
+PIXELKERNELS_TARGET_AVX2 int grayscale(quint32 *pixels, int count)
+{
+    const __m256i byte_mask = _mm256_set1_epi32(0xFF);
+    const __m256i alpha_mask = _mm256_set1_epi32(int(ALPHA_MASK));
+    const __m256i r_weight = _mm256_set1_epi32(11);
+    const __m256i b_weight = _mm256_set1_epi32(5);
+
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i *ptr = reinterpret_cast<__m256i*>(pixels + i);
+        const __m256i src = _mm256_loadu_si256(ptr);
+
+        const __m256i r = _mm256_and_si256(_mm256_srli_epi32(src, 16), byte_mask);
+        const __m256i g = _mm256_and_si256(_mm256_srli_epi32(src, 8), byte_mask);
+        const __m256i b = _mm256_and_si256(src, byte_mask);
+
+        __m256i gray = _mm256_add_epi32(_mm256_mullo_epi16(r, r_weight), _mm256_slli_epi32(g, 4));
+        gray = _mm256_add_epi32(gray, _mm256_mullo_epi16(b, b_weight));
+        gray = _mm256_srli_epi32(gray, 5);
+
+        gray = _mm256_or_si256(gray, _mm256_or_si256(_mm256_slli_epi32(gray, 8), _mm256_slli_epi32(gray, 16)));
+
+        _mm256_storeu_si256(ptr, _mm256_or_si256(gray, _mm256_and_si256(alpha_mask, src)));
+    }
+
+    return i;
+}
+
+PIXELKERNELS_TARGET_AVX2 int invertRgb(quint32 *pixels, int count)
+{
+    const __m256i alpha_mask = _mm256_set1_epi32(int(ALPHA_MASK));
+
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i *ptr = reinterpret_cast<__m256i*>(pixels + i);
+        const __m256i src = _mm256_loadu_si256(ptr);
+
+        __m256i alpha = _mm256_srli_epi32(src, 24);
+        alpha = _mm256_or_si256(alpha, _mm256_or_si256(_mm256_slli_epi32(alpha, 8), _mm256_slli_epi32(alpha, 16)));
+
+        const __m256i inverted = _mm256_subs_epu8(alpha, _mm256_andnot_si256(alpha_mask, src));
+
+        _mm256_storeu_si256(ptr, _mm256_or_si256(inverted, _mm256_and_si256(alpha_mask, src)));
+    }
+
+    return i;
+}
+}
+#endif
+
+#ifdef PIXELKERNELS_NEON
+namespace NEON
+{
+int scaleRgb(quint32 *pixels, int count, quint32 factor)
+{
+    const uint32x4_t alpha_mask = vdupq_n_u32(ALPHA_MASK);
+    const uint16x8_t mul = vdupq_n_u16(quint16(factor));
+    const uint16x8_t round = vdupq_n_u16(128);
+
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint32x4_t src = vld1q_u32(pixels + i);
+        const uint8x16_t bytes = vreinterpretq_u8_u32(src);
+
+        const uint16x8_t lo = vaddq_u16(vmulq_u16(vmovl_u8(vget_low_u8(bytes)), mul), round);
+        const uint16x8_t hi = vaddq_u16(vmulq_u16(vmovl_u8(vget_high_u8(bytes)), mul), round);
+
+        const uint32x4_t scaled = vreinterpretq_u32_u8(vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+
+        vst1q_u32(pixels + i, vbslq_u32(alpha_mask, src, scaled));
+    }
+
+    return i;
+}
+
+int grayscale(quint32 *pixels, int count)
+{
+    const uint32x4_t byte_mask = vdupq_n_u32(0xFF);
+    const uint32x4_t alpha_mask = vdupq_n_u32(ALPHA_MASK);
+
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint32x4_t src = vld1q_u32(pixels + i);
+
+        const uint32x4_t r = vandq_u32(vshrq_n_u32(src, 16), byte_mask);
+        const uint32x4_t g = vandq_u32(vshrq_n_u32(src, 8), byte_mask);
+        const uint32x4_t b = vandq_u32(src, byte_mask);
+
+        uint32x4_t gray = vmlaq_n_u32(vshlq_n_u32(g, 4), r, 11);
+        gray = vmlaq_n_u32(gray, b, 5);
+        gray = vshrq_n_u32(gray, 5);
+
+        gray = vorrq_u32(gray, vorrq_u32(vshlq_n_u32(gray, 8), vshlq_n_u32(gray, 16)));
+
+        vst1q_u32(pixels + i, vbslq_u32(alpha_mask, src, gray));
+    }
+
+    return i;
+}
+
+int invertRgb(quint32 *pixels, int count)
+{
+    const uint32x4_t alpha_mask = vdupq_n_u32(ALPHA_MASK);
+    const uint32x4_t rgb_mask = vdupq_n_u32(RGB_MASK);
+
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint32x4_t src = vld1q_u32(pixels + i);
+
+        uint32x4_t alpha = vshrq_n_u32(src, 24);
+        alpha = vorrq_u32(alpha, vorrq_u32(vshlq_n_u32(alpha, 8), vshlq_n_u32(alpha, 16)));
+
+        const uint8x16_t inverted = vqsubq_u8(vreinterpretq_u8_u32(alpha),
+                                              vreinterpretq_u8_u32(vandq_u32(src, rgb_mask)));
+
+        vst1q_u32(pixels + i, vbslq_u32(alpha_mask, src, vreinterpretq_u32_u8(inverted)));
+    }
+
+    return i;
+}
+}
+#endif
+
+inline quint32 fixedFactor(qreal factor)
+{
+    return quint32(qRound(qBound(qreal(0), factor, qreal(1)) * 256));
+}
+
+inline bool hasAVX2()
+{
+#ifdef PIXELKERNELS_AVX2
+    static const bool supported = AVX2::isSupported();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+bool prepareImage(QImage *image)
+{
+    if (!image || image->isNull())
+        return false;
+
+    if (image->format() != QImage::Format_ARGB32_Premultiplied)
+        *image = image->convertToFormat(QImage::Format_ARGB32_Premultiplied);
+
+    return !image->isNull();
+}
+
+template <typename Kernel>
+void forEachLine(QImage *image, Kernel kernel)
+{
+    const int width = image->width();
+    const int height = image->height();
+
+    //Process the whole buffer at once when lines are not padded.
+    if (image->bytesPerLine() == int(width * sizeof(quint32)))
+    {
+        kernel(reinterpret_cast<quint32*>(image->bits()), width * height);
+        return;
+    }
+
+    for (int y = 0; y < height; y++)
+        kernel(reinterpret_cast<quint32*>(image->scanLine(y)), width);
+}
+}
+
+void PixelKernels::scaleRgb(quint32 *pixels, int count, qreal factor)
+{
+    const quint32 fixed_factor = fixedFactor(factor);
+
+    int done = 0;
+
+#ifdef PIXELKERNELS_AVX2
+    if (hasAVX2())
+        done = AVX2::scaleRgb(pixels, count, fixed_factor);
+#endif
+#ifdef PIXELKERNELS_SSE2
+    done += SSE2::scaleRgb(pixels + done, count - done, fixed_factor);
+#endif
+#ifdef PIXELKERNELS_NEON
+    done += NEON::scaleRgb(pixels + done, count - done, fixed_factor);
+#endif
+
+    Scalar::scaleRgb(pixels + done, count - done, fixed_factor);
+}
+
+void PixelKernels::grayscale(quint32 *pixels, int count)
+{
+    int done = 0;
+
+#ifdef PIXELKERNELS_AVX2
+    if (hasAVX2())
+        done = AVX2::grayscale(pixels, count);
+#endif
+#ifdef PIXELKERNELS_SSE2
+    done += SSE2::grayscale(pixels + done, count - done);
+#endif
+#ifdef PIXELKERNELS_NEON
+    done += NEON::grayscale(pixels + done, count - done);
+#endif
+
+    Scalar::grayscale(pixels + done, count - done);
+}
+
+void PixelKernels::invertRgb(quint32 *pixels, int count)
+{
+    int done = 0;
+
+#ifdef PIXELKERNELS_AVX2
+    if (hasAVX2())
+        done = AVX2::invertRgb(pixels, count);
+#endif
+#ifdef PIXELKERNELS_SSE2
+    done += SSE2::invertRgb(pixels + done, count - done);
+#endif
+#ifdef PIXELKERNELS_NEON
+    done += NEON::invertRgb(pixels + done, count - done);
+#endif
+
+    Scalar::invertRgb(pixels + done, count - done);
+}
+
+void PixelKernels::scaleRgb(QImage *image, qreal factor)
+{
+    if (!prepareImage(image))
+        return;
+
+    forEachLine(image, [=](quint32 *pixels, int count){
+        scaleRgb(pixels, count, factor);
+    });
+}
+
+void PixelKernels::grayscale(QImage *image)
+{
+    if (!prepareImage(image))
+        return;
+
+    forEachLine(image, [](quint32 *pixels, int count){
+        grayscale(pixels, count);
+    });
+}
+
+void PixelKernels::invertRgb(QImage *image)
+{
+    if (!prepareImage(image))
+        return;
+
+    forEachLine(image, [](quint32 *pixels, int count){
+        invertRgb(pixels, count);
+    });
+}
+
+QPixmap PixelKernels::grayedPixmap(const QPixmap &pixmap)
+{
+    if (pixmap.isNull())
+        return QPixmap();
+
+    QImage image = pixmap.toImage();
+
+    grayscale(&image);
+
+    return QPixmap::fromImage(image);
+}
@@ -0,0 +1,59 @@
+/*
+The MIT License (MIT)
+
+Copyright © 2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef PIXELKERNELS_H
+#define PIXELKERNELS_H
+
+#include <QtCore>
+#include <QtGui>
+
+#include "qgoodwindow_global.h"
+
+//\cond HIDDEN_SYMBOLS
+//Pixel kernels used to derive the grayed, dimmed and inverted variants of
+//icons and caption buttons glyphs. They work on premultiplied ARGB32 pixels,
+//keep the alpha channel untouched and are dispatched to AVX2, SSE2 or NEON
+//when available, falling back to scalar code otherwise.
+namespace PixelKernels
+{
+//Multiply red, green and blue by factor, factor is clamped to [0, 1].
+QGOODWINDOW_SHARED_EXPORT void scaleRgb(quint32 *pixels, int count, qreal factor);
+
+//Replace red, green and blue by the same luminance computed by qGray().
+QGOODWINDOW_SHARED_EXPORT void grayscale(quint32 *pixels, int count);
+
+//Invert red, green and blue keeping the pixels premultiplied.
+QGOODWINDOW_SHARED_EXPORT void invertRgb(quint32 *pixels, int count);
+
+//Same as above, but for a whole image converted to premultiplied ARGB32 as needed.
+QGOODWINDOW_SHARED_EXPORT void scaleRgb(QImage *image, qreal factor);
+QGOODWINDOW_SHARED_EXPORT void grayscale(QImage *image);
+QGOODWINDOW_SHARED_EXPORT void invertRgb(QImage *image);
+
+//Returns a grayed copy of pixmap.
+QGOODWINDOW_SHARED_EXPORT QPixmap grayedPixmap(const QPixmap &pixmap);
+}
+//\endcond
+
+#endif // PIXELKERNELS_H
@@ -1,53 +1,105 @@
-/*
-The MIT License (MIT)
-
-Copyright © 2022-2023 Antonio Dias (https://github.com/antonypro)
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#include "qgoodstateholder.h"
-
-QGoodStateHolder *QGoodStateHolder::instance()
-{
-	static QGoodStateHolder instance;
-	return &instance;
-}
-
-QGoodStateHolder::QGoodStateHolder() : QObject()
-{
-	m_dark = false;
-}
-
-QGoodStateHolder::~QGoodStateHolder()
-{
-
-}
-
-bool QGoodStateHolder::isCurrentThemeDark() const
-{
-	return m_dark;
-}
-
-void QGoodStateHolder::setCurrentThemeDark(bool dark)
-{
-	m_dark = dark;
-
-    Q_EMIT currentThemeChanged();
-}
+/*
+The MIT License (MIT)
+
+Copyright © 2022-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "qgoodstateholder.h"
+
+QGoodStateHolder *QGoodStateHolder::instance()
+{
+	static QGoodStateHolder instance;
+	return &instance;
+}
+
+QGoodStateHolder::QGoodStateHolder() : QObject()
+{
+	m_dark = false;
+    m_dark_set = false;
+    m_transaction_pending = false;
+}
+
+QGoodStateHolder::~QGoodStateHolder()
+{
+
+}
+
+bool QGoodStateHolder::isCurrentThemeDark() const
+{
+	return m_dark;
+}
+
+void QGoodStateHolder::setCurrentThemeDark(bool dark)
+{
+    //Every window forwards the same system theme change,
+    //only the first one for a given theme does any work.
+    if (m_dark_set && m_dark == dark)
+        return;
+
+	m_dark = dark;
+    m_dark_set = true;
+
+    beginThemeTransaction();
+
+    Q_EMIT currentThemeChanged();
+
+    endThemeTransaction();
+}
+
+void QGoodStateHolder::beginThemeTransaction()
+{
+    if (m_transaction_pending)
+        return;
+
+    //Suspend painting of all visible windows while the style,
+    //palette and title bars are updated.
+    for (QWidget *widget : QApplication::topLevelWidgets())
+    {
+        if (widget->isVisible() && widget->updatesEnabled())
+        {
+            widget->setUpdatesEnabled(false);
+            m_suspended_widgets.append(widget);
+        }
+    }
+}
+
+void QGoodStateHolder::endThemeTransaction()
+{
+    if (m_transaction_pending)
+        return;
+
+    m_transaction_pending = true;
+
+    //Title bars apply their theme on the next event loop iteration,
+    //so resume after them, re-enabling updates repaints each window once.
+    QTimer::singleShot(0, this, [=]{
+        m_transaction_pending = false;
+
+        const QList<QPointer<QWidget>> widgets = m_suspended_widgets;
+        m_suspended_widgets.clear();
+
+        for (const QPointer<QWidget> &widget : widgets)
+        {
+            if (widget)
+                widget->setUpdatesEnabled(true);
+        }
+    });
+}
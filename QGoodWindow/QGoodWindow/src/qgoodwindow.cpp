@@ -1,4556 +1,5503 @@
-/*
-The MIT License (MIT)
-
-Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#if defined QGOODWINDOW && defined __linux__
-#include <gtk/gtk.h>
-#endif
-
-#include "common.h"
-#include "qgoodwindow.h"
-#include "shadow.h"
-#include "qgooddialog.h"
-#include "../version/version.h"
-
-#ifndef QGOODWINDOW
-#ifdef Q_OS_WIN
-#undef Q_OS_WIN
-#endif
-#ifdef Q_OS_LINUX
-#undef Q_OS_LINUX
-#endif
-#ifdef Q_OS_MAC
-#undef Q_OS_MAC
-#endif
-#endif
-
-#ifdef QGOODWINDOW
-#define FIXED_WIDTH(widget) (widget->minimumWidth() >= widget->maximumWidth())
-#define FIXED_HEIGHT(widget) (widget->minimumHeight() >= widget->maximumHeight())
-#define FIXED_SIZE(widget) (FIXED_WIDTH(widget) && FIXED_HEIGHT(widget))
-#endif
-
-#ifdef Q_OS_WIN
-
-#ifdef QT_VERSION_QT5
-#include <QtWinExtras>
-#endif
-#include <windows.h>
-#include <windowsx.h>
-#include <dwmapi.h>
-
-namespace QGoodWindowUtils
-{
-class ParentWindow : public QWidget
-{
-public:
-    explicit ParentWindow(QWidget *parent) : QWidget(parent, Qt::Window)
-    {
-
-    }
-
-private:
-    bool event(QEvent *event)
-    {
-        switch (event->type())
-        {
-        case QEvent::ChildRemoved:
-        {
-            QWidget *parent_widget = parentWidget();
-
-            if (parent_widget)
-                parent_widget->activateWindow();
-
-            delete this;
-            return true;
-        }
-        default:
-            break;
-        }
-
-        return QWidget::event(event);
-    }
-};
-
-class NativeEventFilter : public QAbstractNativeEventFilter
-{
-public:
-    NativeEventFilter(QGoodWindow *gw)
-    {
-        m_gw = gw;
-        m_gw_hwnd = HWND(m_gw->winId());
-    }
-
-    bool nativeEventFilter(const QByteArray &eventType, void *message, qgoodintptr *result) override
-    {
-        Q_UNUSED(eventType)
-
-        MSG *msg = static_cast<MSG*>(message);
-
-        if (!IsWindowVisible(msg->hwnd))
-            return false;
-
-        if (!IsChild(m_gw_hwnd, msg->hwnd))
-            return false;
-
-        switch (msg->message)
-        {
-        case WM_NCHITTEST:
-        {
-            QPoint pos = QPoint(GET_X_LPARAM(msg->lParam), GET_Y_LPARAM(msg->lParam));
-
-            HRESULT lresult = HRESULT(m_gw->ncHitTest(pos.x(), pos.y()));
-
-            if (lresult == HTNOWHERE)
-                break;
-
-            //If region not contains the mouse, pass the
-            //WM_NCHITTEST event to main window.
-            *result = HTTRANSPARENT;
-            return true;
-        }
-        case WM_KEYDOWN:
-        {
-            if (GetKeyState(VK_SHIFT) & 0x8000)
-            {
-                switch (msg->wParam)
-                {
-                case VK_TAB:
-                    //Prevent that SHIFT+TAB crashes the application.
-                    return true;
-                default:
-                    break;
-                }
-            }
-
-            break;
-        }
-        case WM_SYSKEYDOWN:
-        case WM_SYSKEYUP:
-        {
-            //Pass to main window...
-
-            if ((GetKeyState(VK_SHIFT) & 0x8000) && msg->wParam == VK_F10)
-            {
-                // ...when SHIFT+F10 is pressed.
-                SendMessageW(m_gw_hwnd, msg->message, msg->wParam, msg->lParam);
-                return true;
-            }
-
-            if ((GetKeyState(VK_MENU) & 0x8000) && msg->wParam == VK_SPACE)
-            {
-                // ...when ALT+SPACE is pressed.
-                SendMessageW(m_gw_hwnd, msg->message, msg->wParam, msg->lParam);
-                return true;
-            }
-
-            break;
-        }
-        default:
-            break;
-        }
-
-        return false;
-    }
-
-private:
-    QPointer<QGoodWindow> m_gw;
-    HWND m_gw_hwnd;
-};
-
-inline bool isWinXOrGreater(DWORD major_version, DWORD minor_version, DWORD build_number)
-{
-    bool is_win_x_or_greater = false;
-
-    typedef NTSTATUS(WINAPI *tRtlGetVersion)(LPOSVERSIONINFOEXW);
-    tRtlGetVersion pRtlGetVersion = tRtlGetVersion(QLibrary::resolve("ntdll", "RtlGetVersion"));
-
-    if (pRtlGetVersion)
-    {
-        OSVERSIONINFOEXW os_info;
-        memset(&os_info, 0, sizeof(OSVERSIONINFOEXW));
-        os_info.dwOSVersionInfoSize = sizeof(OSVERSIONINFOEXW);
-        NTSTATUS status = pRtlGetVersion(&os_info);
-        if (status == 0)
-        {
-            is_win_x_or_greater = (os_info.dwMajorVersion >= major_version &&
-                                   os_info.dwMinorVersion >= minor_version &&
-                                   os_info.dwBuildNumber >= build_number);
-        }
-    }
-
-    return is_win_x_or_greater;
-}
-
-inline bool isWin11OrGreater()
-{
-    bool is_win_11_or_greater = isWinXOrGreater(10, 0, 22000);
-
-    return is_win_11_or_greater;
-}
-}
-#endif
-
-#ifdef Q_OS_LINUX
-
-#include <QtTest/QtTest>
-#ifdef QT_VERSION_QT5
-#include <QtX11Extras/QX11Info>
-#endif
-#ifdef QT_VERSION_QT6
-#include <QtGui/private/qtx11extras_p.h>
-#endif
-#include <X11/Xlib.h>
-#include <X11/cursorfont.h>
-#include <xcb/xcb.h>
-
-namespace QGoodWindowUtils
-{
-QList<QGoodWindow*> m_gw_list;
-
-GtkSettings *m_settings = nullptr;
-
-void themeChangeNotification()
-{
-    for (QGoodWindow *gw : m_gw_list)
-    {
-        QTimer::singleShot(0, gw, &QGoodWindow::themeChanged);
-    }
-}
-
-void registerThemeChangeNotification()
-{
-    if (!m_settings)
-    {
-        m_settings = gtk_settings_get_default();
-        g_signal_connect(m_settings, "notify::gtk-theme-name", themeChangeNotification, nullptr);
-    }
-}
-}
-#endif
-
-#ifdef Q_OS_MAC
-
-#include "macosnative.h"
-
-Notification notification;
-
-namespace QGoodWindowUtils
-{
-bool m_theme_change_registered = false;
-}
-#endif
-
-#ifndef Q_OS_WIN
-#define GOODPARENT(parent) parent
-#else
-#define GOODPARENT(parent) nullptr
-#endif
-
-QGoodWindow::QGoodWindow(QWidget *parent, const QColor &clear_color) : QMainWindow(GOODPARENT(parent))
-{
-#ifdef QGOODWINDOW
-    qRegisterMetaType<QGoodWindow::CaptionButtonState>("QGoodWindow::CaptionButtonState");
-
-    m_parent = parent;
-
-    m_is_using_system_borders = shouldBordersBeDrawnBySystem();
-
-    m_dark = isSystemThemeDark();
-
-    m_title_bar_height = 30;
-    m_icon_width = 0;
-
-    m_is_caption_button_pressed = false;
-    m_last_caption_button_hovered = -1;
-    m_caption_button_pressed = -1;
-
-    m_hover_timer = new QTimer(this);
-    m_hover_timer->setSingleShot(true);
-    m_hover_timer->setInterval(300);
-
-    m_pixel_ratio = qreal(1);
-#endif
-#ifdef Q_OS_WIN
-    m_clear_color = clear_color;
-#else
-    Q_UNUSED(clear_color)
-#endif
-#ifdef Q_OS_WIN
-    m_minimum_width = 0;
-    m_minimum_height = 0;
-    m_maximum_width = 0;
-    m_maximum_height = 0;
-#endif
-#if defined Q_OS_LINUX || defined Q_OS_MAC
-    m_last_move_button = -1;
-#endif
-#ifdef Q_OS_MAC
-    m_is_native_caption_buttons_visible_on_mac = true;
-    m_mouse_button_pressed = false;
-    m_on_animate_event = false;
-#endif
-#ifdef Q_OS_WIN
-    m_window_ready_for_resize = false;
-    m_closed = false;
-    m_visible = false;
-    m_self_generated_close_event = false;
-
-    m_timer_move = new QTimer(this);
-    connect(m_timer_move, &QTimer::timeout, this, [=]{
-        QScreen *screen = screenForWindow(m_hwnd);
-
-        if (windowHandle()->screen() != screen)
-            updateScreen(screen);
-    });
-    m_timer_move->setSingleShot(true);
-    m_timer_move->setInterval(0);
-
-    m_window_state = Qt::WindowNoState;
-
-    m_is_menu_visible = false;
-    m_timer_menu = new QTimer(this);
-    m_timer_menu->setSingleShot(true);
-    m_timer_menu->setInterval(qApp->doubleClickInterval());
-
-    m_active_state = false;
-
-    m_last_state = Qt::WindowNoState;
-
-    m_self_generated_show_event = false;
-
-    m_native_event = nullptr;
-
-    HINSTANCE hInstance = GetModuleHandleW(nullptr);
-
-    HWND parent_hwnd = nullptr;
-
-    if (m_parent)
-        parent_hwnd = HWND(m_parent->winId());
-
-    WNDCLASSEXW wcx;
-    memset(&wcx, 0, sizeof(WNDCLASSEXW));
-    wcx.cbSize = sizeof(WNDCLASSEXW);
-    wcx.style = CS_HREDRAW | CS_VREDRAW;
-    wcx.hInstance = hInstance;
-    wcx.lpfnWndProc = WNDPROC(WndProc);
-    wcx.cbClsExtra = 0;
-    wcx.cbWndExtra = 0;
-    wcx.hCursor	= LoadCursorW(nullptr, IDC_ARROW);
-    wcx.hbrBackground = HBRUSH(CreateSolidBrush(RGB(m_clear_color.red(),
-                                                    m_clear_color.green(),
-                                                    m_clear_color.blue())));
-
-    wcx.lpszClassName = L"QGoodWindowClass";
-
-    RegisterClassExW(&wcx);
-
-    m_hwnd = CreateWindowW(wcx.lpszClassName, nullptr,
-                           WS_OVERLAPPEDWINDOW | WS_CLIPCHILDREN | WS_CLIPSIBLINGS,
-                           CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT,
-                           parent_hwnd, nullptr, hInstance, nullptr);
-
-    if (!m_hwnd)
-    {
-        QMessageBox::critical(nullptr, "Error", "Error creating window");
-        return;
-    }
-
-    SetWindowLongPtrW(m_hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(this));
-
-    //Fix QApplication::exit() crash.
-    connect(qApp, &QApplication::aboutToQuit, this, &QGoodWindow::closeGW);
-
-    m_is_win_11_or_greater = QGoodWindowUtils::isWin11OrGreater();
-
-    m_window_handle = QWindow::fromWinId(WId(m_hwnd));
-
-    initGW();
-
-    m_helper_widget = new QWidget();
-
-    //Fix bug that prevents window to close on Qt 6.
-#ifdef QT_VERSION_QT6
-    m_helper_window = new QWindow();
-    m_helper_window->setFlags(Qt::Window | Qt::FramelessWindowHint | Qt::Tool);
-    m_helper_window->setGeometry(0, 0, 1, 1);
-    m_helper_window->setOpacity(0);
-#endif
-    if (!m_is_using_system_borders)
-    {
-        QGoodWindow *parent = m_parent ? this : nullptr;
-        m_shadow = new Shadow(qintptr(m_hwnd), parent, parent);
-        m_shadow->createWinId();
-        connect(m_shadow, &Shadow::showSignal, this, &QGoodWindow::moveShadow);
-    }
-
-    m_main_window = static_cast<QMainWindow*>(this);
-    m_main_window->createWinId();
-    m_main_window->installEventFilter(this);
-
-    QWidget *widget_proxy = new QWidget(m_main_window);
-    m_main_window->setCentralWidget(widget_proxy);
-
-    m_proxy_widget = new QWidget(widget_proxy);
-
-    QScreen *screen = screenForWindow(m_hwnd);
-    m_pixel_ratio = screen->devicePixelRatio();
-    setCurrentScreen(screen);
-
-    if (m_parent)
-        m_parent->installEventFilter(this);
-
-    if (!m_native_event)
-    {
-        m_native_event = new QGoodWindowUtils::NativeEventFilter(this);
-        qApp->installNativeEventFilter(m_native_event);
-    }
-
-    if (m_parent)
-    {
-        disableMinimize();
-        disableMaximize();
-    }
-
-    //Fix that hides native title bar.
-    frameChanged();
-
-#ifdef QT_VERSION_QT5
-    if (!QtWin::isCompositionEnabled())
-    {
-        disableCaption();
-        frameChanged();
-    }
-#endif
-
-#endif
-#ifdef Q_OS_LINUX
-    m_resize_move = false;
-    m_resize_move_started = false;
-
-    installEventFilter(this);
-    setMouseTracking(true);
-
-    createWinId();
-
-    m_pixel_ratio = windowHandle()->screen()->devicePixelRatio();
-
-    QGoodWindowUtils::registerThemeChangeNotification();
-
-    QGoodWindowUtils::m_gw_list.append(this);
-
-    //Fake window flags.
-    m_window_flags = Qt::Window | Qt::FramelessWindowHint;
-
-    if (!m_parent)
-    {
-        QMainWindow::setWindowFlags(Qt::Window | Qt::FramelessWindowHint);
-        m_window_flags |= Qt::WindowMinMaxButtonsHint;
-    }
-    else
-    {
-        QMainWindow::setWindowFlags(Qt::Window | Qt::FramelessWindowHint | Qt::Tool);
-    }
-
-    m_shadow = new Shadow(qintptr(nullptr), this, this);
-    m_shadow->installEventFilter(this);
-    m_shadow->setMouseTracking(true);
-    connect(m_shadow, &Shadow::showSignal, this, &QGoodWindow::sizeMoveBorders);
-#endif
-#ifdef Q_OS_MAC
-    installEventFilter(this);
-    setMouseTracking(true);
-
-    createWinId();
-
-    style_ptr = new macOSNative::Style();
-
-    macOSNative::Style *style = static_cast<macOSNative::Style*>(style_ptr);
-    style->m_is_dialog = (m_parent != nullptr);
-
-    notification.addWindow(this);
-
-    if (!QGoodWindowUtils::m_theme_change_registered)
-    {
-        QGoodWindowUtils::m_theme_change_registered = true;
-        macOSNative::registerThemeChangeNotification();
-    }
-
-    if (!m_parent)
-        QMainWindow::setWindowFlags(Qt::Window);
-    else
-        QMainWindow::setWindowFlags(Qt::Dialog);
-#endif
-#ifdef QGOODWINDOW
-    auto func_default_name_icon = [=]{
-        if (windowTitle().isEmpty())
-        {
-            setWindowTitle(qApp->applicationName());
-            QTimer::singleShot(0, this, [=]{Q_EMIT windowTitleChanged(windowTitle());});
-        }
-
-        if (windowIcon().isNull())
-        {
-            setWindowIcon(qApp->style()->standardIcon(QStyle::SP_DesktopIcon));
-            QTimer::singleShot(0, this, [=]{Q_EMIT windowIconChanged(windowIcon());});
-        }
-    };
-#ifdef Q_OS_WIN
-    QTimer::singleShot(0, this, func_default_name_icon);
-#else
-    func_default_name_icon();
-#endif
-#endif
-}
-
-QGoodWindow::~QGoodWindow()
-{
-#ifdef Q_OS_WIN
-    if (!m_closed)
-    {
-        //Last chance to close window.
-        close();
-    }
-
-    if (m_native_event)
-    {
-        qApp->removeNativeEventFilter(m_native_event);
-        delete m_native_event;
-        m_native_event = nullptr;
-    }
-#endif
-#ifdef Q_OS_LINUX
-    QGoodWindowUtils::m_gw_list.removeAll(this);
-#endif
-#ifdef Q_OS_MAC
-    delete static_cast<macOSNative::Style*>(style_ptr);
-    notification.removeWindow(this);
-#endif
-#if defined Q_OS_LINUX || defined Q_OS_MAC
-    removeEventFilter(this);
-#endif
-}
-
-void QGoodWindow::themeChanged()
-{
-#ifdef QGOODWINDOW
-    bool dark = isSystemThemeDark();
-
-    if (m_dark != dark)
-    {
-        m_dark = dark;
-        Q_EMIT systemThemeChanged();
-    }
-#endif
-}
-
-WId QGoodWindow::winId() const
-{
-#ifdef Q_OS_WIN
-    return WId(m_hwnd);
-#else
-    return QMainWindow::winId();
-#endif
-}
-
-void QGoodWindow::setWindowFlags(Qt::WindowFlags type)
-{
-#ifdef QGOODWINDOW
-    Q_UNUSED(type)
-#else
-    QMainWindow::setWindowFlags(type);
-#endif
-}
-
-Qt::WindowFlags QGoodWindow::windowFlags() const
-{
-#if defined Q_OS_WIN
-    HWND hwnd = HWND(winId());
-
-    Qt::WindowFlags flags;
-    flags |= Qt::Window;
-    flags |= Qt::WindowTitleHint;
-    flags |= Qt::WindowSystemMenuHint;
-
-    if (GetWindowLongW(hwnd, GWL_STYLE) & WS_MINIMIZEBOX)
-        flags |= Qt::WindowMinimizeButtonHint;
-
-    if (GetWindowLongW(hwnd, GWL_STYLE) & WS_MAXIMIZEBOX)
-        flags |= Qt::WindowMaximizeButtonHint;
-
-    flags |= Qt::WindowCloseButtonHint;
-
-    return flags;
-#elif defined Q_OS_LINUX
-    return m_window_flags;
-#else
-    return QMainWindow::windowFlags();
-#endif
-}
-
-/*** QGOODWINDOW FUNCTIONS BEGIN ***/
-
-QString QGoodWindow::version()
-{
-    return QStringLiteral(QGOODWINDOW_VERSION);
-}
-
-void QGoodWindow::setup()
-{
-#ifdef QGOODWINDOW
-    //Init resources
-    Q_INIT_RESOURCE(qgoodwindow_style);
-#ifdef QGOODCENTRALWIDGET
-    Q_INIT_RESOURCE(qgoodcentralwidget_icons);
-#endif
-
-#ifdef Q_OS_LINUX
-    qputenv("XDG_SESSION_TYPE", "xcb");
-    qputenv("QT_QPA_PLATFORM", "xcb");
-
-    int argc = 0;
-    char **argv = nullptr;
-    gtk_init(&argc, &argv);
-#endif
-
-#ifndef Q_OS_MAC
-
-#ifdef Q_OS_WIN
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-    if (QGoodWindowUtils::isWinXOrGreater(10, 0, 15063)) //Windows 10 version 1703 or later.
-    {
-        static const qintptr vDPI_AWARENESS_CONTEXT = 0;
-        static const qintptr vDPI_AWARENESS_CONTEXT_UNAWARE = ((vDPI_AWARENESS_CONTEXT)-1);
-        static const qintptr vDPI_AWARENESS_CONTEXT_SYSTEM_AWARE = ((vDPI_AWARENESS_CONTEXT)-2);
-        static const qintptr vDPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE = ((vDPI_AWARENESS_CONTEXT)-3);
-        static const qintptr vDPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2 = ((vDPI_AWARENESS_CONTEXT)-4);
-        static const qintptr vDPI_AWARENESS_CONTEXT_UNAWARE_GDISCALED = ((vDPI_AWARENESS_CONTEXT)-5);
-
-        Q_UNUSED(vDPI_AWARENESS_CONTEXT_UNAWARE)
-        Q_UNUSED(vDPI_AWARENESS_CONTEXT_SYSTEM_AWARE)
-        Q_UNUSED(vDPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE)
-        Q_UNUSED(vDPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2)
-        Q_UNUSED(vDPI_AWARENESS_CONTEXT_UNAWARE_GDISCALED)
-
-        typedef BOOL(*tSetProcessDpiAwarenessContext)(HANDLE);
-        tSetProcessDpiAwarenessContext pSetProcessDpiAwarenessContext =
-                tSetProcessDpiAwarenessContext(QLibrary::resolve("user32", "SetProcessDpiAwarenessContext"));
-
-        if (pSetProcessDpiAwarenessContext)
-            pSetProcessDpiAwarenessContext(HANDLE(vDPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2));
-    }
-#endif
-#endif
-
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-    qputenv("QT_ENABLE_HIGHDPI_SCALING", "1");
-#elif QT_VERSION >= QT_VERSION_CHECK(5, 6, 0)
-    QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
-#elif QT_VERSION >= QT_VERSION_CHECK(5, 4, 0)
-    qputenv("QT_DEVICE_PIXEL_RATIO", "auto");
-#endif
-
-#endif
-
-#ifdef Q_OS_MAC
-    QApplication::setAttribute(Qt::AA_DontUseNativeDialogs);
-#endif
-#endif
-}
-
-bool QGoodWindow::isSystemThemeDark()
-{
-    bool dark = false;
-#ifdef Q_OS_WIN
-    typedef LONG(WINAPI *tRegGetValueW)(HKEY,LPCWSTR,LPCWSTR,DWORD,LPDWORD,PVOID,LPDWORD);
-    tRegGetValueW pRegGetValueW = tRegGetValueW(QLibrary::resolve("advapi32", "RegGetValueW"));
-
-    if (pRegGetValueW)
-    {
-        DWORD value;
-        DWORD size = sizeof(value);
-        if (pRegGetValueW(HKEY_CURRENT_USER, L"Software\\Microsoft\\Windows\\CurrentVersion\\Themes\\Personalize",
-                          L"AppsUseLightTheme", RRF_RT_DWORD, nullptr, &value, &size) == ERROR_SUCCESS)
-            dark = (value == 0);
-    }
-#endif
-#ifdef Q_OS_LINUX
-    GtkSettings *settings = gtk_settings_get_default();
-    gchar *theme_name;
-    g_object_get(settings, "gtk-theme-name", &theme_name, nullptr);
-    dark = QString(theme_name).endsWith("Dark", Qt::CaseInsensitive);
-#endif
-#ifdef Q_OS_MAC
-    dark = QString(macOSNative::themeName()).endsWith("Dark", Qt::CaseInsensitive);
-#endif
-    return dark;
-}
-
-bool QGoodWindow::shouldBordersBeDrawnBySystem()
-{
-    bool drawn_by_system = true;
-#ifdef Q_OS_WIN
-    drawn_by_system = QGoodWindowUtils::isWin11OrGreater();
-#endif
-#ifdef Q_OS_LINUX
-    drawn_by_system = false;
-#endif
-    return drawn_by_system;
-}
-
-int QGoodWindow::execDialog(QDialog *dialog, QGoodWindow *child_gw, QGoodWindow *parent_gw)
-{
-#ifdef QGOODWINDOW
-    return QGoodDialog::exec(dialog, child_gw, parent_gw);
-#else
-    Q_UNUSED(child_gw)
-    Q_UNUSED(parent_gw)
-    return dialog->exec();
-#endif
-}
-
-void QGoodWindow::setAppDarkTheme()
-{
-    qApp->setStyle(new DarkStyle());
-    qApp->style()->setObjectName("fusion");
-}
-
-void QGoodWindow::setAppLightTheme()
-{
-    qApp->setStyle(new LightStyle());
-    qApp->style()->setObjectName("fusion");
-}
-
-QGoodStateHolder *QGoodWindow::qGoodStateHolderInstance()
-{
-    return QGoodStateHolder::instance();
-}
-
-void QGoodWindow::setNativeCaptionButtonsVisibleOnMac(bool visible)
-{
-#ifdef Q_OS_MAC
-    m_is_native_caption_buttons_visible_on_mac = visible;
-
-    macOSNative::Style *style = static_cast<macOSNative::Style*>(style_ptr);
-    style->m_is_native_caption_buttons_visible = m_is_native_caption_buttons_visible_on_mac;
-    macOSNative::setStyle(long(winId()), style);
-
-    Q_EMIT captionButtonsVisibilityChangedOnMacOS();
-#else
-    Q_UNUSED(visible)
-#endif
-}
-
-bool QGoodWindow::isNativeCaptionButtonsVisibleOnMac() const
-{
-#ifdef Q_OS_MAC
-    return m_is_native_caption_buttons_visible_on_mac;
-#else
-    return false;
-#endif
-}
-
-QRect QGoodWindow::titleBarButtonsRectOnMacOS() const
-{
-#ifdef Q_OS_MAC
-    int x, y, w, h;
-    macOSNative::titleBarButtonsRect(long(winId()), &x, &y, &w, &h);
-    return QRect(x, y, w, h);
-#else
-    return QRect();
-#endif
-}
-
-void QGoodWindow::setTitleBarHeight(int height)
-{
-#ifdef QGOODWINDOW
-    m_title_bar_height = height;
-#else
-    Q_UNUSED(height)
-#endif
-}
-
-void QGoodWindow::setIconWidth(int width)
-{
-#ifdef QGOODWINDOW
-    m_icon_width = width;
-#else
-    Q_UNUSED(width)
-#endif
-}
-
-int QGoodWindow::titleBarHeight() const
-{
-#ifdef QGOODWINDOW
-    return m_title_bar_height;
-#else
-    return 0;
-#endif
-}
-
-int QGoodWindow::iconWidth() const
-{
-#ifdef QGOODWINDOW
-    return m_icon_width;
-#else
-    return 0;
-#endif
-}
-
-QRect QGoodWindow::titleBarRect() const
-{
-#ifdef QGOODWINDOW
-    if (!m_is_using_system_borders)
-    {
-        if (windowState().testFlag(Qt::WindowNoState))
-        {
-            return QRect(1, 1, width() - 2, titleBarHeight());
-        }
-        else
-        {
-            return QRect(0, 0, width(), titleBarHeight());
-        }
-    }
-    else
-    {
-        return QRect(0, 0, width(), titleBarHeight());
-    }
-#else
-    return QRect();
-#endif
-}
-
-void QGoodWindow::setTitleBarMask(const QRegion &mask)
-{
-#ifdef QGOODWINDOW
-    m_title_bar_mask = mask;
-#else
-    Q_UNUSED(mask)
-#endif
-}
-
-void QGoodWindow::setMinimizeMask(const QRegion &mask)
-{
-#ifdef QGOODWINDOW
-    m_min_mask = mask;
-#else
-    Q_UNUSED(mask)
-#endif
-}
-
-void QGoodWindow::setMaximizeMask(const QRegion &mask)
-{
-#ifdef QGOODWINDOW
-    m_max_mask = mask;
-#else
-    Q_UNUSED(mask)
-#endif
-}
-
-void QGoodWindow::setCloseMask(const QRegion &mask)
-{
-#ifdef QGOODWINDOW
-    m_cls_mask = mask;
-#else
-    Q_UNUSED(mask)
-#endif
-}
-
-QRegion QGoodWindow::titleBarMask() const
-{
-#ifdef QGOODWINDOW
-    return m_title_bar_mask;
-#else
-    return QRegion();
-#endif
-}
-
-QRegion QGoodWindow::minimizeMask() const
-{
-#ifdef QGOODWINDOW
-    return m_min_mask;
-#else
-    return QRegion();
-#endif
-}
-
-QRegion QGoodWindow::maximizeMask() const
-{
-#ifdef QGOODWINDOW
-    return m_max_mask;
-#else
-    return QRegion();
-#endif
-}
-
-QRegion QGoodWindow::closeMask() const
-{
-#ifdef QGOODWINDOW
-    return m_cls_mask;
-#else
-    return QRegion();
-#endif
-}
-/*** QGOODWINDOW FUNCTIONS END ***/
-
-void QGoodWindow::setCentralWidget(QWidget *widget)
-{
-#ifdef Q_OS_WIN
-    if (m_proxy_widget->layout())
-        delete m_proxy_widget->layout();
-
-    QHBoxLayout *layout = new QHBoxLayout(m_proxy_widget);
-    layout->setContentsMargins(0, 0, 0, 0);
-    layout->addWidget(widget);
-
-    m_central_widget = widget;
-#else
-    QMainWindow::setCentralWidget(widget);
-#endif
-}
-
-QWidget *QGoodWindow::centralWidget() const
-{
-#ifdef Q_OS_WIN
-    return m_central_widget;
-#else
-    return QMainWindow::centralWidget();
-#endif
-}
-
-QSize QGoodWindow::sizeHint() const
-{
-#ifdef Q_OS_WIN
-    if (!m_central_widget)
-        return QMainWindow::sizeHint();
-
-    return m_central_widget->sizeHint();
-#else
-    return QMainWindow::sizeHint();
-#endif
-}
-
-QSize QGoodWindow::minimumSizeHint() const
-{
-#ifdef Q_OS_WIN
-    if (!m_central_widget)
-        return QMainWindow::minimumSizeHint();
-
-    return m_central_widget->minimumSizeHint();
-#else
-    return QMainWindow::minimumSizeHint();
-#endif
-}
-
-void QGoodWindow::setFixedSize(int w, int h)
-{
-#ifdef Q_OS_WIN
-    bool already_fixed = FIXED_SIZE(this);
-
-    setMinimumWidth(w);
-    setMaximumWidth(w);
-
-    setMinimumHeight(h);
-    setMaximumHeight(h);
-
-    if (!already_fixed)
-    {
-        if (!m_parent)
-            disableMinimize();
-
-        disableMaximize();
-    }
-
-    resize(w, h);
-#else
-#ifdef Q_OS_LINUX
-    m_window_flags ^= Qt::WindowMaximizeButtonHint;
-#endif
-    QMainWindow::setFixedSize(w, h);
-#endif
-}
-
-void QGoodWindow::setFixedSize(const QSize &size)
-{
-#if defined Q_OS_WIN
-    setFixedSize(size.width(), size.height());
-#else
-    QMainWindow::setFixedSize(size);
-#endif
-}
-
-void QGoodWindow::setMinimumSize(const QSize &size)
-{
-#ifdef Q_OS_WIN
-    setMinimumWidth(size.width());
-    setMinimumHeight(size.height());
-#else
-    QMainWindow::setMinimumSize(size);
-#endif
-}
-
-void QGoodWindow::setMaximumSize(const QSize &size)
-{
-#ifdef Q_OS_WIN
-    setMaximumWidth(size.width());
-    setMaximumHeight(size.height());
-#else
-    QMainWindow::setMaximumSize(size);
-#endif
-}
-
-void QGoodWindow::setMinimumWidth(int w)
-{
-#ifdef Q_OS_WIN
-    m_minimum_width = qMax(w, 0);
-#else
-    QMainWindow::setMinimumWidth(w);
-#endif
-}
-
-void QGoodWindow::setMinimumHeight(int h)
-{
-#ifdef Q_OS_WIN
-    m_minimum_height = qMax(h, 0);
-#else
-    QMainWindow::setMinimumHeight(h);
-#endif
-}
-
-void QGoodWindow::setMaximumWidth(int w)
-{
-#ifdef Q_OS_WIN
-    m_maximum_width = qMax(w, 0);
-#else
-    QMainWindow::setMaximumWidth(w);
-#endif
-}
-
-void QGoodWindow::setMaximumHeight(int h)
-{
-#ifdef Q_OS_WIN
-    m_maximum_height = qMax(h, 0);
-#else
-    QMainWindow::setMaximumHeight(h);
-#endif
-}
-
-QSize QGoodWindow::minimumSize() const
-{
-#ifdef Q_OS_WIN
-    return QSize(minimumWidth(), minimumHeight());
-#else
-    return QMainWindow::minimumSize();
-#endif
-}
-
-QSize QGoodWindow::maximumSize() const
-{
-#ifdef Q_OS_WIN
-    return QSize(maximumWidth(), maximumHeight());
-#else
-    return QMainWindow::maximumSize();
-#endif
-}
-
-int QGoodWindow::minimumWidth() const
-{
-#ifdef Q_OS_WIN
-    return (m_minimum_width > 0 ? m_minimum_width : QMainWindow::minimumWidth());
-#else
-    return QMainWindow::minimumWidth();
-#endif
-}
-
-int QGoodWindow::minimumHeight() const
-{
-#ifdef Q_OS_WIN
-    return (m_minimum_height > 0 ? m_minimum_height : QMainWindow::minimumHeight());
-#else
-    return QMainWindow::minimumHeight();
-#endif
-}
-
-int QGoodWindow::maximumWidth() const
-{
-#ifdef Q_OS_WIN
-    return (m_maximum_width > 0 ? m_maximum_width : QMainWindow::maximumWidth());
-#else
-    return QMainWindow::maximumWidth();
-#endif
-}
-
-int QGoodWindow::maximumHeight() const
-{
-#ifdef Q_OS_WIN
-    return (m_maximum_height > 0 ? m_maximum_height : QMainWindow::maximumHeight());
-#else
-    return QMainWindow::maximumHeight();
-#endif
-}
-
-QRect QGoodWindow::normalGeometry() const
-{
-#ifdef Q_OS_WIN
-    return m_rect_normal;
-#else
-    return QMainWindow::normalGeometry();
-#endif
-}
-
-QRect QGoodWindow::frameGeometry() const
-{
-#ifdef Q_OS_WIN
-    RECT window_rect;
-    GetWindowRect(m_hwnd, &window_rect);
-
-    int x = qFloor(window_rect.left / m_pixel_ratio);
-    int y = qFloor(window_rect.top / m_pixel_ratio);
-    int w = qFloor((window_rect.right - window_rect.left) / m_pixel_ratio);
-    int h = qFloor((window_rect.bottom - window_rect.top) / m_pixel_ratio);
-
-    QRect rect = QRect(x, y, w, h);
-
-    if (isMaximized())
-    {
-        const int border_width = BORDERWIDTH();
-        rect.adjust(border_width, border_width, -border_width, -border_width);
-    }
-
-    return rect;
-#else
-    return QMainWindow::frameGeometry();
-#endif
-}
-
-QRect QGoodWindow::geometry() const
-{
-#ifdef Q_OS_WIN
-    RECT client_rect;
-    GetClientRect(m_hwnd, &client_rect);
-
-    int w = qFloor((client_rect.right - client_rect.left) / m_pixel_ratio);
-    int h = qFloor((client_rect.bottom - client_rect.top) / m_pixel_ratio);
-
-    QRect rect = QRect(x(), y(), w, h);
-
-    return rect;
-#else
-    return QMainWindow::geometry();
-#endif
-}
-
-QRect QGoodWindow::rect() const
-{
-#ifdef Q_OS_WIN
-    return QRect(0, 0, width(), height());
-#else
-    return QMainWindow::rect();
-#endif
-}
-
-QPoint QGoodWindow::pos() const
-{
-#ifdef Q_OS_WIN
-    return frameGeometry().topLeft();
-#else
-    return QMainWindow::pos();
-#endif
-}
-
-QSize QGoodWindow::size() const
-{
-#ifdef Q_OS_WIN
-    return QSize(width(), height());
-#else
-    return QMainWindow::size();
-#endif
-}
-
-int QGoodWindow::x() const
-{
-#ifdef Q_OS_WIN
-    return pos().x();
-#else
-    return QMainWindow::x();
-#endif
-}
-
-int QGoodWindow::y() const
-{
-#ifdef Q_OS_WIN
-    return pos().y();
-#else
-    return QMainWindow::y();
-#endif
-}
-
-int QGoodWindow::width() const
-{
-#ifdef Q_OS_WIN
-    return geometry().width();
-#else
-    return QMainWindow::width();
-#endif
-}
-
-int QGoodWindow::height() const
-{
-#ifdef Q_OS_WIN
-    return geometry().height();
-#else
-    return QMainWindow::height();
-#endif
-}
-
-void QGoodWindow::move(int x, int y)
-{
-#ifdef Q_OS_WIN
-    x = qFloor(x * m_pixel_ratio);
-    y = qFloor(y * m_pixel_ratio);
-
-    SetWindowPos(m_hwnd, nullptr, x, y, 0, 0, SWP_NOSIZE | SWP_NOACTIVATE);
-#else
-    QMainWindow::move(x, y);
-#endif
-}
-
-void QGoodWindow::move(const QPoint &pos)
-{
-#ifdef Q_OS_WIN
-    move(pos.x(), pos.y());
-#else
-    QMainWindow::move(pos);
-#endif
-}
-
-void QGoodWindow::resize(int width, int height)
-{
-#ifdef Q_OS_WIN
-    width = qFloor(width * m_pixel_ratio);
-    height = qFloor(height * m_pixel_ratio);
-
-    if (m_is_using_system_borders)
-    {
-        width += BORDERWIDTH() * 2;
-        height += BORDERHEIGHT();
-    }
-
-    SetWindowPos(m_hwnd, nullptr, 0, 0, width, height, SWP_NOMOVE | SWP_NOACTIVATE);
-#else
-    QMainWindow::resize(width, height);
-#endif
-}
-
-void QGoodWindow::resize(const QSize &size)
-{
-#ifdef Q_OS_WIN
-    resize(size.width(), size.height());
-#else
-    QMainWindow::resize(size);
-#endif
-}
-
-void QGoodWindow::setGeometry(int x, int y, int w, int h)
-{
-#ifdef Q_OS_WIN
-    move(x, y);
-    resize(w, h);
-#else
-    QMainWindow::setGeometry(x, y, w, h);
-#endif
-}
-
-void QGoodWindow::setGeometry(const QRect &rect)
-{
-#ifdef Q_OS_WIN
-    setGeometry(rect.x(), rect.y(), rect.width(), rect.height());
-#else
-    QMainWindow::setGeometry(rect);
-#endif
-}
-
-void QGoodWindow::activateWindow()
-{
-#ifdef Q_OS_WIN
-    SetForegroundWindow(m_hwnd);
-#else
-    QMainWindow::activateWindow();
-#endif
-}
-
-void QGoodWindow::show()
-{
-#ifdef Q_OS_WIN
-    if (!isVisible() && !m_window_state.testFlag(Qt::WindowNoState))
-    {
-        setWindowStateWin();
-        return;
-    }
-
-    ShowWindow(m_hwnd, SW_SHOW);
-#else
-    QMainWindow::show();
-#endif
-}
-
-void QGoodWindow::showNormal()
-{
-#ifdef Q_OS_WIN
-    if (isFullScreen())
-    {
-        m_window_state ^= Qt::WindowFullScreen;
-        SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) | WS_OVERLAPPEDWINDOW);
-        setGeometry(normalGeometry());
-        setWindowMask();
-    }
-
-    ShowWindow(m_hwnd, SW_SHOWNORMAL);
-#else
-    QMainWindow::showNormal();
-#endif
-}
-
-void QGoodWindow::showMaximized()
-{
-#if defined Q_OS_WIN || defined Q_OS_LINUX
-    if (FIXED_SIZE(this))
-        return;
-#endif
-#ifdef Q_OS_WIN
-    if (isFullScreen())
-        showNormal();
-
-    ShowWindow(m_hwnd, SW_SHOWMAXIMIZED);
-#else
-    QMainWindow::showMaximized();
-#endif
-}
-
-void QGoodWindow::showMinimized()
-{
-#ifdef Q_OS_WIN
-    if (isFullScreen())
-        showNormal();
-
-    ShowWindow(m_hwnd, SW_MINIMIZE);
-#else
-    QMainWindow::showMinimized();
-#endif
-}
-
-void QGoodWindow::showFullScreen()
-{
-#if defined Q_OS_WIN || defined Q_OS_LINUX
-    if (FIXED_SIZE(this))
-        return;
-#endif
-#ifdef Q_OS_WIN
-    if (isFullScreen())
-        return;
-
-    m_window_state = Qt::WindowFullScreen;
-
-    ShowWindow(m_hwnd, SW_SHOWNORMAL);
-
-    SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) & ~WS_OVERLAPPEDWINDOW);
-
-    HMONITOR monitor = MonitorFromWindow(m_hwnd, MONITOR_DEFAULTTONEAREST);
-
-    MONITORINFO monitor_info;
-    memset(&monitor_info, 0, sizeof(MONITORINFO));
-    monitor_info.cbSize = sizeof(MONITORINFO);
-
-    GetMonitorInfoW(monitor, &monitor_info);
-
-    QRect screen_geom;
-    screen_geom.moveTop(monitor_info.rcMonitor.top);
-    screen_geom.moveLeft(monitor_info.rcMonitor.left);
-    screen_geom.setWidth(monitor_info.rcMonitor.right - monitor_info.rcMonitor.left);
-    screen_geom.setHeight(monitor_info.rcMonitor.bottom - monitor_info.rcMonitor.top);
-
-    SetWindowPos(m_hwnd, nullptr, screen_geom.x(), screen_geom.y(),
-                 screen_geom.width(), screen_geom.height(), SWP_NOACTIVATE);
-
-    QRect window_rect;
-    window_rect.moveTop(0);
-    window_rect.moveLeft(0);
-    window_rect.setWidth(screen_geom.width());
-    window_rect.setHeight(screen_geom.height());
-
-#ifdef QT_VERSION_QT5
-    HRGN hrgn = QtWin::toHRGN(QRegion(window_rect));
-#endif
-#ifdef QT_VERSION_QT6
-    HRGN hrgn = QRegion(window_rect).toHRGN();
-#endif
-
-    SetWindowRgn(m_hwnd, hrgn, TRUE);
-
-    sizeMoveWindow();
-#else
-    QMainWindow::showFullScreen();
-#endif
-}
-
-void QGoodWindow::hide()
-{
-#ifdef Q_OS_WIN
-    ShowWindow(m_hwnd, SW_HIDE);
-#else
-    QMainWindow::hide();
-#endif
-}
-
-bool QGoodWindow::close()
-{
-#ifdef Q_OS_WIN
-    if (m_closed)
-        return true;
-
-    SendMessageW(m_hwnd, WM_CLOSE, 0, 0);
-
-    return m_closed;
-#else
-    return QMainWindow::close();
-#endif
-}
-
-bool QGoodWindow::isVisible() const
-{
-#ifdef Q_OS_WIN
-    return IsWindowVisible(m_hwnd);
-#else
-    return QMainWindow::isVisible();
-#endif
-}
-
-bool QGoodWindow::isEnabled() const
-{
-#ifdef Q_OS_WIN
-    return IsWindowEnabled(m_hwnd);
-#else
-    return QMainWindow::isEnabled();
-#endif
-}
-
-bool QGoodWindow::isActiveWindow() const
-{
-#ifdef Q_OS_WIN
-    const HWND active_window = GetActiveWindow();
-    return ((active_window == m_hwnd) || IsChild(m_hwnd, active_window));
-#else
-    return QMainWindow::isActiveWindow();
-#endif
-}
-
-bool QGoodWindow::isMaximized() const
-{
-#ifdef Q_OS_WIN
-    WINDOWPLACEMENT wp;
-    wp.length = sizeof(WINDOWPLACEMENT);
-    GetWindowPlacement(m_hwnd, &wp);
-    return (wp.showCmd == SW_SHOWMAXIMIZED);
-#else
-    return QMainWindow::isMaximized();
-#endif
-}
-
-bool QGoodWindow::isMinimized() const
-{
-#ifdef Q_OS_WIN
-    WINDOWPLACEMENT wp;
-    wp.length = sizeof(WINDOWPLACEMENT);
-    GetWindowPlacement(m_hwnd, &wp);
-    return (wp.showCmd == SW_SHOWMINIMIZED);
-#else
-    return QMainWindow::isMinimized();
-#endif
-}
-
-bool QGoodWindow::isFullScreen() const
-{
-#ifdef Q_OS_WIN
-    return windowState().testFlag(Qt::WindowFullScreen);
-#else
-    return QMainWindow::isFullScreen();
-#endif
-}
-
-Qt::WindowStates QGoodWindow::windowState() const
-{
-#ifdef Q_OS_WIN
-    return m_window_state;
-#else
-    return QMainWindow::windowState();
-#endif
-}
-
-void QGoodWindow::setWindowState(Qt::WindowStates state)
-{
-#ifdef Q_OS_WIN
-    m_window_state = state;
-
-    if (!isVisible())
-        return;
-
-    setWindowStateWin();
-#else
-    QMainWindow::setWindowState(state);
-#endif
-}
-
-QWindow *QGoodWindow::windowHandle() const
-{
-#ifdef Q_OS_WIN
-    return m_window_handle;
-#else
-    return QMainWindow::windowHandle();
-#endif
-}
-
-qreal QGoodWindow::windowOpacity() const
-{
-    return windowHandle()->opacity();
-}
-
-void QGoodWindow::setWindowOpacity(qreal level)
-{
-    windowHandle()->setOpacity(level);
-}
-
-QString QGoodWindow::windowTitle() const
-{
-    return QMainWindow::windowTitle();
-}
-
-void QGoodWindow::setWindowTitle(const QString &title)
-{
-#ifdef Q_OS_WIN
-    SetWindowTextW(m_hwnd, reinterpret_cast<const WCHAR*>(title.utf16()));
-
-    QMainWindow::setWindowTitle(title);
-#else
-    QMainWindow::setWindowTitle(title);
-#endif
-}
-
-QIcon QGoodWindow::windowIcon() const
-{
-    return QMainWindow::windowIcon();
-}
-
-void QGoodWindow::setWindowIcon(const QIcon &icon)
-{
-#ifdef Q_OS_WIN
-
-#ifdef QT_VERSION_QT5
-    HICON hicon_big = QtWin::toHICON(icon.pixmap(GetSystemMetrics(SM_CXICON),
-                                                 GetSystemMetrics(SM_CYICON)));
-    HICON hicon_small = QtWin::toHICON(icon.pixmap(GetSystemMetrics(SM_CXSMICON),
-                                                   GetSystemMetrics(SM_CYSMICON)));
-#endif
-#ifdef QT_VERSION_QT6
-    HICON hicon_big = icon.pixmap(GetSystemMetrics(SM_CXICON),
-                                  GetSystemMetrics(SM_CYICON)).toImage().toHICON();
-    HICON hicon_small = icon.pixmap(GetSystemMetrics(SM_CXSMICON),
-                                    GetSystemMetrics(SM_CYSMICON)).toImage().toHICON();
-#endif
-
-    SendMessageW(m_hwnd, WM_SETICON, ICON_BIG, LPARAM(hicon_big));
-    SendMessageW(m_hwnd, WM_SETICON, ICON_SMALL, LPARAM(hicon_small));
-
-    QMainWindow::setWindowIcon(icon);
-#else
-    QMainWindow::setWindowIcon(icon);
-#endif
-}
-
-QByteArray QGoodWindow::saveGeometry() const
-{
-#ifdef QGOODWINDOW
-    QByteArray geometry;
-    QDataStream stream(&geometry, QIODevice::WriteOnly);
-    stream.setVersion(QDataStream::Qt_5_0);
-
-    QRect window_geom = normalGeometry();
-    window_geom.moveTop(qFloor(window_geom.y() * m_pixel_ratio));
-    window_geom.moveLeft(qFloor(window_geom.x() * m_pixel_ratio));
-    window_geom.setWidth(qFloor(window_geom.width() * m_pixel_ratio));
-    window_geom.setHeight(qFloor(window_geom.height() * m_pixel_ratio));
-
-    stream << qint32(window_geom.x());
-    stream << qint32(window_geom.y());
-    stream << qint32(window_geom.width());
-    stream << qint32(window_geom.height());
-    stream << windowState().testFlag(Qt::WindowMinimized);
-    stream << windowState().testFlag(Qt::WindowMaximized);
-    stream << windowState().testFlag(Qt::WindowFullScreen);
-
-    return geometry;
-#else
-    return QMainWindow::saveGeometry();
-#endif
-}
-
-bool QGoodWindow::restoreGeometry(const QByteArray &geometry)
-{
-#ifdef QGOODWINDOW
-    if (geometry.size() != int(sizeof(qint32) * 4 + sizeof(bool) * 3))
-        return false;
-
-    QDataStream stream(geometry);
-    stream.setVersion(QDataStream::Qt_5_0);
-
-    qint32 rect_x;
-    qint32 rect_y;
-    qint32 rect_width;
-    qint32 rect_height;
-    bool minimized;
-    bool maximized;
-    bool fullscreen;
-
-    stream >> rect_x;
-    stream >> rect_y;
-    stream >> rect_width;
-    stream >> rect_height;
-    stream >> minimized;
-    stream >> maximized;
-    stream >> fullscreen;
-
-    if (stream.status() != QDataStream::Ok)
-        return false;
-
-    QRegion screens;
-
-    for (QScreen *screen : qApp->screens())
-    {
-        QRect rect = screen->geometry();
-        qreal pixel_ratio = screen->devicePixelRatio();
-        rect.setWidth(qFloor(rect.width() * pixel_ratio));
-        rect.setHeight(qFloor(rect.height() * pixel_ratio));
-        screens += rect;
-    }
-
-    QRect window_geom;
-    window_geom.moveTop(rect_y);
-    window_geom.moveLeft(rect_x);
-    window_geom.setWidth(rect_width);
-    window_geom.setHeight(rect_height);
-
-    if (!screens.boundingRect().contains(window_geom))
-    {
-        QScreen *screen = qApp->primaryScreen();
-
-        QRect rect = screen->availableGeometry();
-        qreal pixel_ratio = screen->devicePixelRatio();
-        rect.setWidth(qFloor(rect.width() * pixel_ratio));
-        rect.setHeight(qFloor(rect.height() * pixel_ratio));
-
-        window_geom.moveCenter(rect.center());
-        window_geom.setWidth(qMin(rect.width(), window_geom.width()));
-        window_geom.setHeight(qMin(rect.height(), window_geom.height()));
-    }
-
-#ifdef Q_OS_WIN
-    updateScreen(screenForPoint(window_geom.center()));
-#endif
-
-    window_geom.moveTop(qFloor(window_geom.y() / m_pixel_ratio));
-    window_geom.moveLeft(qFloor(window_geom.x() / m_pixel_ratio));
-    window_geom.setWidth(qFloor(window_geom.width() / m_pixel_ratio));
-    window_geom.setHeight(qFloor(window_geom.height() / m_pixel_ratio));
-
-#ifdef Q_OS_WIN
-    m_rect_normal = window_geom;
-#endif
-
-    setGeometry(window_geom);
-
-    if (minimized)
-        setWindowState(Qt::WindowMinimized);
-    else if (maximized)
-        setWindowState(Qt::WindowMaximized);
-    else if (fullscreen)
-        setWindowState(Qt::WindowFullScreen);
-
-    return true;
-#else
-    return QMainWindow::restoreGeometry(geometry);
-#endif
-}
-
-bool QGoodWindow::event(QEvent *event)
-{
-#if defined Q_OS_LINUX || defined Q_OS_MAC
-    switch (event->type())
-    {
-    case QEvent::Leave:
-    {
-        buttonLeave(m_last_caption_button_hovered);
-        m_last_move_button = -1;
-
-        break;
-    }
-    case QEvent::Hide:
-    case QEvent::HoverLeave:
-    {
-        if (QApplication::overrideCursor())
-            QApplication::restoreOverrideCursor();
-
-        break;
-    }
-    default:
-        break;
-    }
-#endif
-#ifdef Q_OS_WIN
-    switch (event->type())
-    {
-    case QEvent::ChildPolished:
-    {
-        QChildEvent *child_event = static_cast<QChildEvent*>(event);
-
-        QWidget *widget = qobject_cast<QWidget*>(child_event->child());
-
-        if (!widget)
-            break;
-
-//Catch QMenu show event to fix show bug.
-#if defined QT_VERSION_QT5 && QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-        for (QWidget *widget : widget->findChildren<QWidget*>())
-        {
-            if (widget->metaObject()->className() == QStringLiteral("QMenu") ||
-                widget->metaObject()->className() == QStringLiteral("QComboBoxPrivateContainer"))
-            {
-                widget->installEventFilter(this);
-            }
-        }
-#endif
-
-        if (!widget->isWindow())
-            break;
-
-        if (!widget->isModal())
-            break;
-
-        bool is_file_dialog = bool(qobject_cast<QFileDialog*>(widget));
-
-        widget->adjustSize();
-        widget->installEventFilter(this);
-        widget->setParent(bestParentForModalWindow(),
-                          (!is_file_dialog ? widget->windowFlags() : Qt::WindowFlags(0)));
-
-        break;
-    }
-    case QEvent::WindowBlocked:
-    {
-        EnableWindow(m_hwnd, FALSE);
-        break;
-    }
-    case QEvent::WindowUnblocked:
-    {
-        EnableWindow(m_hwnd, TRUE);
-        break;
-    }
-    case QEvent::Show:
-    case QEvent::WindowStateChange:
-    {
-        bool window_no_state = windowState().testFlag(Qt::WindowNoState);
-
-        for (QSizeGrip *size_grip : findChildren<QSizeGrip*>())
-        {
-            if (!size_grip->window()->windowFlags().testFlag(Qt::SubWindow))
-                size_grip->setVisible(window_no_state);
-        }
-
-        break;
-    }
-    case QEvent::Resize:
-    {
-        internalWidgetResize();
-
-        break;
-    }
-    case QEvent::Close:
-    {
-        if (m_closed)
-        {
-            hide();
-            return true;
-        }
-
-        break;
-    }
-    default:
-        break;
-    }
-#endif
-#ifdef Q_OS_LINUX
-    switch (event->type())
-    {
-    case QEvent::Show:
-    case QEvent::Hide:
-    case QEvent::WindowActivate:
-    case QEvent::WindowDeactivate:
-    case QEvent::WindowStateChange:
-    case QEvent::Resize:
-    case QEvent::Move:
-    {
-        QRegion mask;
-
-        if (isVisible() && windowState().testFlag(Qt::WindowNoState))
-        {
-            const int radius = 8;
-
-            QBitmap bmp(size());
-            bmp.clear();
-
-            QPainter painter;
-            painter.begin(&bmp);
-            painter.setRenderHints(QPainter::Antialiasing);
-            painter.setPen(Qt::color1);
-            painter.setBrush(Qt::color1);
-            painter.drawRoundedRect(rect(), radius, radius, Qt::AbsoluteSize);
-            painter.end();
-
-            mask = bmp;
-        }
-
-        setMask(mask);
-
-        if (isVisible() && windowState().testFlag(Qt::WindowNoState))
-        {
-            sizeMoveBorders();
-
-            if (isActiveWindow())
-            {
-                m_shadow->showLater();
-            }
-        }
-        else
-        {
-            m_shadow->hide();
-        }
-
-        break;
-    }
-    case QEvent::WindowBlocked:
-    {
-        if (FIXED_SIZE(this))
-            break;
-
-        if (!windowState().testFlag(Qt::WindowNoState))
-            break;
-
-        m_shadow->hide();
-
-        break;
-    }
-    case QEvent::WindowUnblocked:
-    {
-        if (FIXED_SIZE(this))
-            break;
-
-        activateWindow();
-
-        if (!windowState().testFlag(Qt::WindowNoState))
-            break;
-
-        m_shadow->show();
-
-        break;
-    }
-    default:
-        break;
-    }
-#endif
-#ifdef Q_OS_MAC
-    switch (event->type())
-    {
-    case QEvent::WinIdChange:
-    {
-        QTimer::singleShot(0, this, [=]{
-            notification.unregisterNotification();
-
-            notification.registerNotification("NSWindowWillEnterFullScreenNotification", winId());
-            notification.registerNotification("NSWindowWillExitFullScreenNotification", winId());
-            notification.registerNotification("NSWindowDidExitFullScreenNotification", winId());
-        });
-
-        break;
-    }
-    case QEvent::Show:
-    {
-        if (isFullScreen())
-            break;
-
-        setMacOSStyle(int(macOSNative::StyleType::NoState));
-
-        break;
-    }
-    default:
-        break;
-    }
-#endif
-    return QMainWindow::event(event);
-}
-
-bool QGoodWindow::eventFilter(QObject *watched, QEvent *event)
-{
-#ifdef Q_OS_WIN
-    if (watched == m_main_window)
-    {
-        switch (event->type())
-        {
-        case QEvent::Show:
-        {
-            //Prevent send multiple show events at the window show event.
-            if (!m_self_generated_show_event)
-                return true;
-
-            //Don't propagate show event if already visible.
-            if (m_visible)
-                return true;
-
-            m_visible = true;
-
-            break;
-        }
-        case QEvent::Hide:
-        {
-            //Don't propagate hide event if already invisible.
-            if (!m_visible)
-                return true;
-
-            m_visible = false;
-
-            break;
-        }
-        case QEvent::WindowStateChange:
-        {
-            if (isMinimized())
-                m_visible = false;
-
-            break;
-        }
-        case QEvent::Close:
-        {
-            //Don't propagate close event if it is generated
-            //by QGoodWindow.
-            if (!m_self_generated_close_event)
-                return true;
-
-            break;
-        }
-        case QEvent::WindowActivate:
-        {
-            if (!m_main_window->isActiveWindow() || m_active_state)
-                return true;
-
-            m_active_state = true;
-
-            break;
-        }
-        case QEvent::WindowDeactivate:
-        {
-            if (m_main_window->isActiveWindow() || !m_active_state)
-                return true;
-
-            m_active_state = false;
-
-            break;
-        }
-        default:
-            break;
-        }
-    }
-    else if (m_parent && (watched == m_parent))
-    {
-        switch (event->type())
-        {
-        case QEvent::Close:
-        {
-            if (event->isAccepted())
-                close();
-
-            break;
-        }
-        default:
-            break;
-        }
-    }
-#if defined QT_VERSION_QT5 && QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-    else if (watched->metaObject()->className() == QStringLiteral("QMenu") ||
-               watched->metaObject()->className() == QStringLiteral("QComboBoxPrivateContainer"))
-    {
-        QWidget *widget = qobject_cast<QWidget*>(watched);
-
-        if (widget)
-        {
-            switch (event->type())
-            {
-            case QEvent::Polish:
-            {
-                if (!widget->windowHandle())
-                    widget->createWinId();
-
-                break;
-            }
-            case QEvent::Show:
-            {
-                if (qobject_cast<QMenu*>(widget->parentWidget()))
-                    break;
-
-                QScreen *screen = windowHandle()->screen();
-                widget->windowHandle()->setScreen(screen);
-
-                int x = qFloor(screen->geometry().x() / m_pixel_ratio);
-                int y = qFloor(screen->geometry().y() / m_pixel_ratio);
-
-                x += widget->x();
-                y += widget->y();
-
-                widget->move(x, y);
-
-                break;
-            }
-            default:
-                break;
-            }
-        }
-    }
-#endif
-    else if (QWidget *widget = qobject_cast<QWidget*>(watched))
-    {
-        if (widget->isWindow())
-        {
-            switch (event->type())
-            {
-            case QEvent::Show:
-            {
-                if (isMinimized())
-                    showNormal();
-
-                moveCenterWindow(widget);
-
-                break;
-            }
-            case QEvent::Resize:
-            {
-                if (!FIXED_SIZE(widget))
-                    break;
-
-                QTimer::singleShot(0, this, [=]{
-                    moveCenterWindow(widget);
-                });
-
-                break;
-            }
-            default:
-                break;
-            }
-        }
-    }
-#endif
-#if defined Q_OS_LINUX || defined Q_OS_MAC
-    QWidget *modal_widget = qApp->activeModalWidget();
-
-    if (modal_widget && modal_widget->window() != this)
-        return QMainWindow::eventFilter(watched, event);
-
-    QWidget *widget = qobject_cast<QWidget*>(watched);
-
-    if (!widget)
-        return QMainWindow::eventFilter(watched, event);
-
-    if (widget->window() != this
-        #ifdef Q_OS_LINUX
-            && widget != m_shadow
-        #endif
-            )
-        return QMainWindow::eventFilter(watched, event);
-
-    QPoint cursor_pos = QCursor::pos();
-    qintptr button = ncHitTest(qFloor(cursor_pos.x() * m_pixel_ratio), qFloor(cursor_pos.y() * m_pixel_ratio));
-
-    switch (event->type())
-    {
-#ifdef Q_OS_MAC
-    case QEvent::ChildAdded:
-    case QEvent::ChildRemoved:
-    {
-        if (qApp->activeModalWidget())
-            break;
-
-        if (isFullScreen())
-            break;
-
-        if (m_on_animate_event)
-            break;
-
-        setMacOSStyle(int(macOSNative::StyleType::NoState));
-
-        break;
-    }
-#endif
-    case QEvent::ChildPolished:
-    {
-        QChildEvent *child_event = static_cast<QChildEvent*>(event);
-
-        QWidget *widget = qobject_cast<QWidget*>(child_event->child());
-
-        if (!widget)
-            break;
-
-        widget->setMouseTracking(true);
-        widget->installEventFilter(this);
-
-        for (QWidget *w : widget->findChildren<QWidget*>())
-        {
-            w->setMouseTracking(true);
-            w->installEventFilter(this);
-        }
-
-        break;
-    }
-    case QEvent::MouseButtonPress:
-    {
-        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
-
-        if (mouse_event->button() != Qt::LeftButton)
-            break;
-
-        switch (button)
-        {
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-        {
-            buttonPress(button);
-            break;
-        }
-        default:
-            break;
-        }
-
-        break;
-    }
-    case QEvent::MouseMove:
-    {
-        if (m_last_move_button != button)
-        {
-            m_last_move_button = button;
-
-            buttonLeave(m_last_caption_button_hovered);
-
-            switch (button)
-            {
-            case HTMINBUTTON:
-            case HTMAXBUTTON:
-            case HTCLOSE:
-            {
-                if (!m_is_caption_button_pressed || (button == m_caption_button_pressed))
-                    buttonEnter(button);
-
-                break;
-            }
-            default:
-                break;
-            }
-        }
-
-        break;
-    }
-    case QEvent::MouseButtonRelease:
-    {
-        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
-
-        if (mouse_event->button() != Qt::LeftButton)
-            break;
-
-        m_last_move_button = -1;
-
-        buttonRelease(m_caption_button_pressed, (button == m_caption_button_pressed));
-
-        break;
-    }
-    default:
-        break;
-    }
-#endif
-#ifdef Q_OS_LINUX
-    if (m_is_caption_button_pressed)
-        return QMainWindow::eventFilter(watched, event);
-
-    switch (event->type())
-    {
-    case QEvent::MouseButtonDblClick:
-    {
-        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
-
-        if (mouse_event->button() == Qt::LeftButton)
-        {
-            if (m_margin == HTCAPTION)
-            {
-                if (!isMaximized())
-                    showMaximized();
-                else
-                    showNormal();
-            }
-        }
-
-        switch (m_margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    case QEvent::MouseButtonPress:
-    {
-        setCursorForCurrentPos();
-
-        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
-
-        if (!m_resize_move && mouse_event->button() == Qt::LeftButton)
-        {
-            if (m_margin != HTNOWHERE)
-                m_resize_move = true;
-        }
-
-        switch (m_margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    case QEvent::MouseMove:
-    {
-        setCursorForCurrentPos();
-
-        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
-
-        if (m_resize_move && mouse_event->buttons() == Qt::LeftButton)
-            sizeMove();
-
-        switch (m_margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    case QEvent::MouseButtonRelease:
-    {
-        setCursorForCurrentPos();
-
-        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
-
-        if (m_resize_move && mouse_event->button() == Qt::LeftButton)
-        {
-            if (m_margin != HTNOWHERE)
-                m_resize_move = false;
-        }
-
-        switch (m_margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    case QEvent::Leave:
-    {
-        setCursorForCurrentPos();
-
-        break;
-    }
-    case QEvent::Wheel:
-    {
-        switch (m_margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    case QEvent::ContextMenu:
-    {
-        switch (m_margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    default:
-        break;
-    }
-#endif
-#ifdef Q_OS_MAC
-    if (m_parent)
-        return QMainWindow::eventFilter(watched, event);
-
-    if (m_is_caption_button_pressed)
-        return QMainWindow::eventFilter(watched, event);
-
-    int margin = int(ncHitTest(qFloor(cursor_pos.x() * m_pixel_ratio), qFloor(cursor_pos.y() * m_pixel_ratio)));
-
-    switch (event->type())
-    {
-    case QEvent::MouseButtonDblClick:
-    {
-        if (margin == HTCAPTION)
-        {
-            QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
-
-            if (!isFullScreen())
-            {
-                if (mouse_event->button() == Qt::LeftButton)
-                {
-                    if (margin == HTCAPTION)
-                    {
-                        if (!isMaximized())
-                            showMaximized();
-                        else
-                            showNormal();
-                    }
-                }
-            }
-        }
-
-        switch (margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    case QEvent::MouseButtonPress:
-    {
-        if (margin == HTCAPTION)
-        {
-            QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
-
-            if (!isFullScreen())
-            {
-                if (mouse_event->button() == Qt::LeftButton)
-                {
-                    m_cursor_move_pos = cursor_pos - pos();
-                }
-            }
-        }
-
-        m_mouse_button_pressed = true;
-
-        switch (margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    case QEvent::MouseMove:
-    {
-        if (!m_cursor_move_pos.isNull())
-        {
-            QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
-
-            if (!isFullScreen())
-            {
-                if (mouse_event->buttons() == Qt::LeftButton)
-                {
-                    move(cursor_pos - m_cursor_move_pos);
-                }
-            }
-        }
-
-        if (!m_mouse_button_pressed)
-        {
-            QWidget *widget = QApplication::widgetAt(cursor_pos);
-
-            if (widget)
-            {
-                switch (margin)
-                {
-                case HTCAPTION:
-                case HTMINBUTTON:
-                case HTMAXBUTTON:
-                case HTCLOSE:
-                {
-                    if (QApplication::overrideCursor() &&
-                            QApplication::overrideCursor()->shape() == Qt::ArrowCursor)
-                        break;
-
-                    QApplication::setOverrideCursor(Qt::ArrowCursor);
-
-                    break;
-                }
-                case HTNOWHERE:
-                {
-                    if (!QApplication::overrideCursor())
-                        break;
-
-                    if (QApplication::overrideCursor()->shape() != Qt::ArrowCursor)
-                        break;
-
-                    QApplication::restoreOverrideCursor();
-
-                    break;
-                }
-                default:
-                    break;
-                }
-            }
-        }
-
-        switch (margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    case QEvent::MouseButtonRelease:
-    {
-        if (!m_cursor_move_pos.isNull())
-        {
-            QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
-
-            QWidget *widget = QApplication::widgetAt(cursor_pos);
-
-            if (widget && !isFullScreen())
-            {
-                if (mouse_event->button() == Qt::LeftButton)
-                    m_cursor_move_pos = QPoint();
-            }
-        }
-
-        m_mouse_button_pressed = false;
-
-        switch (margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    case QEvent::Wheel:
-    {
-        switch (margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    case QEvent::ContextMenu:
-    {
-        switch (margin)
-        {
-        case HTCAPTION:
-        case HTMINBUTTON:
-        case HTMAXBUTTON:
-        case HTCLOSE:
-            return true;
-        default:
-            break;
-        }
-
-        break;
-    }
-    default:
-        break;
-    }
-#endif
-    return QMainWindow::eventFilter(watched, event);
-}
-
-bool QGoodWindow::nativeEvent(const QByteArray &eventType, void *message, qgoodintptr *result)
-{
-#ifdef Q_OS_LINUX
-    if (eventType == "xcb_generic_event_t")
-    {
-        xcb_generic_event_t *event = static_cast<xcb_generic_event_t*>(message);
-
-        if (event->response_type == XCB_GE_GENERIC)
-        {
-            if (m_resize_move_started)
-            {
-                m_resize_move_started = false;
-
-                //Fix mouse problems after resize or move.
-                QTest::mouseClick(windowHandle(), Qt::NoButton, Qt::NoModifier);
-            }
-#ifdef QT_VERSION_QT5
-            else
-            {
-                //Fix no mouse event after moving mouse from resize borders.
-                QEvent event(QEvent::MouseMove);
-                QApplication::sendEvent(this, &event);
-            }
-#endif
-        }
-    }
-#endif
-    return QMainWindow::nativeEvent(eventType, message, result);
-}
-
-#ifdef Q_OS_WIN
-void QGoodWindow::initGW()
-{
-    setProperty("_q_embedded_native_parent_handle", WId(m_hwnd));
-    QMainWindow::setWindowFlags(Qt::FramelessWindowHint);
-
-    QEvent event(QEvent::EmbeddingControl);
-    QApplication::sendEvent(this, &event);
-}
-
-void QGoodWindow::destroyGW()
-{
-    QMainWindow::close();
-#ifdef QT_VERSION_QT5
-    QMainWindow::destroy(true, true);
-#endif
-#ifdef QT_VERSION_QT6
-    QMainWindow::destroy(false, false);
-#endif
-}
-
-void QGoodWindow::closeGW()
-{
-    if (m_shadow)
-    {
-        m_shadow->hide();
-
-        qApp->processEvents();
-
-        delete m_shadow;
-    }
-
-    if (m_helper_widget)
-        delete m_helper_widget;
-
-#ifdef QT_VERSION_QT6
-    if (m_helper_window)
-        delete m_helper_window;
-#endif
-
-    qDeleteAll(findChildren<QGoodDialog*>());
-
-    destroyGW();
-
-    SetWindowLongPtrW(m_hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(nullptr));
-}
-
-void QGoodWindow::setWindowStateWin()
-{
-    if (m_window_state.testFlag(Qt::WindowFullScreen))
-        showFullScreen();
-    else if (m_window_state.testFlag(Qt::WindowMaximized))
-        showMaximized();
-    else if (m_window_state.testFlag(Qt::WindowMinimized))
-        showMinimized();
-    else if (m_window_state.testFlag(Qt::WindowNoState))
-        showNormal();
-}
-
-LRESULT QGoodWindow::WndProc(HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
-{
-    QGoodWindow *gw = reinterpret_cast<QGoodWindow*>(GetWindowLongPtrW(hwnd, GWLP_USERDATA));
-
-    if (!gw)
-        return DefWindowProcW(hwnd, message, wParam, lParam);
-
-    switch (message)
-    {
-    case WM_ACTIVATE:
-    {
-        switch (wParam)
-        {
-        case WA_ACTIVE:
-        case WA_CLICKACTIVE:
-        {
-            QTimer::singleShot(0, gw, [=]{
-                gw->setWidgetFocus();
-                gw->handleActivation();
-            });
-
-            break;
-        }
-        case WA_INACTIVE:
-        {
-            if (gw->focusWidget())
-            {
-                //If app going to be inactive,
-                //save current focused widget
-                //to restore focus later.
-
-                gw->m_focus_widget = gw->focusWidget();
-            }
-
-            QTimer::singleShot(0, gw, [=]{
-                gw->handleDeactivation();
-            });
-
-            if (!IsWindowEnabled(hwnd))
-            {
-                if (gw->m_shadow)
-                    gw->m_shadow->hide();
-            }
-
-            break;
-        }
-        default:
-            break;
-        }
-
-        break;
-    }
-    case WM_SETFOCUS:
-    {
-        //Pass focus to last focused widget.
-        gw->setWidgetFocus();
-        gw->m_main_window->activateWindow();
-
-        break;
-    }
-    case WM_SIZE:
-    {
-        gw->sizeMoveWindow();
-
-        break;
-    }
-    case WM_MOVE:
-    {
-        gw->sizeMoveWindow();
-
-        QMoveEvent event(QPoint(gw->x(), gw->y()), QPoint());
-        QApplication::sendEvent(gw, &event);
-
-        break;
-    }
-    case WM_GETMINMAXINFO:
-    {
-        MINMAXINFO *mmi = reinterpret_cast<MINMAXINFO*>(lParam);
-
-        int border_width = 0;
-
-        if (gw->m_is_using_system_borders && gw->windowState().testFlag(Qt::WindowNoState))
-            border_width = BORDERWIDTH();
-
-        QSize minimum = gw->minimumSize();
-
-        QSize sizeHint = gw->minimumSizeHint();
-
-        mmi->ptMinTrackSize.x = qFloor(qMax(minimum.width(), sizeHint.width()) *
-                                       gw->m_pixel_ratio) + border_width * 2;
-        mmi->ptMinTrackSize.y = qFloor(qMax(minimum.height(), sizeHint.height()) *
-                                       gw->m_pixel_ratio) + border_width;
-
-        QSize maximum = gw->maximumSize();
-
-        mmi->ptMaxTrackSize.x = qFloor(maximum.width() * gw->m_pixel_ratio) + border_width * 2;
-        mmi->ptMaxTrackSize.y = qFloor(maximum.height() * gw->m_pixel_ratio) + border_width;
-
-        break;
-    }
-    case WM_CLOSE:
-    {
-        //Send Qt QCloseEvent to the window,
-        //which allows to accept or reject the window close.
-        gw->m_self_generated_close_event = true;
-        QCloseEvent event;
-        QApplication::sendEvent(gw, &event);
-        gw->m_self_generated_close_event = false;
-
-        if (!event.isAccepted())
-            return 0;
-
-        gw->hide();
-
-        gw->m_closed = true;
-
-        //Begin the cleanup.
-
-        gw->closeGW();
-
-        if (gw->testAttribute(Qt::WA_DeleteOnClose))
-            delete gw;
-
-        //End the cleanup.
-
-        return DefWindowProcW(hwnd, message, wParam, lParam);
-    }
-    case WM_DESTROY:
-    {
-        return DefWindowProcW(hwnd, message, wParam, lParam);
-    }
-    case WM_NCHITTEST:
-    {
-        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
-
-        LRESULT lresult = LRESULT(gw->ncHitTest(pos.x(), pos.y()));
-
-        if (FIXED_SIZE(gw))
-        {
-            //If have fixed size, then only HTCAPTION hit test is valid,
-            //which means that only the title bar click and move is valid.
-
-            if (lresult != HTNOWHERE
-                    && lresult != HTSYSMENU
-                    && lresult != HTMINBUTTON
-                    && lresult != HTMAXBUTTON
-                    && lresult != HTCLOSE
-                    && lresult != HTCAPTION)
-                lresult = HTNOWHERE;
-
-            return lresult;
-        }
-        else if (FIXED_WIDTH(gw))
-        {
-            if (lresult != HTNOWHERE
-                    && lresult != HTSYSMENU
-                    && lresult != HTMINBUTTON
-                    && lresult != HTMAXBUTTON
-                    && lresult != HTCLOSE
-                    && lresult != HTCAPTION
-                    && lresult != HTTOP
-                    && lresult != HTBOTTOM)
-                lresult = HTNOWHERE;
-
-            return lresult;
-        }
-        else if (FIXED_HEIGHT(gw))
-        {
-            if (lresult != HTNOWHERE
-                    && lresult != HTSYSMENU
-                    && lresult != HTMINBUTTON
-                    && lresult != HTMAXBUTTON
-                    && lresult != HTCLOSE
-                    && lresult != HTCAPTION
-                    && lresult != HTLEFT
-                    && lresult != HTRIGHT)
-                lresult = HTNOWHERE;
-
-            return lresult;
-        }
-
-        return lresult;
-    }
-    case WM_NCMOUSELEAVE:
-    {
-        if (gw->m_is_caption_button_pressed)
-            break;
-
-        gw->buttonLeave(gw->m_last_caption_button_hovered);
-
-        break;
-    }
-    case WM_NCMOUSEMOVE:
-    {
-        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
-
-        qintptr button = gw->ncHitTest(pos.x(), pos.y());
-
-        bool valid_caption_button = gw->winButtonHover(button);
-
-        if (valid_caption_button)
-        {
-            if (gw->m_is_caption_button_pressed)
-            {
-                if (GetCapture() != hwnd)
-                {
-                    SetCapture(hwnd);
-                }
-            }
-        }
-        else
-        {
-            gw->buttonLeave(gw->m_last_caption_button_hovered);
-        }
-
-        break;
-    }
-    case WM_MOUSEMOVE:
-    {
-        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
-
-        const int border_width = (gw->m_is_win_11_or_greater &&
-                                  gw->windowState().testFlag(Qt::WindowNoState)) ? BORDERWIDTH() : 0;
-
-        pos.setX(qFloor(gw->x() * gw->m_pixel_ratio) + border_width + pos.x());
-        pos.setY(qFloor(gw->y() * gw->m_pixel_ratio) + pos.y());
-
-        qintptr button = gw->ncHitTest(pos.x(), pos.y());
-
-        bool valid_caption_button = gw->winButtonHover(button);
-
-        if (!valid_caption_button)
-        {
-            if (!gw->m_is_caption_button_pressed && GetCapture() == hwnd)
-            {
-                ReleaseCapture();
-            }
-
-            gw->buttonLeave(gw->m_last_caption_button_hovered);
-        }
-
-        break;
-    }
-    case WM_NCLBUTTONDBLCLK:
-    {
-        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
-
-        qintptr button = gw->ncHitTest(pos.x(), pos.y());
-
-        if (button == HTSYSMENU)
-        {
-            QTimer::singleShot(0, gw, &QGoodWindow::close);
-            return 0;
-        }
-
-        break;
-    }
-    case WM_NCLBUTTONDOWN:
-    {
-        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
-
-        qintptr button = gw->ncHitTest(pos.x(), pos.y());
-
-        if (button == HTSYSMENU)
-        {
-            gw->iconClicked();
-            return 0;
-        }
-
-        bool valid_caption_button = gw->buttonPress(button);
-
-        if (valid_caption_button)
-            return 0;
-
-        break;
-    }
-    case WM_NCLBUTTONUP:
-    {
-        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
-
-        qintptr button = gw->ncHitTest(pos.x(), pos.y());
-
-        if (button == HTSYSMENU)
-        {
-            return 0;
-        }
-
-        bool valid_caption_button = gw->buttonRelease(gw->m_caption_button_pressed,
-                                                      (button == gw->m_caption_button_pressed));
-
-        if (valid_caption_button)
-            return 0;
-
-        break;
-    }
-    case WM_LBUTTONDOWN:
-    {
-        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
-
-        const int border_width = (gw->m_is_win_11_or_greater &&
-                                  gw->windowState().testFlag(Qt::WindowNoState)) ? BORDERWIDTH() : 0;
-
-        pos.setX(qFloor(gw->x() * gw->m_pixel_ratio) + border_width + pos.x());
-        pos.setY(qFloor(gw->y() * gw->m_pixel_ratio) + pos.y());
-
-        qintptr button = gw->ncHitTest(pos.x(), pos.y());
-
-        gw->buttonPress(button);
-
-        break;
-    }
-    case WM_LBUTTONUP:
-    {
-        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
-
-        const int border_width = (gw->m_is_win_11_or_greater &&
-                                  gw->windowState().testFlag(Qt::WindowNoState)) ? BORDERWIDTH() : 0;
-
-        pos.setX(qFloor(gw->x() * gw->m_pixel_ratio) + border_width + pos.x());
-        pos.setY(qFloor(gw->y() * gw->m_pixel_ratio) + pos.y());
-
-        qintptr button = gw->ncHitTest(pos.x(), pos.y());
-
-        if (button != gw->m_caption_button_pressed)
-            gw->buttonEnter(button);
-
-        gw->buttonRelease(gw->m_caption_button_pressed, (button == gw->m_caption_button_pressed));
-
-        break;
-    }
-    case WM_SYSKEYDOWN:
-    case WM_SYSKEYUP:
-    {
-        if ((GetKeyState(VK_SHIFT) & 0x8000) && wParam == VK_F10)
-        {
-            //When SHIFT+F10 is pressed.
-            gw->showContextMenu();
-            return 0;
-        }
-
-        if ((GetKeyState(VK_MENU) & 0x8000) && wParam == VK_SPACE)
-        {
-            //When ALT+SPACE is pressed.
-            gw->showContextMenu();
-            return 0;
-        }
-
-        break;
-    }
-    case WM_NCRBUTTONUP:
-    {
-        //Show context menu on right click on title bar.
-
-        int x = GET_X_LPARAM(lParam);
-        int y = GET_Y_LPARAM(lParam);
-
-        LRESULT lRet = LRESULT(gw->ncHitTest(x, y));
-
-        if (lRet == HTCAPTION || lRet == HTSYSMENU)
-            gw->showContextMenu(x, y);
-
-        break;
-    }
-    case WM_NCCALCSIZE:
-    {
-        if (gw->isFullScreen())
-            break;
-
-        if (gw->m_is_using_system_borders && !gw->isMaximized())
-        {
-            const int border_width = BORDERWIDTH();
-
-            RECT *rect = reinterpret_cast<RECT*>(lParam);
-            rect->left += border_width;
-            rect->bottom -= border_width;
-            rect->right -= border_width;
-        }
-
-        if (gw->isMaximized())
-        {
-            //Compensate window client area when maximized,
-            //by removing BORDERWIDTH value for all edges.
-
-            const int border_width = BORDERWIDTH();
-
-            InflateRect(reinterpret_cast<RECT*>(lParam), -border_width, -border_width);
-        }
-
-        //Make the whole window as client area.
-        return 0;
-    }
-#ifdef QT_VERSION_QT5
-    case WM_NCPAINT:
-    case WM_NCACTIVATE:
-    {
-        //Prevent undesired painting on window when DWM is not enabled.
-
-        if (!QtWin::isCompositionEnabled())
-            return TRUE;
-
-        break;
-    }
-#endif
-    case WM_WINDOWPOSCHANGING:
-    {
-        Qt::WindowState state;
-
-        if (gw->isMinimized())
-            state = Qt::WindowMinimized;
-        else if (gw->isMaximized())
-            state = Qt::WindowMaximized;
-        else if (gw->isFullScreen())
-            state = Qt::WindowFullScreen;
-        else
-            state = Qt::WindowNoState;
-
-        if (state != gw->m_last_state)
-        {
-            //If window state changed.
-
-            gw->m_window_state = state;
-
-            if (gw->m_last_state == Qt::WindowMinimized)
-            {
-                QTimer::singleShot(0, gw, [=]{
-                    gw->m_self_generated_show_event = true;
-                    QShowEvent event;
-                    QApplication::sendEvent(gw, &event);
-                    gw->m_self_generated_show_event = false;
-                });
-            }
-
-            QWindowStateChangeEvent event(gw->m_last_state);
-            QApplication::sendEvent(gw, &event);
-
-            gw->m_last_state = state;
-
-            if (gw->m_shadow)
-            {
-                if (state != Qt::WindowNoState)
-                {
-                    //Hide shadow if not on "normal" state.
-                    gw->m_shadow->hide();
-                }
-                else if (gw->isVisible())
-                {
-                    //Show shadow if switching to "normal" state, with delay.
-                    gw->m_shadow->showLater();
-                }
-            }
-
-            if (state == Qt::WindowMinimized)
-            {
-                if (gw->focusWidget())
-                {
-                    //If app going to be minimized,
-                    //save current focused widget
-                    //to restore focus later.
-
-                    gw->m_focus_widget = gw->focusWidget();
-                }
-            }
-        }
-
-        WINDOWPOS *pwp = reinterpret_cast<WINDOWPOS*>(lParam);
-
-        if (pwp->flags & SWP_SHOWWINDOW)
-        {
-            if (!gw->m_main_window->isVisible())
-            {
-                auto func_init = [=]
-                {
-                    gw->updateScreen(gw->screenForWindow(hwnd));
-                };
-
-                auto func_finish = [=]
-                {
-                    gw->internalWidgetResize();
-                    gw->m_window_ready_for_resize = true;
-                    gw->sizeMoveMainWindow();
-                };
-
-                auto func_show = [=]
-                {
-                    gw->m_main_window->show();
-                };
-
-                if (!gw->m_main_window->testAttribute(Qt::WA_NativeWindow))
-                {
-                    func_init();
-                    func_finish();
-                    func_show();
-                }
-                else
-                {
-                    QTimer::singleShot(0, gw, [=]{
-                        func_init();
-                        func_show();
-                        func_finish();
-                    });
-                }
-
-                gw->m_self_generated_show_event = true;
-                QShowEvent event;
-                QApplication::sendEvent(gw, &event);
-                gw->m_self_generated_show_event = false;
-
-                if (gw->m_shadow && gw->windowState().testFlag(Qt::WindowNoState))
-                    gw->m_shadow->showLater();
-            }
-
-#ifdef QT_VERSION_QT6
-            if (gw->m_helper_window)
-                gw->m_helper_window->show();
-#endif
-        }
-        else if (pwp->flags & SWP_HIDEWINDOW)
-        {
-            if (gw->focusWidget())
-            {
-                //If app have a valid focused widget,
-                //save them to restore focus later.
-
-                gw->m_focus_widget = gw->focusWidget();
-            }
-
-            if (gw->m_shadow)
-                gw->m_shadow->hide();
-
-#ifdef QT_VERSION_QT6
-            if (gw->m_helper_window)
-                gw->m_helper_window->hide();
-#endif
-
-            QHideEvent event;
-            QApplication::sendEvent(gw, &event);
-        }
-
-        if (pwp->flags == (SWP_NOSIZE + SWP_NOMOVE))
-        {
-            //Activate window to fix no activation
-            //problem when QGoodWindow isn't shown initially in
-            //active state.
-
-            if (gw->isMinimized() || !gw->isVisible())
-                break;
-
-            gw->m_main_window->activateWindow();
-
-            if (gw->windowState().testFlag(Qt::WindowNoState))
-            {
-                if (gw->m_shadow)
-                    gw->m_shadow->showLater();
-            }
-        }
-
-        break;
-    }
-#ifdef QT_VERSION_QT5
-    case WM_WINDOWPOSCHANGED:
-    {
-        if (!QtWin::isCompositionEnabled() && gw->isMaximized())
-        {
-            //Hack for prevent window goes to full screen when it's being maximized,
-            //enable WS_CAPTION and schedule for disable it,
-            //not mantaining WS_CAPTION all the time to prevent undesired painting on window
-            //when title or icon of the window is changed when DWM is not enabled.
-
-            gw->enableCaption();
-            QTimer::singleShot(0, gw, &QGoodWindow::disableCaption);
-        }
-
-        break;
-    }
-#endif
-    case WM_SETTEXT:
-    {
-        Q_EMIT gw->windowTitleChanged(gw->windowTitle());
-        break;
-    }
-    case WM_SETICON:
-    {
-        Q_EMIT gw->windowIconChanged(gw->windowIcon());
-        break;
-    }
-    case WM_ENTERSIZEMOVE:
-    {
-        gw->m_timer_move->stop();
-
-        break;
-    }
-    case WM_EXITSIZEMOVE:
-    {
-        if (gw->windowHandle()->screen() != gw->screenForWindow(hwnd))
-            gw->m_timer_move->start();
-
-        break;
-    }
-    case WM_DPICHANGED:
-    {
-        gw->m_timer_move->stop();
-
-        //Wait to refresh screen pixel ratio information.
-        qApp->processEvents();
-
-        QScreen *screen = gw->screenForWindow(hwnd);
-
-        if (!screen)
-            break;
-
-        gw->screenChangeMoveWindow(screen);
-        gw->updateScreen(screen);
-        gw->windowScaleChanged();
-
-        break;
-    }
-    case WM_DISPLAYCHANGE:
-    {
-        if (gw->isFullScreen())
-            gw->showNormal();
-
-        break;
-    }
-    case WM_SETTINGCHANGE:
-    {
-        if (QGoodWindowUtils::isWinXOrGreater(10, 0, 0)) //Windows 10 or later.
-        {
-            if (QString::fromWCharArray(LPCWSTR(lParam)) == "ImmersiveColorSet")
-            {
-                QTimer::singleShot(0, gw, &QGoodWindow::themeChanged);
-            }
-        }
-
-        break;
-    }
-#ifdef QT_VERSION_QT5
-    case WM_THEMECHANGED:
-    case WM_DWMCOMPOSITIONCHANGED:
-    {
-        //Send the window change event to m_helper_widget,
-        //this hack corrects the background color when switching between
-        //Windows composition modes or system themes.
-        SendMessageW(HWND(gw->m_helper_widget->winId()), message, 0, 0);
-
-        if (QtWin::isCompositionEnabled())
-        {
-            QTimer::singleShot(100, gw, [=]{
-                gw->enableCaption();
-                gw->frameChanged();
-                SetWindowRgn(hwnd, nullptr, TRUE);
-            });
-        }
-        else
-        {
-            QTimer::singleShot(100, gw, [=]{
-                gw->disableCaption();
-                gw->frameChanged();
-            });
-        }
-
-        QTimer::singleShot(100, gw, [=]{
-            gw->sizeMoveWindow();
-            gw->repaint();
-        });
-
-        break;
-    }
-#endif
-    default:
-        break;
-    }
-
-    MSG msg;
-    msg.hwnd = hwnd;
-    msg.message = message;
-    msg.lParam = lParam;
-    msg.wParam = wParam;
-
-    qgoodintptr result = 0;
-
-    bool return_value = gw->nativeEvent(QByteArray(), &msg, &result);
-
-    if (return_value)
-        return result;
-
-    return DefWindowProcW(hwnd, message, wParam, lParam);
-}
-
-void QGoodWindow::handleActivation()
-{
-    if (m_shadow)
-    {
-        if (windowState().testFlag(Qt::WindowNoState))
-        {
-            m_shadow->setActive(true);
-
-            //If in "normal" state, make shadow visible.
-            if (isVisible())
-                m_shadow->show();
-        }
-    }
-}
-
-void QGoodWindow::handleDeactivation()
-{
-    if (m_shadow)
-        m_shadow->setActive(false);
-
-    if (!isEnabled())
-        buttonLeave(m_last_caption_button_hovered);
-}
-
-void QGoodWindow::setWidgetFocus()
-{
-    if (!m_focus_widget)
-    {
-        bool have_focusable_widget = false;
-
-        for (QWidget *next_focus : findChildren<QWidget*>())
-        {
-            if (next_focus->focusPolicy() != Qt::NoFocus)
-            {
-                //Set focus to first focusable widget.
-                have_focusable_widget = true;
-                m_focus_widget = next_focus;
-                break;
-            }
-        }
-
-        if (!have_focusable_widget)
-        {
-            //If not have focusable widget
-            //set focus to m_main_window.
-            m_focus_widget = m_main_window;
-        }
-    }
-
-    if (m_focus_widget)
-    {
-        //If have a valid m_focus_widget,
-        //set the focus to this widget.
-        m_focus_widget->setFocus();
-    }
-}
-
-void QGoodWindow::enableCaption()
-{
-    SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) | WS_CAPTION);
-}
-
-void QGoodWindow::disableCaption()
-{
-    SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) & ~WS_CAPTION);
-}
-
-void QGoodWindow::disableMinimize()
-{
-    SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) & ~WS_MINIMIZEBOX);
-}
-
-void QGoodWindow::disableMaximize()
-{
-    SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) & ~WS_MAXIMIZEBOX);
-}
-
-void QGoodWindow::frameChanged()
-{
-    SetWindowPos(m_hwnd, nullptr, 0, 0, 0, 0, SWP_NOSIZE | SWP_NOMOVE | SWP_NOACTIVATE | SWP_FRAMECHANGED);
-}
-
-void QGoodWindow::sizeMoveWindow()
-{
-    if (!isVisible() || isMinimized())
-        return;
-
-    if (windowState().testFlag(Qt::WindowNoState))
-        m_rect_normal = geometry();
-
-#ifdef QT_VERSION_QT5
-    setWindowMask();
-#endif
-
-    sizeMoveMainWindow();
-
-    moveShadow();
-}
-
-void QGoodWindow::sizeMoveMainWindow()
-{
-    bool opengl_adjust = false;
-
-#if defined QT_VERSION_QT5 && QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-    QWidgetList list;
-    if (m_central_widget)
-    {
-        list.append(m_central_widget);
-        list.append(m_central_widget->findChildren<QWidget*>());
-    }
-
-    for (QWidget *widget : list)
-    {
-        QMetaObject *obj = const_cast<QMetaObject*>(widget->metaObject());
-
-        while (obj)
-        {
-            if (obj->className() == QStringLiteral("QOpenGLWidget"))
-            {
-                opengl_adjust = true;
-                break;
-            }
-            else if (obj->className() == QStringLiteral("QQuickWidget"))
-            {
-                opengl_adjust = true;
-                break;
-            }
-
-            obj = const_cast<QMetaObject*>(obj->superClass());
-        }
-
-        if (opengl_adjust)
-            break;
-    }
-#endif
-    //Move proxy widget.
-    int y = (opengl_adjust && (!qFuzzyCompare(m_pixel_ratio, qreal(1))) ? height() : 0);
-    m_proxy_widget->setGeometry(0, y, width(), height());
-
-    HWND hwnd = HWND(m_main_window->winId());
-
-    RECT win_rect;
-    GetClientRect(m_hwnd, &win_rect);
-    int w = win_rect.right - win_rect.left;
-    int h = win_rect.bottom - win_rect.top;
-
-    //Move main window widget inside native main window.
-    SetWindowPos(hwnd, nullptr, 0, 0, w, h, SWP_NOACTIVATE);
-}
-
-void QGoodWindow::setWindowMask()
-{
-#ifdef QT_VERSION_QT5
-    if (!QtWin::isCompositionEnabled())
-    {
-        QRect window_rect = rect();
-
-        window_rect.setWidth(qFloor(window_rect.width() * m_pixel_ratio));
-        window_rect.setHeight(qFloor(window_rect.height() * m_pixel_ratio));
-
-        const int border_width = BORDERWIDTH();
-
-        if (isMaximized())
-            window_rect.moveTopLeft(QPoint(border_width, border_width));
-
-        SetWindowRgn(m_hwnd, QtWin::toHRGN(window_rect), TRUE);
-    }
-    else
-    {
-        SetWindowRgn(m_hwnd, nullptr, TRUE);
-    }
-#endif
-#ifdef QT_VERSION_QT6
-    SetWindowRgn(m_hwnd, nullptr, TRUE);
-#endif
-}
-
-void QGoodWindow::moveShadow()
-{
-    if (!m_shadow)
-        return;
-
-    if (!windowState().testFlag(Qt::WindowNoState))
-        return;
-
-    const int shadow_width = m_shadow->shadowWidth();
-    const QPoint adjusted_pos = screenAdjustedPos();
-
-    int pos_x = x() - shadow_width + adjusted_pos.x();
-    int pos_y = y() - shadow_width + adjusted_pos.y();
-    int w = width() + shadow_width * 2;
-    int h = height() + shadow_width * 2;
-
-    m_shadow->setGeometry(pos_x, pos_y, w, h);
-
-    m_shadow->setActive(isActiveWindow());
-}
-
-void QGoodWindow::screenChangeMoveWindow(QScreen *screen)
-{
-    if (!screen)
-        return;
-
-    QRect screen_geom = screen->geometry();
-    qreal screen_pixel_ratio = screen->devicePixelRatio();
-    screen_geom.setWidth(qFloor(screen_geom.width() * screen_pixel_ratio));
-    screen_geom.setHeight(qFloor(screen_geom.height() * screen_pixel_ratio));
-
-    RECT rect;
-    GetWindowRect(m_hwnd, &rect);
-
-    QRect window_geom;
-    window_geom.moveTop(rect.top);
-    window_geom.moveLeft(rect.left);
-    window_geom.setWidth(rect.right - rect.left);
-    window_geom.setHeight(rect.bottom - rect.top);
-
-    QPoint center_pos = window_geom.center();
-    int border_width = m_is_using_system_borders ? BORDERWIDTH() : 0;
-
-    QSize window_size = size();
-    window_size.setWidth(qFloor(window_size.width() * screen_pixel_ratio) + border_width * 2);
-    window_size.setHeight(qFloor(window_size.height() * screen_pixel_ratio) + border_width);
-    window_geom.setSize(window_size);
-
-    //Keep X position.
-    center_pos.setY(window_geom.center().y());
-
-    const int top_dist = qAbs(screen_geom.top() - center_pos.y());
-    const int bottom_dist = qAbs(screen_geom.bottom() - center_pos.y());
-    const int left_dist = qAbs(screen_geom.left() - center_pos.x());
-    const int right_dist = qAbs(screen_geom.right() - center_pos.x());
-
-    const int margin = 10;
-
-    QRect center_rect;
-    center_rect.moveCenter(center_pos);
-    center_rect.adjust(-margin, -margin, margin, margin);
-
-    if (!screen_geom.contains(center_rect))
-    {
-        if (left_dist < right_dist)
-        {
-            if (left_dist < top_dist && left_dist < bottom_dist)
-            {
-                center_pos.setX(screen_geom.left() + margin);
-            }
-            else if (top_dist < bottom_dist)
-            {
-                center_pos.setY(screen_geom.top() + margin);
-            }
-            else
-            {
-                center_pos.setY(screen_geom.bottom() - margin);
-            }
-        }
-        else if (left_dist > right_dist)
-        {
-            if (right_dist < top_dist && right_dist < bottom_dist)
-            {
-                center_pos.setX(screen_geom.right() - margin);
-            }
-            else if (top_dist < bottom_dist)
-            {
-                center_pos.setY(screen_geom.top() + margin);
-            }
-            else
-            {
-                center_pos.setY(screen_geom.bottom() - margin);
-            }
-        }
-    }
-
-    window_geom.moveCenter(center_pos);
-
-    m_pixel_ratio = screen_pixel_ratio;
-
-    SetWindowPos(m_hwnd, nullptr, window_geom.x(), window_geom.y(),
-                 window_geom.width(), window_geom.height(), SWP_NOACTIVATE);
-
-    moveShadow();
-}
-
-void QGoodWindow::updateScreen(QScreen *screen)
-{
-    if (!screen)
-        return;
-
-    m_pixel_ratio = screen->devicePixelRatio();
-    setCurrentScreen(screen);
-}
-
-void QGoodWindow::setCurrentScreen(QScreen *screen)
-{
-    windowHandle()->setScreen(screen);
-
-    m_main_window->windowHandle()->setScreen(screen);
-
-    if (m_shadow)
-        m_shadow->windowHandle()->setScreen(screen);
-}
-
-void QGoodWindow::windowScaleChanged()
-{
-#ifdef QT_VERSION_QT6
-    internalWidgetResize();
-#endif
-
-    //Fix widget scale bug.
-    resize(width() + 1, height() + 1);
-    qApp->processEvents();
-    resize(width() - 1, height() - 1);
-    qApp->processEvents();
-
-    sizeMoveWindow();
-    moveShadow();
-}
-
-void QGoodWindow::internalWidgetResize()
-{
-    if (!windowState().testFlag(Qt::WindowNoState))
-        return;
-
-    if (!m_window_ready_for_resize)
-        return;
-
-    const QSize current_size = size();
-    QSize mw_size = m_main_window->size();
-
-#ifdef QT_VERSION_QT5
-    mw_size.setWidth(qFloor(mw_size.width() / m_pixel_ratio));
-    mw_size.setHeight(qFloor(mw_size.height() / m_pixel_ratio));
-#endif
-
-    if (current_size.width() < qFloor(mw_size.width() * m_pixel_ratio) ||
-        current_size.width() > qCeil(mw_size.width() * m_pixel_ratio))
-        return;
-
-    if (current_size.height() < qFloor(mw_size.height() * m_pixel_ratio) ||
-        current_size.height() > qCeil(mw_size.height() * m_pixel_ratio))
-        return;
-
-    resize(mw_size);
-}
-
-QScreen *QGoodWindow::screenForWindow(HWND hwnd)
-{
-    HMONITOR monitor = MonitorFromWindow(hwnd, MONITOR_DEFAULTTONEAREST);
-
-    MONITORINFO monitor_info;
-    memset(&monitor_info, 0, sizeof(MONITORINFO));
-    monitor_info.cbSize = sizeof(MONITORINFO);
-
-    GetMonitorInfoW(monitor, &monitor_info);
-
-    QPoint top_left;
-    top_left.setX(monitor_info.rcMonitor.left);
-    top_left.setY(monitor_info.rcMonitor.top);
-
-    for (QScreen *screen : qApp->screens())
-    {
-        if (screen->geometry().topLeft() == top_left)
-        {
-            return screen;
-        }
-    }
-
-    return nullptr;
-}
-
-QPoint QGoodWindow::screenAdjustedPos()
-{
-    const QRect screen_geom = windowHandle()->screen()->geometry();
-
-    int adjust_x = qFloor(screen_geom.x() - (screen_geom.x() / m_pixel_ratio));
-    int adjust_y = qFloor(screen_geom.y() - (screen_geom.y() / m_pixel_ratio));
-
-    return QPoint(adjust_x, adjust_y);
-}
-
-QScreen *QGoodWindow::screenForPoint(const QPoint &pos)
-{
-    POINT point;
-    point.x = pos.x();
-    point.y = pos.y();
-
-    HMONITOR monitor = MonitorFromPoint(point, MONITOR_DEFAULTTONEAREST);
-
-    MONITORINFO monitor_info;
-    memset(&monitor_info, 0, sizeof(MONITORINFO));
-    monitor_info.cbSize = sizeof(MONITORINFO);
-
-    GetMonitorInfoW(monitor, &monitor_info);
-
-    QPoint top_left;
-    top_left.setX(monitor_info.rcMonitor.left);
-    top_left.setY(monitor_info.rcMonitor.top);
-
-    for (QScreen *screen : qApp->screens())
-    {
-        if (screen->geometry().topLeft() == top_left)
-        {
-            return screen;
-        }
-    }
-
-    return nullptr;
-}
-
-void QGoodWindow::showContextMenu(int x, int y)
-{
-    HMENU menu = GetSystemMenu(m_hwnd, FALSE);
-
-    if (!menu)
-        return;
-
-    MENUITEMINFOW mi;
-    memset(&mi, 0, sizeof(MENUITEMINFOW));
-    mi.cbSize = sizeof(MENUITEMINFOW);
-    mi.fMask = MIIM_STATE;
-
-    mi.fState = MF_ENABLED;
-
-    SetMenuItemInfoW(menu, SC_RESTORE, FALSE, &mi);
-    SetMenuItemInfoW(menu, SC_SIZE, FALSE, &mi);
-    SetMenuItemInfoW(menu, SC_MOVE, FALSE, &mi);
-    SetMenuItemInfoW(menu, SC_MAXIMIZE, FALSE, &mi);
-    SetMenuItemInfoW(menu, SC_MINIMIZE, FALSE, &mi);
-
-    mi.fState = MF_GRAYED;
-
-    WINDOWPLACEMENT wp;
-    GetWindowPlacement(m_hwnd, &wp);
-
-    switch (wp.showCmd)
-    {
-    case SW_SHOWMAXIMIZED:
-    {
-        SetMenuItemInfoW(menu, SC_SIZE, FALSE, &mi);
-        SetMenuItemInfoW(menu, SC_MOVE, FALSE, &mi);
-        SetMenuItemInfoW(menu, SC_MAXIMIZE, FALSE, &mi);
-        SetMenuDefaultItem(menu, SC_CLOSE, FALSE);
-        break;
-    }
-    case SW_SHOWMINIMIZED:
-    {
-        SetMenuItemInfoW(menu, SC_MINIMIZE, FALSE, &mi);
-        SetMenuDefaultItem(menu, SC_RESTORE, FALSE);
-        break;
-    }
-    case SW_SHOWNORMAL:
-    {
-        SetMenuItemInfoW(menu, SC_RESTORE, FALSE, &mi);
-        SetMenuDefaultItem(menu, SC_CLOSE, FALSE);
-        break;
-    }
-    default:
-        break;
-    }
-
-    if (!(GetWindowLongW(m_hwnd, GWL_STYLE) & WS_MAXIMIZEBOX))
-    {
-        SetMenuItemInfoW(menu, SC_MAXIMIZE, FALSE, &mi);
-        SetMenuItemInfoW(menu, SC_RESTORE, FALSE, &mi);
-    }
-
-    if (!(GetWindowLongW(m_hwnd, GWL_STYLE) & WS_MINIMIZEBOX))
-    {
-        SetMenuItemInfoW(menu, SC_MINIMIZE, FALSE, &mi);
-    }
-
-    if (FIXED_SIZE(this))
-    {
-        SetMenuItemInfoW(menu, SC_SIZE, FALSE, &mi);
-    }
-
-    int cmd = int(TrackPopupMenu(menu, TPM_RIGHTBUTTON | TPM_NONOTIFY | TPM_RETURNCMD,
-                                 x, y, 0, m_hwnd, nullptr));
-
-    if (cmd)
-    {
-        SendMessageW(m_hwnd, WM_SYSCOMMAND, WPARAM(cmd), 0);
-    }
-}
-
-void QGoodWindow::showContextMenu()
-{
-    int pos_x = x();
-    int pos_y = y() + titleBarHeight();
-
-    if (m_is_using_system_borders && windowState().testFlag(Qt::WindowNoState))
-        pos_x += BORDERWIDTH();
-
-    pos_x = qFloor(pos_x * m_pixel_ratio);
-    pos_y = qFloor(pos_y * m_pixel_ratio);
-
-    showContextMenu(pos_x, pos_y);
-}
-
-QWidget *QGoodWindow::bestParentForModalWindow()
-{
-    return new QGoodWindowUtils::ParentWindow(this);
-}
-
-void QGoodWindow::moveCenterWindow(QWidget *widget)
-{
-    QGoodWindow *child_gw = qobject_cast<QGoodWindow*>(widget);
-
-    const int title_bar_height = titleBarHeight();
-
-    int border_width = 0;
-
-    if (m_is_using_system_borders && windowState().testFlag(Qt::WindowNoState))
-        border_width = BORDERWIDTH();
-
-    QRect rect;
-
-    if (!isMinimized() && isVisible())
-        rect = frameGeometry();
-    else
-        rect = m_window_handle->screen()->availableGeometry();
-
-    QRect screen_rect = m_window_handle->screen()->availableGeometry();
-
-    QRect window_rect;
-
-    if (child_gw)
-        window_rect = child_gw->frameGeometry();
-    else
-        window_rect = widget->frameGeometry();
-
-    window_rect.moveCenter(rect.center());
-
-    if (child_gw)
-    {
-        window_rect.moveLeft(qMax(window_rect.left(), screen_rect.left()));
-        window_rect.moveTop(qMax(window_rect.top(), screen_rect.top()));
-        window_rect.moveRight(qMin(window_rect.right(), screen_rect.right()));
-        window_rect.moveBottom(qMin(window_rect.bottom(), screen_rect.bottom()));
-    }
-    else
-    {
-        window_rect.moveLeft(qMax(window_rect.left(), screen_rect.left() + border_width));
-        window_rect.moveTop(qMax(window_rect.top() + titleBarHeight(), screen_rect.top() + title_bar_height));
-        window_rect.moveRight(qMin(window_rect.right(), screen_rect.right() - border_width));
-        window_rect.moveBottom(qMin(window_rect.bottom(), screen_rect.bottom() - border_width));
-    }
-
-    if (child_gw)
-        child_gw->setGeometry(window_rect);
-    else
-        widget->setGeometry(window_rect);
-}
-
-bool QGoodWindow::winButtonHover(qintptr button)
-{
-    if (button == -1)
-        return false;
-
-    switch (button)
-    {
-    case HTMINBUTTON:
-    case HTMAXBUTTON:
-    case HTCLOSE:
-    {
-        if (!m_is_caption_button_pressed)
-        {
-            if (button != m_last_caption_button_hovered)
-                buttonLeave(m_last_caption_button_hovered);
-
-            if (isEnabled())
-                buttonEnter(button);
-        }
-        else
-        {
-            if (button != m_last_caption_button_hovered)
-                buttonLeave(m_last_caption_button_hovered);
-
-            if (!m_is_caption_button_pressed || (button == m_caption_button_pressed))
-                buttonEnter(button);
-        }
-
-        return true;
-    }
-    default:
-    {
-        buttonLeave(m_last_caption_button_hovered);
-        return false;
-    }
-    }
-}
-
-void QGoodWindow::iconClicked()
-{
-    if (!m_is_menu_visible)
-    {
-        m_is_menu_visible = true;
-
-        m_timer_menu->start();
-
-        showContextMenu();
-
-        QTimer::singleShot(qApp->doubleClickInterval(), this, [=]{
-            m_is_menu_visible = false;
-        });
-    }
-
-    if (m_timer_menu->isActive())
-        QTimer::singleShot(0, this, &QGoodWindow::close);
-}
-#endif
-#ifdef Q_OS_LINUX
-void QGoodWindow::setCursorForCurrentPos()
-{
-    const QPoint cursor_pos = QCursor::pos();
-    const int margin = int(ncHitTest(qFloor(cursor_pos.x() * m_pixel_ratio), qFloor(cursor_pos.y() * m_pixel_ratio)));
-
-    m_cursor_pos = cursor_pos;
-    m_margin = margin;
-
-    QWidget *widget = QApplication::widgetAt(cursor_pos);
-
-    if (!widget || (widget->window() != m_shadow && widget->window() != qApp->activeModalWidget()))
-    {
-        QApplication::restoreOverrideCursor();
-        return;
-    }
-
-    Display *dpy = QX11Info::display();
-
-    switch (margin)
-    {
-    case HTTOPLEFT:
-    {
-        Cursor cursor;
-
-        if (!FIXED_SIZE(this))
-            cursor = XCreateFontCursor(dpy, XC_top_left_corner);
-        else
-            cursor = XCreateFontCursor(dpy, XC_arrow);
-
-        XDefineCursor(dpy, Window(widget->winId()), cursor);
-
-        XFlush(dpy);
-
-        XFreeCursor(dpy, cursor);
-
-        break;
-    }
-    case HTTOP:
-    {
-        Cursor cursor;
-
-        if (!FIXED_HEIGHT(this))
-            cursor = XCreateFontCursor(dpy, XC_top_side);
-        else
-            cursor = XCreateFontCursor(dpy, XC_arrow);
-
-        XDefineCursor(dpy, Window(widget->winId()), cursor);
-
-        XFlush(dpy);
-
-        XFreeCursor(dpy, cursor);
-
-        break;
-    }
-    case HTTOPRIGHT:
-    {
-        Cursor cursor;
-
-        if (!FIXED_SIZE(this))
-            cursor = XCreateFontCursor(dpy, XC_top_right_corner);
-        else
-            cursor = XCreateFontCursor(dpy, XC_arrow);
-
-        XDefineCursor(dpy, Window(widget->winId()), cursor);
-
-        XFlush(dpy);
-
-        XFreeCursor(dpy, cursor);
-
-        break;
-    }
-    case HTLEFT:
-    {
-        Cursor cursor;
-
-        if (!FIXED_WIDTH(this))
-            cursor = XCreateFontCursor(dpy, XC_left_side);
-        else
-            cursor = XCreateFontCursor(dpy, XC_arrow);
-
-        XDefineCursor(dpy, Window(widget->winId()), cursor);
-
-        XFlush(dpy);
-
-        XFreeCursor(dpy, cursor);
-
-        break;
-    }
-    case HTRIGHT:
-    {
-        Cursor cursor;
-
-        if (!FIXED_WIDTH(this))
-            cursor = XCreateFontCursor(dpy, XC_right_side);
-        else
-            cursor = XCreateFontCursor(dpy, XC_arrow);
-
-        XDefineCursor(dpy, Window(widget->winId()), cursor);
-
-        XFlush(dpy);
-
-        XFreeCursor(dpy, cursor);
-
-        break;
-    }
-    case HTBOTTOMLEFT:
-    {
-        Cursor cursor;
-
-        if (!FIXED_SIZE(this))
-            cursor = XCreateFontCursor(dpy, XC_bottom_left_corner);
-        else
-            cursor = XCreateFontCursor(dpy, XC_arrow);
-
-        XDefineCursor(dpy, Window(widget->winId()), cursor);
-
-        XFlush(dpy);
-
-        XFreeCursor(dpy, cursor);
-
-        break;
-    }
-    case HTBOTTOM:
-    {
-        Cursor cursor;
-
-        if (!FIXED_HEIGHT(this))
-            cursor = XCreateFontCursor(dpy, XC_bottom_side);
-        else
-            cursor = XCreateFontCursor(dpy, XC_arrow);
-
-        XDefineCursor(dpy, Window(widget->winId()), cursor);
-
-        XFlush(dpy);
-
-        XFreeCursor(dpy, cursor);
-
-        break;
-    }
-    case HTBOTTOMRIGHT:
-    {
-        Cursor cursor;
-
-        if (!FIXED_SIZE(this))
-            cursor = XCreateFontCursor(dpy, XC_bottom_right_corner);
-        else
-            cursor = XCreateFontCursor(dpy, XC_arrow);
-
-        XDefineCursor(dpy, Window(widget->winId()), cursor);
-
-        XFlush(dpy);
-
-        XFreeCursor(dpy, cursor);
-
-        break;
-    }
-    case HTCAPTION:
-    case HTMINBUTTON:
-    case HTMAXBUTTON:
-    case HTCLOSE:
-    {
-        if (QApplication::overrideCursor() &&
-                QApplication::overrideCursor()->shape() == Qt::ArrowCursor)
-            break;
-
-        QApplication::setOverrideCursor(Qt::ArrowCursor);
-
-        break;
-    }
-    case HTNOWHERE:
-    {
-        if (!QApplication::overrideCursor())
-            break;
-
-        if (QApplication::overrideCursor()->shape() != Qt::ArrowCursor)
-            break;
-
-        QApplication::restoreOverrideCursor();
-
-        break;
-    }
-    default:
-        break;
-    }
-}
-
-void QGoodWindow::startSystemMoveResize()
-{
-    const int margin = m_margin;
-
-    if (margin == HTNOWHERE)
-        return;
-
-    if (FIXED_SIZE(this) && margin != HTCAPTION)
-        return;
-
-    QPoint cursor_pos = QPoint(qFloor(m_cursor_pos.x() * m_pixel_ratio), qFloor(m_cursor_pos.y() * m_pixel_ratio));
-
-    XClientMessageEvent xmsg;
-    memset(&xmsg, 0, sizeof(XClientMessageEvent));
-
-    xmsg.type = ClientMessage;
-    xmsg.window = Window(winId());
-    xmsg.message_type = XInternAtom(QX11Info::display(), "_NET_WM_MOVERESIZE", False);
-    xmsg.format = 32;
-    xmsg.data.l[0] = long(cursor_pos.x());
-    xmsg.data.l[1] = long(cursor_pos.y());
-
-    if (margin == HTCAPTION)
-        xmsg.data.l[2] = MOVERESIZE_MOVE;
-    else
-        xmsg.data.l[2] = long(margin);
-
-    xmsg.data.l[3] = 0;
-    xmsg.data.l[4] = 0;
-
-    XSendEvent(QX11Info::display(), QX11Info::appRootWindow(), False,
-               SubstructureRedirectMask | SubstructureNotifyMask,
-               reinterpret_cast<XEvent*>(&xmsg));
-
-    XUngrabPointer(QX11Info::display(), QX11Info::appTime());
-    XFlush(QX11Info::display());
-
-    QTimer::singleShot(qApp->doubleClickInterval(), this, [=]{
-        m_resize_move_started = true;
-    });
-}
-
-void QGoodWindow::sizeMove()
-{
-    if (!m_resize_move)
-        return;
-
-    m_resize_move = false;
-
-    const int margin = m_margin;
-
-    if (margin == HTCAPTION)
-    {
-        QTimer::singleShot(0, this, [=]{
-            startSystemMoveResize();
-        });
-    }
-    else
-    {
-        startSystemMoveResize();
-    }
-}
-
-void QGoodWindow::sizeMoveBorders()
-{
-    if (!windowState().testFlag(Qt::WindowNoState))
-        return;
-
-    const int border_width = BORDERWIDTHDPI;
-
-    QRegion visible_rgn;
-
-    for (const QScreen *screen : qApp->screens())
-    {
-        visible_rgn += screen->availableGeometry();
-    }
-
-    QRect frame_geom = frameGeometry();
-    frame_geom.adjust(-border_width, -border_width, border_width, border_width);
-
-    QRegion rgn = m_shadow->rect();
-    rgn = rgn.subtracted(mask().translated(border_width, border_width));
-
-    rgn.translate(frame_geom.topLeft());
-
-    rgn = rgn.intersected(visible_rgn);
-
-    rgn.translate(-rgn.boundingRect().topLeft());
-
-    m_shadow->setMask(rgn);
-
-    m_shadow->setGeometry(frame_geom);
-}
-#endif
-#ifdef Q_OS_MAC
-void QGoodWindow::setMacOSStyle(int style_type)
-{
-    macOSNative::Style *style = static_cast<macOSNative::Style*>(style_ptr);
-    style->m_style = macOSNative::StyleType(style_type);
-    macOSNative::setStyle(long(winId()), style);
-}
-
-void QGoodWindow::notificationReceiver(const QByteArray &notification)
-{
-    if (notification == "NSWindowWillEnterFullScreenNotification")
-    {
-        m_on_animate_event = true;
-
-        setMacOSStyle(int(macOSNative::StyleType::Fullscreen));
-    }
-    else if (notification == "NSWindowWillExitFullScreenNotification")
-    {
-        setMacOSStyle(int(macOSNative::StyleType::NoState));
-    }
-    else if (notification == "NSWindowDidExitFullScreenNotification")
-    {
-        setMacOSStyle(int(macOSNative::StyleType::NoState));
-
-        m_on_animate_event = false;
-    }
-    else if (notification == "AppleInterfaceThemeChangedNotification")
-    {
-        QTimer::singleShot(0, this, &QGoodWindow::themeChanged);
-    }
-}
-#endif
-
-#ifdef QGOODWINDOW
-qintptr QGoodWindow::ncHitTest(int pos_x, int pos_y)
-{
-    if (isFullScreen())
-    {
-        //If on full screen, the whole window can be clicked.
-        return HTNOWHERE;
-    }
-
-    int border_width = 0;
-
-#ifdef Q_OS_WIN
-    if (windowState().testFlag(Qt::WindowNoState))
-    {
-        if (m_is_using_system_borders)
-            border_width = qFloor(BORDERWIDTH() / m_pixel_ratio); //in pixels.
-        else
-            border_width = qFloor(1 * m_pixel_ratio); //in pixels.
-    }
-#endif
-
-//Get the window rectangle.
-#ifndef Q_OS_MAC
-    QRect window_rect = frameGeometry();
-#else
-    //Get the correct window rectangle for macOS.
-    QRect window_rect;
-
-    if (isVisible())
-    {
-        int x, y, w, h;
-        macOSNative::frameGeometry(long(winId()), &x, &y, &w, &h);
-        window_rect = QRect(x, y, w, h);
-    }
-#endif
-
-    //Get the point coordinates for the hit test.
-    const QPoint cursor_pos = QPoint(qFloor(pos_x / m_pixel_ratio), qFloor(pos_y / m_pixel_ratio));
-
-    //Get the mapped point coordinates for the hit test without border width.
-    const QPoint cursor_pos_map = QPoint(cursor_pos.x() - window_rect.x() - border_width, cursor_pos.y() - window_rect.y());
-
-#ifdef Q_OS_WIN
-    for (QSizeGrip *size_grip : findChildren<QSizeGrip*>())
-    {
-        if (size_grip->isEnabled() &&
-                !size_grip->window()->windowFlags().testFlag(Qt::SubWindow))
-        {
-            QPoint cursor_pos_map_widget = size_grip->parentWidget()->mapFromGlobal(cursor_pos);
-
-            QPoint adjusted_pos = screenAdjustedPos();
-
-            cursor_pos_map_widget.setX(cursor_pos_map_widget.x() + adjusted_pos.x());
-            cursor_pos_map_widget.setY(cursor_pos_map_widget.y() + adjusted_pos.y());
-
-            if (size_grip->geometry().contains(cursor_pos_map_widget))
-                return HTBOTTOMRIGHT;
-        }
-    }
-#endif
-
-    const int title_bar_height = titleBarHeight();
-
-#ifdef Q_OS_WIN
-    const int icon_width = iconWidth();
-#endif
-
-    //Determine if the hit test is for resizing. Default middle (1,1).
-    int row = 1;
-    int col = 1;
-    bool on_resize_border = false;
-
-    //Determine if the point is at the top or bottom of the window.
-    if (cursor_pos.y() < window_rect.top() + title_bar_height)
-    {
-        on_resize_border = (cursor_pos.y() < (window_rect.top() + border_width));
-        row = 0; //top border.
-    }
-    else if (cursor_pos.y() > window_rect.bottom() - border_width)
-    {
-        row = 2; //bottom border.
-    }
-
-    //Determine if the point is at the left or right of the window.
-    if (cursor_pos.x() < window_rect.left() + border_width)
-    {
-        col = 0; //left border.
-    }
-    else if (cursor_pos.x() > window_rect.right() - border_width)
-    {
-        col = 2; //right border.
-    }
-    else if (row == 0 && !on_resize_border)
-    {
-        if (m_cls_mask.contains(cursor_pos_map))
-            return HTCLOSE; //title bar close button.
-        else if (m_max_mask.contains(cursor_pos_map))
-            return HTMAXBUTTON; //title bar maximize button.
-        else if (m_min_mask.contains(cursor_pos_map))
-            return HTMINBUTTON; //title bar minimize button.
-#ifdef Q_OS_WIN
-        else if (cursor_pos_map.x() <= icon_width)
-            return HTSYSMENU; //title bar icon.
-#endif
-        else if (m_title_bar_mask.contains(cursor_pos_map))
-            return HTNOWHERE; //user title bar mask.
-    }
-
-    //Hit test (HTTOPLEFT, ... HTBOTTOMRIGHT)
-    qintptr hitTests[3][3] =
-    {
-        {HTTOPLEFT, on_resize_border ? HTTOP : HTCAPTION, HTTOPRIGHT},
-        {HTLEFT, HTNOWHERE, HTRIGHT},
-        {HTBOTTOMLEFT, HTBOTTOM, HTBOTTOMRIGHT},
-    };
-
-    return hitTests[row][col];
-}
-
-void QGoodWindow::buttonEnter(qintptr button)
-{
-    if (button == -1)
-        return;
-
-    if (button == m_last_caption_button_hovered)
-        return;
-
-    m_last_caption_button_hovered = button;
-
-    switch (button)
-    {
-    case HTMINBUTTON:
-    {
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::MinimizeHoverEnter);
-
-        break;
-    }
-    case HTMAXBUTTON:
-    {
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::MaximizeHoverEnter);
-
-        break;
-    }
-    case HTCLOSE:
-    {
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::CloseHoverEnter);
-
-        break;
-    }
-    default:
-        break;
-    }
-}
-
-void QGoodWindow::buttonLeave(qintptr button)
-{
-    if (button == -1)
-        return;
-
-    if (button != m_last_caption_button_hovered)
-        return;
-
-    m_last_caption_button_hovered = -1;
-
-    switch (button)
-    {
-    case HTMINBUTTON:
-    {
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::MinimizeHoverLeave);
-
-        break;
-    }
-    case HTMAXBUTTON:
-    {
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::MaximizeHoverLeave);
-
-        break;
-    }
-    case HTCLOSE:
-    {
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::CloseHoverLeave);
-
-        break;
-    }
-    default:
-        break;
-    }
-}
-
-bool QGoodWindow::buttonPress(qintptr button)
-{
-    if (button == -1)
-        return false;
-
-    switch (button)
-    {
-    case HTMINBUTTON:
-    {
-        m_is_caption_button_pressed = true;
-        m_caption_button_pressed = HTMINBUTTON;
-
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::MinimizePress);
-
-        activateWindow();
-
-        return true;
-    }
-    case HTMAXBUTTON:
-    {
-        m_is_caption_button_pressed = true;
-        m_caption_button_pressed = HTMAXBUTTON;
-
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::MaximizePress);
-
-        activateWindow();
-
-        return true;
-    }
-    case HTCLOSE:
-    {
-        m_is_caption_button_pressed = true;
-        m_caption_button_pressed = HTCLOSE;
-
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::ClosePress);
-
-        activateWindow();
-
-        return true;
-    }
-    default:
-        break;
-    }
-
-    return false;
-}
-
-bool QGoodWindow::buttonRelease(qintptr button, bool valid_click)
-{
-    if (button == -1)
-        return false;
-
-    if (!m_is_caption_button_pressed)
-        return false;
-
-    if (m_hover_timer->isActive())
-        return false;
-
-    m_is_caption_button_pressed = false;
-    m_caption_button_pressed = -1;
-
-    switch (button)
-    {
-    case HTMINBUTTON:
-    {
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::MinimizeRelease);
-
-        if (valid_click)
-        {
-            buttonLeave(button);
-            Q_EMIT captionButtonStateChanged(CaptionButtonState::MinimizeClicked);
-            m_hover_timer->start();
-        }
-
-        return true;
-    }
-    case HTMAXBUTTON:
-    {
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::MaximizeRelease);
-
-        if (valid_click)
-        {
-            buttonLeave(button);
-            Q_EMIT captionButtonStateChanged(CaptionButtonState::MaximizeClicked);
-            m_hover_timer->start();
-        }
-
-        return true;
-    }
-    case HTCLOSE:
-    {
-        Q_EMIT captionButtonStateChanged(CaptionButtonState::CloseRelease);
-
-        if (valid_click)
-        {
-            buttonLeave(button);
-            Q_EMIT captionButtonStateChanged(CaptionButtonState::CloseClicked);
-            m_hover_timer->start();
-        }
-
-        return true;
-    }
-    default:
-        break;
-    }
-
-    return false;
-}
-#endif
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "common.h"
+#include "qgoodwindow.h"
+#include "shadow.h"
+#include "qgooddialog.h"
+#include "../version/version.h"
+
+#ifndef QGOODWINDOW
+#ifdef Q_OS_WIN
+#undef Q_OS_WIN
+#endif
+#ifdef Q_OS_LINUX
+#undef Q_OS_LINUX
+#endif
+#ifdef Q_OS_MAC
+#undef Q_OS_MAC
+#endif
+#endif
+
+#ifdef QGOODWINDOW
+#define FIXED_WIDTH(widget) (widget->minimumWidth() >= widget->maximumWidth())
+#define FIXED_HEIGHT(widget) (widget->minimumHeight() >= widget->maximumHeight())
+#define FIXED_SIZE(widget) (FIXED_WIDTH(widget) && FIXED_HEIGHT(widget))
+
+#define TITLEUPDATEINTERVAL 16 //One frame at 60 Hz
+
+#define FRAMEDRAWNTIMEOUT 100 //Longest wait for the compositor to draw a frame
+
+#define MOVERESIZEPOLLINTERVAL 50 //Button state check rate while the window manager moves or resizes
+
+#define GEOMETRYMAGIC 0x51475747 //"QGWG"
+#define GEOMETRYVERSION 2
+#endif
+
+#ifdef Q_OS_WIN
+
+#ifdef QT_VERSION_QT5
+#include <QtWinExtras>
+#endif
+#include <windows.h>
+#include <windowsx.h>
+#include <dwmapi.h>
+
+namespace QGoodWindowUtils
+{
+class ParentWindow : public QWidget
+{
+public:
+    explicit ParentWindow(QWidget *parent) : QWidget(parent, Qt::Window)
+    {
+
+    }
+
+private:
+    bool event(QEvent *event)
+    {
+        switch (event->type())
+        {
+        case QEvent::ChildRemoved:
+        {
+            QWidget *parent_widget = parentWidget();
+
+            if (parent_widget)
+                parent_widget->activateWindow();
+
+            delete this;
+            return true;
+        }
+        default:
+            break;
+        }
+
+        return QWidget::event(event);
+    }
+};
+
+class NativeEventFilter : public QAbstractNativeEventFilter
+{
+public:
+    NativeEventFilter(QGoodWindow *gw)
+    {
+        m_gw = gw;
+        m_gw_hwnd = HWND(m_gw->winId());
+    }
+
+    bool nativeEventFilter(const QByteArray &eventType, void *message, qgoodintptr *result) override
+    {
+        Q_UNUSED(eventType)
+
+        MSG *msg = static_cast<MSG*>(message);
+
+        if (!IsWindowVisible(msg->hwnd))
+            return false;
+
+        if (!IsChild(m_gw_hwnd, msg->hwnd))
+            return false;
+
+        switch (msg->message)
+        {
+        case WM_NCHITTEST:
+        {
+            QPoint pos = QPoint(GET_X_LPARAM(msg->lParam), GET_Y_LPARAM(msg->lParam));
+
+            HRESULT lresult = HRESULT(m_gw->ncHitTest(pos.x(), pos.y()));
+
+            if (lresult == HTNOWHERE)
+                break;
+
+            //If region not contains the mouse, pass the
+            //WM_NCHITTEST event to main window.
+            *result = HTTRANSPARENT;
+            return true;
+        }
+        case WM_KEYDOWN:
+        {
+            if (GetKeyState(VK_SHIFT) & 0x8000)
+            {
+                switch (msg->wParam)
+                {
+                case VK_TAB:
+                    //Prevent that SHIFT+TAB crashes the application.
+                    return true;
+                default:
+                    break;
+                }
+            }
+
+            break;
+        }
+        case WM_SYSKEYDOWN:
+        case WM_SYSKEYUP:
+        {
+            //Pass to main window...
+
+            if ((GetKeyState(VK_SHIFT) & 0x8000) && msg->wParam == VK_F10)
+            {
+                // ...when SHIFT+F10 is pressed.
+                SendMessageW(m_gw_hwnd, msg->message, msg->wParam, msg->lParam);
+                return true;
+            }
+
+            if ((GetKeyState(VK_MENU) & 0x8000) && msg->wParam == VK_SPACE)
+            {
+                // ...when ALT+SPACE is pressed.
+                SendMessageW(m_gw_hwnd, msg->message, msg->wParam, msg->lParam);
+                return true;
+            }
+
+            break;
+        }
+        default:
+            break;
+        }
+
+        return false;
+    }
+
+private:
+    QPointer<QGoodWindow> m_gw;
+    HWND m_gw_hwnd;
+};
+
+inline bool isWinXOrGreater(DWORD major_version, DWORD minor_version, DWORD build_number)
+{
+    bool is_win_x_or_greater = false;
+
+    typedef NTSTATUS(WINAPI *tRtlGetVersion)(LPOSVERSIONINFOEXW);
+    tRtlGetVersion pRtlGetVersion = tRtlGetVersion(QLibrary::resolve("ntdll", "RtlGetVersion"));
+
+    if (pRtlGetVersion)
+    {
+        OSVERSIONINFOEXW os_info;
+        memset(&os_info, 0, sizeof(OSVERSIONINFOEXW));
+        os_info.dwOSVersionInfoSize = sizeof(OSVERSIONINFOEXW);
+        NTSTATUS status = pRtlGetVersion(&os_info);
+        if (status == 0)
+        {
+            is_win_x_or_greater = (os_info.dwMajorVersion >= major_version &&
+                                   os_info.dwMinorVersion >= minor_version &&
+                                   os_info.dwBuildNumber >= build_number);
+        }
+    }
+
+    return is_win_x_or_greater;
+}
+
+inline bool isWin11OrGreater()
+{
+    bool is_win_11_or_greater = isWinXOrGreater(10, 0, 22000);
+
+    return is_win_11_or_greater;
+}
+}
+#endif
+
+#ifdef Q_OS_LINUX
+
+#include <QtTest/QtTest>
+#ifdef QT_VERSION_QT5
+#include <QtX11Extras/QX11Info>
+#endif
+#ifdef QT_VERSION_QT6
+#include <QtGui/private/qtx11extras_p.h>
+#endif
+#include "xsettings.h"
+#include <X11/Xlib.h>
+#include <X11/Xatom.h>
+#include <X11/cursorfont.h>
+#include <X11/extensions/sync.h>
+#include <X11/extensions/XI2.h>
+#include <xcb/xcb.h>
+
+namespace QGoodWindowUtils
+{
+//All live windows, insertion and removal don't depend on the window count.
+QSet<QGoodWindow*> m_gw_set;
+
+//Font cursors are created once and shared by all windows, they are released
+//while the application still has its display, windows may outlive it.
+QHash<uint, Cursor> m_cursor_hash;
+
+void releaseFontCursors()
+{
+    Display *dpy = QX11Info::display();
+
+    if (dpy)
+    {
+        for (const Cursor cursor : m_cursor_hash)
+            XFreeCursor(dpy, cursor);
+    }
+
+    m_cursor_hash.clear();
+}
+
+Cursor fontCursor(uint shape)
+{
+    Cursor cursor = m_cursor_hash.value(shape, None);
+
+    if (cursor != None)
+        return cursor;
+
+    Display *dpy = QX11Info::display();
+
+    if (!dpy)
+        return None;
+
+    if (m_cursor_hash.isEmpty())
+        qAddPostRoutine(releaseFontCursors);
+
+    cursor = XCreateFontCursor(dpy, shape);
+
+    m_cursor_hash.insert(shape, cursor);
+
+    return cursor;
+}
+
+//Theme state shared by all windows, read from the XSETTINGS manager,
+//or from GTK when no manager is running, only when the theme changes.
+bool m_theme_registered = false;
+bool m_theme_dark = false;
+
+//GTK is not linked, it's loaded at runtime only as fallback.
+typedef int(*tgtk_init_check)(int*, char***);
+typedef void*(*tgtk_settings_get_default)();
+typedef void(*tg_object_get)(void*, const char*, ...);
+typedef void(*tg_free)(void*);
+typedef unsigned long(*tg_signal_connect_data)(void*, const char*, void(*)(), void*, void*, int);
+
+void *m_gtk_settings = nullptr;
+tg_object_get p_g_object_get = nullptr;
+tg_free p_g_free = nullptr;
+
+bool m_theme_notify_pending = false;
+
+void notifyThemeChanged()
+{
+    //Several notifications may arrive for a single theme switch,
+    //handle all windows once on the next event loop iteration.
+    if (m_theme_notify_pending)
+        return;
+
+    m_theme_notify_pending = true;
+
+    QTimer::singleShot(0, qApp, []{
+        m_theme_notify_pending = false;
+
+        //Windows may be destroyed while the theme is applied.
+        QList<QPointer<QGoodWindow>> gw_list;
+
+        for (QGoodWindow *gw : m_gw_set)
+            gw_list.append(gw);
+
+        for (const QPointer<QGoodWindow> &gw : gw_list)
+        {
+            if (gw)
+                gw->themeChanged();
+        }
+    });
+}
+
+bool queryGtkThemeDark()
+{
+    char *theme_name = nullptr;
+    p_g_object_get(m_gtk_settings, "gtk-theme-name", &theme_name, nullptr);
+    const bool dark = QString(theme_name).endsWith("Dark", Qt::CaseInsensitive);
+    p_g_free(theme_name);
+    return dark;
+}
+
+void gtkThemeChangeNotification()
+{
+    m_theme_dark = queryGtkThemeDark();
+
+    notifyThemeChanged();
+}
+
+bool registerGtkThemeChangeNotification()
+{
+    QLibrary gtk;
+
+    //Prefer the GTK version Qt's own GTK theme uses, GTK 3 aborts when GTK 2 symbols are loaded.
+#ifdef QT_VERSION_QT5
+    const QStringList gtk_names = QStringList() << "gtk-x11-2.0" << "gtk-3";
+#endif
+#ifdef QT_VERSION_QT6
+    const QStringList gtk_names = QStringList() << "gtk-3" << "gtk-x11-2.0";
+#endif
+
+    for (const QString &name : gtk_names)
+    {
+        gtk.setFileNameAndVersion(name, 0);
+
+        if (gtk.load())
+            break;
+    }
+
+    if (!gtk.isLoaded())
+        return false;
+
+    tgtk_init_check p_gtk_init_check = tgtk_init_check(gtk.resolve("gtk_init_check"));
+    tgtk_settings_get_default p_gtk_settings_get_default = tgtk_settings_get_default(gtk.resolve("gtk_settings_get_default"));
+    tg_signal_connect_data p_g_signal_connect_data = tg_signal_connect_data(gtk.resolve("g_signal_connect_data"));
+    p_g_object_get = tg_object_get(gtk.resolve("g_object_get"));
+    p_g_free = tg_free(gtk.resolve("g_free"));
+
+    if (!p_gtk_init_check || !p_gtk_settings_get_default || !p_g_signal_connect_data || !p_g_object_get || !p_g_free)
+        return false;
+
+    int argc = 0;
+    char **argv = nullptr;
+
+    if (!p_gtk_init_check(&argc, &argv))
+        return false;
+
+    m_gtk_settings = p_gtk_settings_get_default();
+
+    if (!m_gtk_settings)
+        return false;
+
+    m_theme_dark = queryGtkThemeDark();
+
+    //Notifications depend on the GLib event dispatcher.
+    p_g_signal_connect_data(m_gtk_settings, "notify::gtk-theme-name",
+                            gtkThemeChangeNotification, nullptr, nullptr, 0);
+
+    return true;
+}
+
+void registerThemeChangeNotification()
+{
+    if (m_theme_registered || !qApp)
+        return;
+
+    m_theme_registered = true;
+
+    XSettings *xsettings = XSettings::instance();
+
+    //Also tracks a settings manager started later.
+    QObject::connect(xsettings, &XSettings::themeChanged, xsettings, [=]{
+        m_theme_dark = xsettings->isThemeDark();
+        notifyThemeChanged();
+    });
+
+    if (xsettings->isValid())
+        m_theme_dark = xsettings->isThemeDark();
+    else
+        registerGtkThemeChangeNotification();
+}
+}
+#endif
+
+#ifdef Q_OS_MAC
+
+#include "macosnative.h"
+
+Notification notification;
+
+namespace QGoodWindowUtils
+{
+bool m_theme_change_registered = false;
+}
+#endif
+
+#ifdef QGOODWINDOW
+namespace QGoodWindowUtils
+{
+//Shared by all windows without icon, so the title bar icon cache renders it once,
+//it holds native pixmaps and is released while the application still exists.
+QIcon *m_default_icon = nullptr;
+
+void releaseDefaultIcon()
+{
+    delete m_default_icon;
+    m_default_icon = nullptr;
+}
+
+QIcon defaultIcon()
+{
+    if (!m_default_icon)
+    {
+        m_default_icon = new QIcon(qApp->style()->standardIcon(QStyle::SP_DesktopIcon));
+        qAddPostRoutine(releaseDefaultIcon);
+    }
+
+    return *m_default_icon;
+}
+}
+#endif
+
+namespace QGoodWindowUtils
+{
+//Created once and reused by every theme switch, the style not in use
+//is kept out of the application ownership, so it isn't deleted.
+QPointer<QStyle> m_dark_style;
+QPointer<QStyle> m_light_style;
+
+void releaseAppStyles()
+{
+    //The style in use belongs to the application.
+    for (QPointer<QStyle> *style : {&m_dark_style, &m_light_style})
+    {
+        if (*style && (*style)->parent() != qApp)
+            delete style->data();
+    }
+}
+
+void setAppStyle(QStyle *style)
+{
+    QStyle *current_style = qApp->style();
+
+    if (style == current_style)
+        return;
+
+    //QApplication deletes the previous style when it owns it.
+    if (current_style == m_dark_style || current_style == m_light_style)
+        current_style->setParent(nullptr);
+
+    qApp->setStyle(style);
+    qApp->style()->setObjectName("fusion");
+}
+}
+
+#ifndef Q_OS_WIN
+#define GOODPARENT(parent) parent
+#else
+#define GOODPARENT(parent) nullptr
+#endif
+
+QGoodWindow::QGoodWindow(QWidget *parent, const QColor &clear_color) : QMainWindow(GOODPARENT(parent))
+{
+#ifdef QGOODWINDOW
+    qRegisterMetaType<QGoodWindow::CaptionButtonState>("QGoodWindow::CaptionButtonState");
+
+    m_parent = parent;
+
+    m_is_using_system_borders = shouldBordersBeDrawnBySystem();
+
+    m_dark = isSystemThemeDark();
+
+    m_title_bar_height = 30;
+    m_icon_width = 0;
+
+    m_is_caption_button_pressed = false;
+    m_last_caption_button_hovered = -1;
+    m_caption_button_pressed = -1;
+
+    m_hover_timer = new QTimer(this);
+    m_hover_timer->setSingleShot(true);
+    m_hover_timer->setInterval(300);
+
+    m_pixel_ratio = qreal(1);
+
+    m_title_update_pending = false;
+#endif
+#ifdef Q_OS_WIN
+    m_clear_color = clear_color;
+#else
+    Q_UNUSED(clear_color)
+#endif
+#ifdef Q_OS_WIN
+    m_minimum_width = 0;
+    m_minimum_height = 0;
+    m_maximum_width = 0;
+    m_maximum_height = 0;
+#endif
+#if defined Q_OS_LINUX || defined Q_OS_MAC
+    m_last_move_button = -1;
+#endif
+#ifdef Q_OS_MAC
+    m_is_native_caption_buttons_visible_on_mac = true;
+    m_mouse_button_pressed = false;
+    m_on_animate_event = false;
+#endif
+#ifdef Q_OS_WIN
+    m_window_ready_for_resize = false;
+    m_closed = false;
+    m_visible = false;
+    m_self_generated_close_event = false;
+    m_live_resize = false;
+
+    m_timer_move = new QTimer(this);
+    connect(m_timer_move, &QTimer::timeout, this, [=]{
+        QScreen *screen = screenForWindow(m_hwnd);
+
+        if (windowHandle()->screen() != screen)
+            updateScreen(screen);
+    });
+    m_timer_move->setSingleShot(true);
+    m_timer_move->setInterval(0);
+
+    m_window_state = Qt::WindowNoState;
+
+    m_is_menu_visible = false;
+    m_timer_menu = new QTimer(this);
+    m_timer_menu->setSingleShot(true);
+    m_timer_menu->setInterval(qApp->doubleClickInterval());
+
+    m_active_state = false;
+
+    m_last_state = Qt::WindowNoState;
+
+    m_self_generated_show_event = false;
+
+    m_native_event = nullptr;
+
+    HINSTANCE hInstance = GetModuleHandleW(nullptr);
+
+    HWND parent_hwnd = nullptr;
+
+    if (m_parent)
+        parent_hwnd = HWND(m_parent->winId());
+
+    WNDCLASSEXW wcx;
+    memset(&wcx, 0, sizeof(WNDCLASSEXW));
+    wcx.cbSize = sizeof(WNDCLASSEXW);
+    wcx.style = CS_HREDRAW | CS_VREDRAW;
+    wcx.hInstance = hInstance;
+    wcx.lpfnWndProc = WNDPROC(WndProc);
+    wcx.cbClsExtra = 0;
+    wcx.cbWndExtra = 0;
+    wcx.hCursor	= LoadCursorW(nullptr, IDC_ARROW);
+    wcx.hbrBackground = HBRUSH(CreateSolidBrush(RGB(m_clear_color.red(),
+                                                    m_clear_color.green(),
+                                                    m_clear_color.blue())));
+
+    wcx.lpszClassName = L"QGoodWindowClass";
+
+    RegisterClassExW(&wcx);
+
+    m_hwnd = CreateWindowW(wcx.lpszClassName, nullptr,
+                           WS_OVERLAPPEDWINDOW | WS_CLIPCHILDREN | WS_CLIPSIBLINGS,
+                           CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT,
+                           parent_hwnd, nullptr, hInstance, nullptr);
+
+    if (!m_hwnd)
+    {
+        QMessageBox::critical(nullptr, "Error", "Error creating window");
+        return;
+    }
+
+    SetWindowLongPtrW(m_hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(this));
+
+    //Fix QApplication::exit() crash.
+    connect(qApp, &QApplication::aboutToQuit, this, &QGoodWindow::closeGW);
+
+    m_is_win_11_or_greater = QGoodWindowUtils::isWin11OrGreater();
+
+    m_window_handle = QWindow::fromWinId(WId(m_hwnd));
+
+    initGW();
+
+    m_helper_widget = new QWidget();
+
+    //Fix bug that prevents window to close on Qt 6.
+#ifdef QT_VERSION_QT6
+    m_helper_window = new QWindow();
+    m_helper_window->setFlags(Qt::Window | Qt::FramelessWindowHint | Qt::Tool);
+    m_helper_window->setGeometry(0, 0, 1, 1);
+    m_helper_window->setOpacity(0);
+#endif
+    if (!m_is_using_system_borders)
+    {
+        QGoodWindow *parent = m_parent ? this : nullptr;
+        m_shadow = new Shadow(qintptr(m_hwnd), parent, parent);
+        m_shadow->createWinId();
+        connect(m_shadow, &Shadow::showSignal, this, &QGoodWindow::moveShadow);
+    }
+
+    m_main_window = static_cast<QMainWindow*>(this);
+    m_main_window->createWinId();
+    m_main_window->installEventFilter(this);
+
+    QWidget *widget_proxy = new QWidget(m_main_window);
+    m_main_window->setCentralWidget(widget_proxy);
+
+    m_proxy_widget = new QWidget(widget_proxy);
+
+    QScreen *screen = screenForWindow(m_hwnd);
+    m_pixel_ratio = screen->devicePixelRatio();
+    setCurrentScreen(screen);
+
+    if (m_parent)
+        m_parent->installEventFilter(this);
+
+    if (!m_native_event)
+    {
+        m_native_event = new QGoodWindowUtils::NativeEventFilter(this);
+        qApp->installNativeEventFilter(m_native_event);
+    }
+
+    if (m_parent)
+    {
+        disableMinimize();
+        disableMaximize();
+    }
+
+    //Fix that hides native title bar.
+    frameChanged();
+
+#ifdef QT_VERSION_QT5
+    if (!QtWin::isCompositionEnabled())
+    {
+        disableCaption();
+        frameChanged();
+    }
+#endif
+
+#endif
+#ifdef Q_OS_LINUX
+    m_resize_move = false;
+    m_resize_move_started = false;
+    m_live_resize = false;
+    m_press_margin = HTNOWHERE;
+    m_drag_timestamp = 0;
+    m_move_resize_timestamp = 0;
+    m_move_resize_latency = -1;
+
+    m_move_resize_timer = new QTimer(this);
+    m_move_resize_timer->setSingleShot(true);
+    m_move_resize_timer->setInterval(MOVERESIZEPOLLINTERVAL);
+    connect(m_move_resize_timer, &QTimer::timeout, this, &QGoodWindow::checkSystemMoveResizeFinished);
+
+    m_sync_counter = None;
+    m_sync_value = 0;
+    m_sync_request_value = 0;
+    m_sync_request_pending = false;
+    m_frame_pending = false;
+    m_update_deferred = false;
+
+    installEventFilter(this);
+    setMouseTracking(true);
+
+    //The native window is created on first show, with the flags,
+    //title, icon and geometry set until then, see QEvent::WinIdChange.
+    m_pixel_ratio = qApp->primaryScreen()->devicePixelRatio();
+
+    QGoodWindowUtils::m_gw_set.insert(this);
+
+    //Fake window flags.
+    m_window_flags = Qt::Window | Qt::FramelessWindowHint;
+
+    if (!m_parent)
+    {
+        QMainWindow::setWindowFlags(Qt::Window | Qt::FramelessWindowHint);
+        m_window_flags |= Qt::WindowMinMaxButtonsHint;
+    }
+    else
+    {
+        QMainWindow::setWindowFlags(Qt::Window | Qt::FramelessWindowHint | Qt::Tool);
+    }
+
+    m_shadow = new Shadow(qintptr(nullptr), this, this);
+    m_shadow->installEventFilter(this);
+    m_shadow->setMouseTracking(true);
+    connect(m_shadow, &Shadow::showSignal, this, &QGoodWindow::sizeMoveBorders);
+#endif
+#ifdef Q_OS_MAC
+    installEventFilter(this);
+    setMouseTracking(true);
+
+    style_ptr = new macOSNative::Style();
+
+    macOSNative::Style *style = static_cast<macOSNative::Style*>(style_ptr);
+    style->m_is_dialog = (m_parent != nullptr);
+
+    notification.addWindow(this);
+
+    if (!QGoodWindowUtils::m_theme_change_registered)
+    {
+        QGoodWindowUtils::m_theme_change_registered = true;
+        macOSNative::registerThemeChangeNotification();
+    }
+
+    if (!m_parent)
+        QMainWindow::setWindowFlags(Qt::Window);
+    else
+        QMainWindow::setWindowFlags(Qt::Dialog);
+#endif
+#ifdef QGOODWINDOW
+    auto func_default_name_icon = [=]{
+        if (windowTitle().isEmpty())
+        {
+            setWindowTitle(qApp->applicationName());
+            QTimer::singleShot(0, this, [=]{Q_EMIT windowTitleChanged(windowTitle());});
+        }
+
+        if (windowIcon().isNull())
+        {
+            setWindowIcon(QGoodWindowUtils::defaultIcon());
+            QTimer::singleShot(0, this, [=]{Q_EMIT windowIconChanged(windowIcon());});
+        }
+    };
+#ifdef Q_OS_WIN
+    QTimer::singleShot(0, this, func_default_name_icon);
+#else
+    func_default_name_icon();
+#endif
+#endif
+}
+
+QGoodWindow::~QGoodWindow()
+{
+#ifdef Q_OS_WIN
+    if (!m_closed)
+    {
+        //Last chance to close window.
+        close();
+    }
+
+    if (m_native_event)
+    {
+        qApp->removeNativeEventFilter(m_native_event);
+        delete m_native_event;
+        m_native_event = nullptr;
+    }
+#endif
+#ifdef Q_OS_LINUX
+    releaseFrameSync();
+
+    QGoodWindowUtils::m_gw_set.remove(this);
+#endif
+#ifdef Q_OS_MAC
+    delete static_cast<macOSNative::Style*>(style_ptr);
+    notification.removeWindow(this);
+#endif
+#if defined Q_OS_LINUX || defined Q_OS_MAC
+    removeEventFilter(this);
+#endif
+}
+
+void QGoodWindow::themeChanged()
+{
+#ifdef QGOODWINDOW
+    bool dark = isSystemThemeDark();
+
+    if (m_dark != dark)
+    {
+        m_dark = dark;
+        Q_EMIT systemThemeChanged();
+    }
+#endif
+}
+
+WId QGoodWindow::winId() const
+{
+#ifdef Q_OS_WIN
+    return WId(m_hwnd);
+#else
+    return QMainWindow::winId();
+#endif
+}
+
+void QGoodWindow::setWindowFlags(Qt::WindowFlags type)
+{
+#ifdef QGOODWINDOW
+    Q_UNUSED(type)
+#else
+    QMainWindow::setWindowFlags(type);
+#endif
+}
+
+Qt::WindowFlags QGoodWindow::windowFlags() const
+{
+#if defined Q_OS_WIN
+    HWND hwnd = HWND(winId());
+
+    Qt::WindowFlags flags;
+    flags |= Qt::Window;
+    flags |= Qt::WindowTitleHint;
+    flags |= Qt::WindowSystemMenuHint;
+
+    if (GetWindowLongW(hwnd, GWL_STYLE) & WS_MINIMIZEBOX)
+        flags |= Qt::WindowMinimizeButtonHint;
+
+    if (GetWindowLongW(hwnd, GWL_STYLE) & WS_MAXIMIZEBOX)
+        flags |= Qt::WindowMaximizeButtonHint;
+
+    flags |= Qt::WindowCloseButtonHint;
+
+    return flags;
+#elif defined Q_OS_LINUX
+    return m_window_flags;
+#else
+    return QMainWindow::windowFlags();
+#endif
+}
+
+/*** QGOODWINDOW FUNCTIONS BEGIN ***/
+
+QString QGoodWindow::version()
+{
+    return QStringLiteral(QGOODWINDOW_VERSION);
+}
+
+void QGoodWindow::setup()
+{
+#ifdef QGOODWINDOW
+#ifdef QGOODCENTRALWIDGET
+    //Init resources
+    Q_INIT_RESOURCE(qgoodcentralwidget_icons);
+#endif
+
+#ifdef Q_OS_LINUX
+    qputenv("XDG_SESSION_TYPE", "xcb");
+    qputenv("QT_QPA_PLATFORM", "xcb");
+#endif
+
+#ifndef Q_OS_MAC
+
+#ifdef Q_OS_WIN
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    if (QGoodWindowUtils::isWinXOrGreater(10, 0, 15063)) //Windows 10 version 1703 or later.
+    {
+        static const qintptr vDPI_AWARENESS_CONTEXT = 0;
+        static const qintptr vDPI_AWARENESS_CONTEXT_UNAWARE = ((vDPI_AWARENESS_CONTEXT)-1);
+        static const qintptr vDPI_AWARENESS_CONTEXT_SYSTEM_AWARE = ((vDPI_AWARENESS_CONTEXT)-2);
+        static const qintptr vDPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE = ((vDPI_AWARENESS_CONTEXT)-3);
+        static const qintptr vDPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2 = ((vDPI_AWARENESS_CONTEXT)-4);
+        static const qintptr vDPI_AWARENESS_CONTEXT_UNAWARE_GDISCALED = ((vDPI_AWARENESS_CONTEXT)-5);
+
+        Q_UNUSED(vDPI_AWARENESS_CONTEXT_UNAWARE)
+        Q_UNUSED(vDPI_AWARENESS_CONTEXT_SYSTEM_AWARE)
+        Q_UNUSED(vDPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE)
+        Q_UNUSED(vDPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2)
+        Q_UNUSED(vDPI_AWARENESS_CONTEXT_UNAWARE_GDISCALED)
+
+        typedef BOOL(*tSetProcessDpiAwarenessContext)(HANDLE);
+        tSetProcessDpiAwarenessContext pSetProcessDpiAwarenessContext =
+                tSetProcessDpiAwarenessContext(QLibrary::resolve("user32", "SetProcessDpiAwarenessContext"));
+
+        if (pSetProcessDpiAwarenessContext)
+            pSetProcessDpiAwarenessContext(HANDLE(vDPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2));
+    }
+#endif
+#endif
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    qputenv("QT_ENABLE_HIGHDPI_SCALING", "1");
+#elif QT_VERSION >= QT_VERSION_CHECK(5, 6, 0)
+    QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
+#elif QT_VERSION >= QT_VERSION_CHECK(5, 4, 0)
+    qputenv("QT_DEVICE_PIXEL_RATIO", "auto");
+#endif
+
+#endif
+
+#ifdef Q_OS_MAC
+    QApplication::setAttribute(Qt::AA_DontUseNativeDialogs);
+#endif
+#endif
+}
+
+bool QGoodWindow::isSystemThemeDark()
+{
+    bool dark = false;
+#ifdef Q_OS_WIN
+    typedef LONG(WINAPI *tRegGetValueW)(HKEY,LPCWSTR,LPCWSTR,DWORD,LPDWORD,PVOID,LPDWORD);
+    tRegGetValueW pRegGetValueW = tRegGetValueW(QLibrary::resolve("advapi32", "RegGetValueW"));
+
+    if (pRegGetValueW)
+    {
+        DWORD value;
+        DWORD size = sizeof(value);
+        if (pRegGetValueW(HKEY_CURRENT_USER, L"Software\\Microsoft\\Windows\\CurrentVersion\\Themes\\Personalize",
+                          L"AppsUseLightTheme", RRF_RT_DWORD, nullptr, &value, &size) == ERROR_SUCCESS)
+            dark = (value == 0);
+    }
+#endif
+#ifdef Q_OS_LINUX
+    QGoodWindowUtils::registerThemeChangeNotification();
+    dark = QGoodWindowUtils::m_theme_dark;
+#endif
+#ifdef Q_OS_MAC
+    dark = QString(macOSNative::themeName()).endsWith("Dark", Qt::CaseInsensitive);
+#endif
+    return dark;
+}
+
+bool QGoodWindow::shouldBordersBeDrawnBySystem()
+{
+    bool drawn_by_system = true;
+#ifdef Q_OS_WIN
+    drawn_by_system = QGoodWindowUtils::isWin11OrGreater();
+#endif
+#ifdef Q_OS_LINUX
+    drawn_by_system = false;
+#endif
+    return drawn_by_system;
+}
+
+int QGoodWindow::execDialog(QDialog *dialog, QGoodWindow *child_gw, QGoodWindow *parent_gw)
+{
+#ifdef QGOODWINDOW
+    return QGoodDialog::exec(dialog, child_gw, parent_gw);
+#else
+    Q_UNUSED(child_gw)
+    Q_UNUSED(parent_gw)
+    return dialog->exec();
+#endif
+}
+
+bool QGoodWindow::openDialog(QDialog *dialog, QGoodWindow *child_gw, QGoodWindow *parent_gw,
+                             Qt::WindowModality modality)
+{
+#ifdef QGOODWINDOW
+    return QGoodDialog::open(dialog, child_gw, parent_gw, modality);
+#else
+    Q_UNUSED(child_gw)
+    Q_UNUSED(parent_gw)
+    dialog->setWindowModality(modality);
+    dialog->show();
+    return true;
+#endif
+}
+
+void QGoodWindow::setAppDarkTheme()
+{
+    if (!QGoodWindowUtils::m_dark_style)
+    {
+        if (!QGoodWindowUtils::m_light_style)
+            qAddPostRoutine(QGoodWindowUtils::releaseAppStyles);
+
+        QGoodWindowUtils::m_dark_style = new DarkStyle();
+    }
+
+    QGoodWindowUtils::setAppStyle(QGoodWindowUtils::m_dark_style);
+}
+
+void QGoodWindow::setAppLightTheme()
+{
+    if (!QGoodWindowUtils::m_light_style)
+    {
+        if (!QGoodWindowUtils::m_dark_style)
+            qAddPostRoutine(QGoodWindowUtils::releaseAppStyles);
+
+        QGoodWindowUtils::m_light_style = new LightStyle();
+    }
+
+    QGoodWindowUtils::setAppStyle(QGoodWindowUtils::m_light_style);
+}
+
+QGoodStateHolder *QGoodWindow::qGoodStateHolderInstance()
+{
+    return QGoodStateHolder::instance();
+}
+
+void QGoodWindow::setNativeCaptionButtonsVisibleOnMac(bool visible)
+{
+#ifdef Q_OS_MAC
+    m_is_native_caption_buttons_visible_on_mac = visible;
+
+    macOSNative::Style *style = static_cast<macOSNative::Style*>(style_ptr);
+    style->m_is_native_caption_buttons_visible = m_is_native_caption_buttons_visible_on_mac;
+    macOSNative::setStyle(long(winId()), style);
+
+    Q_EMIT captionButtonsVisibilityChangedOnMacOS();
+#else
+    Q_UNUSED(visible)
+#endif
+}
+
+bool QGoodWindow::isNativeCaptionButtonsVisibleOnMac() const
+{
+#ifdef Q_OS_MAC
+    return m_is_native_caption_buttons_visible_on_mac;
+#else
+    return false;
+#endif
+}
+
+QRect QGoodWindow::titleBarButtonsRectOnMacOS() const
+{
+#ifdef Q_OS_MAC
+    int x, y, w, h;
+    macOSNative::titleBarButtonsRect(long(winId()), &x, &y, &w, &h);
+    return QRect(x, y, w, h);
+#else
+    return QRect();
+#endif
+}
+
+void QGoodWindow::setTitleBarHeight(int height)
+{
+#ifdef QGOODWINDOW
+    m_title_bar_height = height;
+#else
+    Q_UNUSED(height)
+#endif
+}
+
+void QGoodWindow::setIconWidth(int width)
+{
+#ifdef QGOODWINDOW
+    m_icon_width = width;
+#else
+    Q_UNUSED(width)
+#endif
+}
+
+int QGoodWindow::titleBarHeight() const
+{
+#ifdef QGOODWINDOW
+    return m_title_bar_height;
+#else
+    return 0;
+#endif
+}
+
+int QGoodWindow::iconWidth() const
+{
+#ifdef QGOODWINDOW
+    return m_icon_width;
+#else
+    return 0;
+#endif
+}
+
+QRect QGoodWindow::titleBarRect() const
+{
+#ifdef QGOODWINDOW
+    if (!m_is_using_system_borders)
+    {
+        if (windowState().testFlag(Qt::WindowNoState))
+        {
+            return QRect(1, 1, width() - 2, titleBarHeight());
+        }
+        else
+        {
+            return QRect(0, 0, width(), titleBarHeight());
+        }
+    }
+    else
+    {
+        return QRect(0, 0, width(), titleBarHeight());
+    }
+#else
+    return QRect();
+#endif
+}
+
+void QGoodWindow::setTitleBarMask(const QRegion &mask)
+{
+#ifdef QGOODWINDOW
+    m_title_bar_mask = mask;
+#else
+    Q_UNUSED(mask)
+#endif
+}
+
+void QGoodWindow::setMinimizeMask(const QRegion &mask)
+{
+#ifdef QGOODWINDOW
+    m_min_mask = mask;
+#else
+    Q_UNUSED(mask)
+#endif
+}
+
+void QGoodWindow::setMaximizeMask(const QRegion &mask)
+{
+#ifdef QGOODWINDOW
+    m_max_mask = mask;
+#else
+    Q_UNUSED(mask)
+#endif
+}
+
+void QGoodWindow::setCloseMask(const QRegion &mask)
+{
+#ifdef QGOODWINDOW
+    m_cls_mask = mask;
+#else
+    Q_UNUSED(mask)
+#endif
+}
+
+QRegion QGoodWindow::titleBarMask() const
+{
+#ifdef QGOODWINDOW
+    return m_title_bar_mask;
+#else
+    return QRegion();
+#endif
+}
+
+QRegion QGoodWindow::minimizeMask() const
+{
+#ifdef QGOODWINDOW
+    return m_min_mask;
+#else
+    return QRegion();
+#endif
+}
+
+QRegion QGoodWindow::maximizeMask() const
+{
+#ifdef QGOODWINDOW
+    return m_max_mask;
+#else
+    return QRegion();
+#endif
+}
+
+QRegion QGoodWindow::closeMask() const
+{
+#ifdef QGOODWINDOW
+    return m_cls_mask;
+#else
+    return QRegion();
+#endif
+}
+
+qreal QGoodWindow::moveResizeLatency() const
+{
+#ifdef Q_OS_LINUX
+    if (!m_move_resize_sent_timer.isValid())
+        return qreal(-1);
+
+    if (m_move_resize_latency < 0)
+    {
+        //The X server time now, less the client time since the request was sent,
+        //tells when the server received it. Both server times wrap around every 49.7 days.
+        const qint64 elapsed_before = m_move_resize_sent_timer.elapsed();
+        const quint32 server_time = quint32(QX11Info::getTimestamp());
+        const qint64 elapsed_after = m_move_resize_sent_timer.elapsed();
+
+        const qint64 server_elapsed = qint64(quint32(server_time - m_move_resize_timestamp));
+
+        m_move_resize_latency = qMax(qint64(0), server_elapsed - (elapsed_before + elapsed_after) / 2);
+    }
+
+    return qreal(m_move_resize_latency);
+#else
+    return qreal(-1);
+#endif
+}
+
+QGoodWindow::MemoryUsage QGoodWindow::memoryUsage() const
+{
+    MemoryUsage usage;
+
+    QWidgetList widget_list;
+    widget_list.append(const_cast<QGoodWindow*>(this));
+
+    //Child windows, like dialogs, account for themselves.
+    for (QWidget *widget : findChildren<QWidget*>())
+    {
+        if (widget->window() == this)
+            widget_list.append(widget);
+    }
+
+#ifdef QGOODWINDOW
+#if defined Q_OS_WIN || defined Q_OS_LINUX
+    if (m_shadow)
+        widget_list.append(m_shadow);
+#endif
+#ifdef Q_OS_WIN
+    if (m_helper_widget)
+        widget_list.append(m_helper_widget);
+
+    //The native window that hosts the QGoodWindow.
+    usage.native_window_count++;
+
+#ifdef QT_VERSION_QT6
+    if (m_helper_window && m_helper_window->handle())
+        usage.native_window_count++;
+#endif
+#endif
+    for (const QRegion &region : {m_title_bar_mask, m_min_mask, m_max_mask, m_cls_mask})
+        usage.region_rect_count += region.rectCount();
+#endif
+
+    for (QWidget *widget : widget_list)
+    {
+        usage.widget_count++;
+
+        usage.region_rect_count += widget->mask().rectCount();
+
+        if (widget->internalWinId())
+            usage.native_window_count++;
+
+        if (widget->isWindow() && widget->backingStore())
+        {
+            QBackingStore *backing_store = widget->backingStore();
+
+            const qreal pixel_ratio = (backing_store->window() ? backing_store->window()->devicePixelRatio() : qreal(1));
+            const QSize size = backing_store->size() * pixel_ratio;
+
+            usage.backing_store_bytes += qint64(size.width()) * qint64(size.height()) * 4;
+        }
+
+        if (QGoodWindowPixmapOwner *pixmap_owner = qobject_cast<QGoodWindowPixmapOwner*>(widget))
+            usage.pixmap_bytes += pixmap_owner->pixmapBytes();
+    }
+
+    return usage;
+}
+
+QGoodWindow::MemoryUsage QGoodWindow::totalMemoryUsage()
+{
+    MemoryUsage total;
+
+#ifdef Q_OS_LINUX
+    for (QGoodWindow *gw : QGoodWindowUtils::m_gw_set)
+    {
+#else
+    for (QWidget *widget : QApplication::topLevelWidgets())
+    {
+        QGoodWindow *gw = qobject_cast<QGoodWindow*>(widget);
+
+        if (!gw)
+            continue;
+#endif
+        const MemoryUsage usage = gw->memoryUsage();
+
+        total.pixmap_bytes += usage.pixmap_bytes;
+        total.backing_store_bytes += usage.backing_store_bytes;
+        total.region_rect_count += usage.region_rect_count;
+        total.native_window_count += usage.native_window_count;
+        total.widget_count += usage.widget_count;
+    }
+
+    return total;
+}
+/*** QGOODWINDOW FUNCTIONS END ***/
+
+void QGoodWindow::setCentralWidget(QWidget *widget)
+{
+#ifdef Q_OS_WIN
+    if (m_proxy_widget->layout())
+        delete m_proxy_widget->layout();
+
+    QHBoxLayout *layout = new QHBoxLayout(m_proxy_widget);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(widget);
+
+    m_central_widget = widget;
+#else
+    QMainWindow::setCentralWidget(widget);
+#endif
+}
+
+QWidget *QGoodWindow::centralWidget() const
+{
+#ifdef Q_OS_WIN
+    return m_central_widget;
+#else
+    return QMainWindow::centralWidget();
+#endif
+}
+
+QSize QGoodWindow::sizeHint() const
+{
+#ifdef Q_OS_WIN
+    if (!m_central_widget)
+        return QMainWindow::sizeHint();
+
+    return m_central_widget->sizeHint();
+#else
+    return QMainWindow::sizeHint();
+#endif
+}
+
+QSize QGoodWindow::minimumSizeHint() const
+{
+#ifdef Q_OS_WIN
+    if (!m_central_widget)
+        return QMainWindow::minimumSizeHint();
+
+    return m_central_widget->minimumSizeHint();
+#else
+    return QMainWindow::minimumSizeHint();
+#endif
+}
+
+void QGoodWindow::setFixedSize(int w, int h)
+{
+#ifdef Q_OS_WIN
+    bool already_fixed = FIXED_SIZE(this);
+
+    setMinimumWidth(w);
+    setMaximumWidth(w);
+
+    setMinimumHeight(h);
+    setMaximumHeight(h);
+
+    if (!already_fixed)
+    {
+        if (!m_parent)
+            disableMinimize();
+
+        disableMaximize();
+    }
+
+    resize(w, h);
+#else
+#ifdef Q_OS_LINUX
+    m_window_flags ^= Qt::WindowMaximizeButtonHint;
+#endif
+    QMainWindow::setFixedSize(w, h);
+#endif
+}
+
+void QGoodWindow::setFixedSize(const QSize &size)
+{
+#if defined Q_OS_WIN
+    setFixedSize(size.width(), size.height());
+#else
+    QMainWindow::setFixedSize(size);
+#endif
+}
+
+void QGoodWindow::setMinimumSize(const QSize &size)
+{
+#ifdef Q_OS_WIN
+    setMinimumWidth(size.width());
+    setMinimumHeight(size.height());
+#else
+    QMainWindow::setMinimumSize(size);
+#endif
+}
+
+void QGoodWindow::setMaximumSize(const QSize &size)
+{
+#ifdef Q_OS_WIN
+    setMaximumWidth(size.width());
+    setMaximumHeight(size.height());
+#else
+    QMainWindow::setMaximumSize(size);
+#endif
+}
+
+void QGoodWindow::setMinimumWidth(int w)
+{
+#ifdef Q_OS_WIN
+    m_minimum_width = qMax(w, 0);
+#else
+    QMainWindow::setMinimumWidth(w);
+#endif
+}
+
+void QGoodWindow::setMinimumHeight(int h)
+{
+#ifdef Q_OS_WIN
+    m_minimum_height = qMax(h, 0);
+#else
+    QMainWindow::setMinimumHeight(h);
+#endif
+}
+
+void QGoodWindow::setMaximumWidth(int w)
+{
+#ifdef Q_OS_WIN
+    m_maximum_width = qMax(w, 0);
+#else
+    QMainWindow::setMaximumWidth(w);
+#endif
+}
+
+void QGoodWindow::setMaximumHeight(int h)
+{
+#ifdef Q_OS_WIN
+    m_maximum_height = qMax(h, 0);
+#else
+    QMainWindow::setMaximumHeight(h);
+#endif
+}
+
+QSize QGoodWindow::minimumSize() const
+{
+#ifdef Q_OS_WIN
+    return QSize(minimumWidth(), minimumHeight());
+#else
+    return QMainWindow::minimumSize();
+#endif
+}
+
+QSize QGoodWindow::maximumSize() const
+{
+#ifdef Q_OS_WIN
+    return QSize(maximumWidth(), maximumHeight());
+#else
+    return QMainWindow::maximumSize();
+#endif
+}
+
+int QGoodWindow::minimumWidth() const
+{
+#ifdef Q_OS_WIN
+    return (m_minimum_width > 0 ? m_minimum_width : QMainWindow::minimumWidth());
+#else
+    return QMainWindow::minimumWidth();
+#endif
+}
+
+int QGoodWindow::minimumHeight() const
+{
+#ifdef Q_OS_WIN
+    return (m_minimum_height > 0 ? m_minimum_height : QMainWindow::minimumHeight());
+#else
+    return QMainWindow::minimumHeight();
+#endif
+}
+
+int QGoodWindow::maximumWidth() const
+{
+#ifdef Q_OS_WIN
+    return (m_maximum_width > 0 ? m_maximum_width : QMainWindow::maximumWidth());
+#else
+    return QMainWindow::maximumWidth();
+#endif
+}
+
+int QGoodWindow::maximumHeight() const
+{
+#ifdef Q_OS_WIN
+    return (m_maximum_height > 0 ? m_maximum_height : QMainWindow::maximumHeight());
+#else
+    return QMainWindow::maximumHeight();
+#endif
+}
+
+QRect QGoodWindow::normalGeometry() const
+{
+#ifdef Q_OS_WIN
+    return m_rect_normal;
+#else
+    return QMainWindow::normalGeometry();
+#endif
+}
+
+QRect QGoodWindow::frameGeometry() const
+{
+#ifdef Q_OS_WIN
+    RECT window_rect;
+    GetWindowRect(m_hwnd, &window_rect);
+
+    int x = qFloor(window_rect.left / m_pixel_ratio);
+    int y = qFloor(window_rect.top / m_pixel_ratio);
+    int w = qFloor((window_rect.right - window_rect.left) / m_pixel_ratio);
+    int h = qFloor((window_rect.bottom - window_rect.top) / m_pixel_ratio);
+
+    QRect rect = QRect(x, y, w, h);
+
+    if (isMaximized())
+    {
+        const int border_width = BORDERWIDTH();
+        rect.adjust(border_width, border_width, -border_width, -border_width);
+    }
+
+    return rect;
+#else
+    return QMainWindow::frameGeometry();
+#endif
+}
+
+QRect QGoodWindow::geometry() const
+{
+#ifdef Q_OS_WIN
+    RECT client_rect;
+    GetClientRect(m_hwnd, &client_rect);
+
+    int w = qFloor((client_rect.right - client_rect.left) / m_pixel_ratio);
+    int h = qFloor((client_rect.bottom - client_rect.top) / m_pixel_ratio);
+
+    QRect rect = QRect(x(), y(), w, h);
+
+    return rect;
+#else
+    return QMainWindow::geometry();
+#endif
+}
+
+QRect QGoodWindow::rect() const
+{
+#ifdef Q_OS_WIN
+    return QRect(0, 0, width(), height());
+#else
+    return QMainWindow::rect();
+#endif
+}
+
+QPoint QGoodWindow::pos() const
+{
+#ifdef Q_OS_WIN
+    return frameGeometry().topLeft();
+#else
+    return QMainWindow::pos();
+#endif
+}
+
+QSize QGoodWindow::size() const
+{
+#ifdef Q_OS_WIN
+    return QSize(width(), height());
+#else
+    return QMainWindow::size();
+#endif
+}
+
+int QGoodWindow::x() const
+{
+#ifdef Q_OS_WIN
+    return pos().x();
+#else
+    return QMainWindow::x();
+#endif
+}
+
+int QGoodWindow::y() const
+{
+#ifdef Q_OS_WIN
+    return pos().y();
+#else
+    return QMainWindow::y();
+#endif
+}
+
+int QGoodWindow::width() const
+{
+#ifdef Q_OS_WIN
+    return geometry().width();
+#else
+    return QMainWindow::width();
+#endif
+}
+
+int QGoodWindow::height() const
+{
+#ifdef Q_OS_WIN
+    return geometry().height();
+#else
+    return QMainWindow::height();
+#endif
+}
+
+void QGoodWindow::move(int x, int y)
+{
+#ifdef Q_OS_WIN
+    x = qFloor(x * m_pixel_ratio);
+    y = qFloor(y * m_pixel_ratio);
+
+    SetWindowPos(m_hwnd, nullptr, x, y, 0, 0, SWP_NOSIZE | SWP_NOACTIVATE);
+#else
+    QMainWindow::move(x, y);
+#endif
+}
+
+void QGoodWindow::move(const QPoint &pos)
+{
+#ifdef Q_OS_WIN
+    move(pos.x(), pos.y());
+#else
+    QMainWindow::move(pos);
+#endif
+}
+
+void QGoodWindow::resize(int width, int height)
+{
+#ifdef Q_OS_WIN
+    width = qFloor(width * m_pixel_ratio);
+    height = qFloor(height * m_pixel_ratio);
+
+    if (m_is_using_system_borders)
+    {
+        width += BORDERWIDTH() * 2;
+        height += BORDERHEIGHT();
+    }
+
+    SetWindowPos(m_hwnd, nullptr, 0, 0, width, height, SWP_NOMOVE | SWP_NOACTIVATE);
+#else
+    QMainWindow::resize(width, height);
+#endif
+}
+
+void QGoodWindow::resize(const QSize &size)
+{
+#ifdef Q_OS_WIN
+    resize(size.width(), size.height());
+#else
+    QMainWindow::resize(size);
+#endif
+}
+
+void QGoodWindow::setGeometry(int x, int y, int w, int h)
+{
+#ifdef Q_OS_WIN
+    move(x, y);
+    resize(w, h);
+#else
+    QMainWindow::setGeometry(x, y, w, h);
+#endif
+}
+
+void QGoodWindow::setGeometry(const QRect &rect)
+{
+#ifdef Q_OS_WIN
+    setGeometry(rect.x(), rect.y(), rect.width(), rect.height());
+#else
+    QMainWindow::setGeometry(rect);
+#endif
+}
+
+void QGoodWindow::activateWindow()
+{
+#ifdef Q_OS_WIN
+    SetForegroundWindow(m_hwnd);
+#else
+    QMainWindow::activateWindow();
+#endif
+}
+
+void QGoodWindow::show()
+{
+#ifdef Q_OS_WIN
+    if (!isVisible() && !m_window_state.testFlag(Qt::WindowNoState))
+    {
+        setWindowStateWin();
+        return;
+    }
+
+    ShowWindow(m_hwnd, SW_SHOW);
+#else
+    QMainWindow::show();
+#endif
+}
+
+void QGoodWindow::showNormal()
+{
+#ifdef Q_OS_WIN
+    if (isFullScreen())
+    {
+        m_window_state ^= Qt::WindowFullScreen;
+        SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) | WS_OVERLAPPEDWINDOW);
+        setGeometry(normalGeometry());
+        setWindowMask();
+    }
+
+    ShowWindow(m_hwnd, SW_SHOWNORMAL);
+#else
+    QMainWindow::showNormal();
+#endif
+}
+
+void QGoodWindow::showMaximized()
+{
+#if defined Q_OS_WIN || defined Q_OS_LINUX
+    if (FIXED_SIZE(this))
+        return;
+#endif
+#ifdef Q_OS_WIN
+    if (isFullScreen())
+        showNormal();
+
+    ShowWindow(m_hwnd, SW_SHOWMAXIMIZED);
+#else
+    QMainWindow::showMaximized();
+#endif
+}
+
+void QGoodWindow::showMinimized()
+{
+#ifdef Q_OS_WIN
+    if (isFullScreen())
+        showNormal();
+
+    ShowWindow(m_hwnd, SW_MINIMIZE);
+#else
+    QMainWindow::showMinimized();
+#endif
+}
+
+void QGoodWindow::showFullScreen()
+{
+#if defined Q_OS_WIN || defined Q_OS_LINUX
+    if (FIXED_SIZE(this))
+        return;
+#endif
+#ifdef Q_OS_WIN
+    if (isFullScreen())
+        return;
+
+    m_window_state = Qt::WindowFullScreen;
+
+    ShowWindow(m_hwnd, SW_SHOWNORMAL);
+
+    SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) & ~WS_OVERLAPPEDWINDOW);
+
+    HMONITOR monitor = MonitorFromWindow(m_hwnd, MONITOR_DEFAULTTONEAREST);
+
+    MONITORINFO monitor_info;
+    memset(&monitor_info, 0, sizeof(MONITORINFO));
+    monitor_info.cbSize = sizeof(MONITORINFO);
+
+    GetMonitorInfoW(monitor, &monitor_info);
+
+    QRect screen_geom;
+    screen_geom.moveTop(monitor_info.rcMonitor.top);
+    screen_geom.moveLeft(monitor_info.rcMonitor.left);
+    screen_geom.setWidth(monitor_info.rcMonitor.right - monitor_info.rcMonitor.left);
+    screen_geom.setHeight(monitor_info.rcMonitor.bottom - monitor_info.rcMonitor.top);
+
+    SetWindowPos(m_hwnd, nullptr, screen_geom.x(), screen_geom.y(),
+                 screen_geom.width(), screen_geom.height(), SWP_NOACTIVATE);
+
+    QRect window_rect;
+    window_rect.moveTop(0);
+    window_rect.moveLeft(0);
+    window_rect.setWidth(screen_geom.width());
+    window_rect.setHeight(screen_geom.height());
+
+#ifdef QT_VERSION_QT5
+    HRGN hrgn = QtWin::toHRGN(QRegion(window_rect));
+#endif
+#ifdef QT_VERSION_QT6
+    HRGN hrgn = QRegion(window_rect).toHRGN();
+#endif
+
+    SetWindowRgn(m_hwnd, hrgn, TRUE);
+
+    sizeMoveWindow();
+#else
+    QMainWindow::showFullScreen();
+#endif
+}
+
+void QGoodWindow::hide()
+{
+#ifdef Q_OS_WIN
+    ShowWindow(m_hwnd, SW_HIDE);
+#else
+    QMainWindow::hide();
+#endif
+}
+
+bool QGoodWindow::close()
+{
+#ifdef Q_OS_WIN
+    if (m_closed)
+        return true;
+
+    SendMessageW(m_hwnd, WM_CLOSE, 0, 0);
+
+    return m_closed;
+#else
+    return QMainWindow::close();
+#endif
+}
+
+bool QGoodWindow::isVisible() const
+{
+#ifdef Q_OS_WIN
+    return IsWindowVisible(m_hwnd);
+#else
+    return QMainWindow::isVisible();
+#endif
+}
+
+bool QGoodWindow::isEnabled() const
+{
+#ifdef Q_OS_WIN
+    return IsWindowEnabled(m_hwnd);
+#else
+    return QMainWindow::isEnabled();
+#endif
+}
+
+bool QGoodWindow::isActiveWindow() const
+{
+#ifdef Q_OS_WIN
+    const HWND active_window = GetActiveWindow();
+    return ((active_window == m_hwnd) || IsChild(m_hwnd, active_window));
+#else
+    return QMainWindow::isActiveWindow();
+#endif
+}
+
+bool QGoodWindow::isMaximized() const
+{
+#ifdef Q_OS_WIN
+    WINDOWPLACEMENT wp;
+    wp.length = sizeof(WINDOWPLACEMENT);
+    GetWindowPlacement(m_hwnd, &wp);
+    return (wp.showCmd == SW_SHOWMAXIMIZED);
+#else
+    return QMainWindow::isMaximized();
+#endif
+}
+
+bool QGoodWindow::isMinimized() const
+{
+#ifdef Q_OS_WIN
+    WINDOWPLACEMENT wp;
+    wp.length = sizeof(WINDOWPLACEMENT);
+    GetWindowPlacement(m_hwnd, &wp);
+    return (wp.showCmd == SW_SHOWMINIMIZED);
+#else
+    return QMainWindow::isMinimized();
+#endif
+}
+
+bool QGoodWindow::isFullScreen() const
+{
+#ifdef Q_OS_WIN
+    return windowState().testFlag(Qt::WindowFullScreen);
+#else
+    return QMainWindow::isFullScreen();
+#endif
+}
+
+Qt::WindowStates QGoodWindow::windowState() const
+{
+#ifdef Q_OS_WIN
+    return m_window_state;
+#else
+    return QMainWindow::windowState();
+#endif
+}
+
+void QGoodWindow::setWindowState(Qt::WindowStates state)
+{
+#ifdef Q_OS_WIN
+    m_window_state = state;
+
+    if (!isVisible())
+        return;
+
+    setWindowStateWin();
+#else
+    QMainWindow::setWindowState(state);
+#endif
+}
+
+QWindow *QGoodWindow::windowHandle() const
+{
+#ifdef Q_OS_WIN
+    return m_window_handle;
+#else
+    return QMainWindow::windowHandle();
+#endif
+}
+
+qreal QGoodWindow::windowOpacity() const
+{
+#ifdef Q_OS_WIN
+    return windowHandle()->opacity();
+#else
+    return QMainWindow::windowOpacity();
+#endif
+}
+
+void QGoodWindow::setWindowOpacity(qreal level)
+{
+#ifdef Q_OS_WIN
+    windowHandle()->setOpacity(level);
+#else
+    //Applied now or when the native window is created.
+    QMainWindow::setWindowOpacity(level);
+#endif
+}
+
+QString QGoodWindow::windowTitle() const
+{
+#ifdef QGOODWINDOW
+    if (m_title_update_pending)
+        return m_window_title;
+#endif
+    return QMainWindow::windowTitle();
+}
+
+void QGoodWindow::setWindowTitle(const QString &title)
+{
+#ifdef QGOODWINDOW
+    if (title == windowTitle())
+        return;
+
+    m_window_title = title;
+
+    //Each title change goes through the native window and the title bar,
+    //coalesce frequent changes to at most one per frame.
+
+    if (m_title_update_pending)
+        return;
+
+    const qint64 elapsed = (m_title_update_timer.isValid() ?
+                                m_title_update_timer.elapsed() : qint64(TITLEUPDATEINTERVAL));
+
+    if (elapsed >= TITLEUPDATEINTERVAL)
+    {
+        setWindowTitleNow();
+        return;
+    }
+
+    m_title_update_pending = true;
+
+    QTimer::singleShot(int(TITLEUPDATEINTERVAL - elapsed), this, [=]{
+        m_title_update_pending = false;
+        setWindowTitleNow();
+    });
+#else
+    QMainWindow::setWindowTitle(title);
+#endif
+}
+
+#ifdef QGOODWINDOW
+void QGoodWindow::setWindowTitleNow()
+{
+    m_title_update_timer.start();
+
+    if (m_window_title == QMainWindow::windowTitle())
+        return;
+
+#ifdef Q_OS_WIN
+    SetWindowTextW(m_hwnd, reinterpret_cast<const WCHAR*>(m_window_title.utf16()));
+#endif
+    QMainWindow::setWindowTitle(m_window_title);
+}
+#endif
+
+QIcon QGoodWindow::windowIcon() const
+{
+    return QMainWindow::windowIcon();
+}
+
+void QGoodWindow::setWindowIcon(const QIcon &icon)
+{
+#ifdef Q_OS_WIN
+
+#ifdef QT_VERSION_QT5
+    HICON hicon_big = QtWin::toHICON(icon.pixmap(GetSystemMetrics(SM_CXICON),
+                                                 GetSystemMetrics(SM_CYICON)));
+    HICON hicon_small = QtWin::toHICON(icon.pixmap(GetSystemMetrics(SM_CXSMICON),
+                                                   GetSystemMetrics(SM_CYSMICON)));
+#endif
+#ifdef QT_VERSION_QT6
+    HICON hicon_big = icon.pixmap(GetSystemMetrics(SM_CXICON),
+                                  GetSystemMetrics(SM_CYICON)).toImage().toHICON();
+    HICON hicon_small = icon.pixmap(GetSystemMetrics(SM_CXSMICON),
+                                    GetSystemMetrics(SM_CYSMICON)).toImage().toHICON();
+#endif
+
+    SendMessageW(m_hwnd, WM_SETICON, ICON_BIG, LPARAM(hicon_big));
+    SendMessageW(m_hwnd, WM_SETICON, ICON_SMALL, LPARAM(hicon_small));
+
+    QMainWindow::setWindowIcon(icon);
+#else
+    QMainWindow::setWindowIcon(icon);
+#endif
+}
+
+QByteArray QGoodWindow::saveGeometry() const
+{
+#ifdef QGOODWINDOW
+    QByteArray geometry;
+    QDataStream stream(&geometry, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    const QRect window_geom = normalGeometry();
+
+    QScreen *screen = windowHandle() ? windowHandle()->screen() : nullptr;
+
+    stream << quint32(GEOMETRYMAGIC);
+    stream << quint16(GEOMETRYVERSION);
+    stream << (screen ? screen->name() : QString());
+    stream << double(m_pixel_ratio);
+    stream << qint32(window_geom.x());
+    stream << qint32(window_geom.y());
+    stream << qint32(window_geom.width());
+    stream << qint32(window_geom.height());
+    stream << windowState().testFlag(Qt::WindowMinimized);
+    stream << windowState().testFlag(Qt::WindowMaximized);
+    stream << windowState().testFlag(Qt::WindowFullScreen);
+
+    return geometry;
+#else
+    return QMainWindow::saveGeometry();
+#endif
+}
+
+bool QGoodWindow::restoreGeometry(const QByteArray &geometry)
+{
+#ifdef QGOODWINDOW
+    QDataStream stream(geometry);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    quint32 magic = 0;
+    quint16 version = 1;
+    QString screen_name;
+    double pixel_ratio = 0;
+
+    //Version 1 had no header and stored the geometry in physical pixels.
+    const bool legacy = (geometry.size() == int(sizeof(qint32) * 4 + sizeof(bool) * 3));
+
+    if (!legacy)
+    {
+        stream >> magic;
+        stream >> version;
+
+        if (magic != GEOMETRYMAGIC || version < 2 || version > GEOMETRYVERSION)
+            return false;
+
+        stream >> screen_name;
+        stream >> pixel_ratio;
+
+        if (pixel_ratio <= 0)
+            return false;
+    }
+
+    qint32 rect_x;
+    qint32 rect_y;
+    qint32 rect_width;
+    qint32 rect_height;
+    bool minimized;
+    bool maximized;
+    bool fullscreen;
+
+    stream >> rect_x;
+    stream >> rect_y;
+    stream >> rect_width;
+    stream >> rect_height;
+    stream >> minimized;
+    stream >> maximized;
+    stream >> fullscreen;
+
+    if (stream.status() != QDataStream::Ok)
+        return false;
+
+    QScreen *screen = nullptr;
+
+    for (QScreen *current_screen : qApp->screens())
+    {
+        if (!screen_name.isEmpty() && current_screen->name() == screen_name)
+        {
+            screen = current_screen;
+            break;
+        }
+    }
+
+    QRect window_geom;
+    window_geom.moveTop(rect_y);
+    window_geom.moveLeft(rect_x);
+    window_geom.setWidth(rect_width);
+    window_geom.setHeight(rect_height);
+
+    if (!legacy)
+    {
+        //Work in physical pixels of the screen the window was saved on.
+        window_geom.moveTop(qFloor(window_geom.y() * pixel_ratio));
+        window_geom.moveLeft(qFloor(window_geom.x() * pixel_ratio));
+        window_geom.setWidth(qFloor(window_geom.width() * pixel_ratio));
+        window_geom.setHeight(qFloor(window_geom.height() * pixel_ratio));
+    }
+
+    QRegion screens;
+
+    for (QScreen *current_screen : qApp->screens())
+    {
+        QRect rect = current_screen->geometry();
+        qreal current_pixel_ratio = current_screen->devicePixelRatio();
+        rect.setWidth(qFloor(rect.width() * current_pixel_ratio));
+        rect.setHeight(qFloor(rect.height() * current_pixel_ratio));
+        screens += rect;
+    }
+
+    if (!screens.boundingRect().contains(window_geom))
+    {
+        //The saved screen is gone or the layout changed.
+        screen = qApp->primaryScreen();
+
+        QRect rect = screen->availableGeometry();
+        qreal current_pixel_ratio = screen->devicePixelRatio();
+        rect.setWidth(qFloor(rect.width() * current_pixel_ratio));
+        rect.setHeight(qFloor(rect.height() * current_pixel_ratio));
+
+        window_geom.moveCenter(rect.center());
+        window_geom.setWidth(qMin(rect.width(), window_geom.width()));
+        window_geom.setHeight(qMin(rect.height(), window_geom.height()));
+    }
+
+#ifdef Q_OS_WIN
+    updateScreen(screen ? screen : screenForPoint(window_geom.center()));
+#else
+    //Place the window on its screen before it is mapped,
+    //this needs the native window, which is otherwise created on first show.
+    if (screen && !isVisible())
+    {
+        if (!windowHandle())
+            createWinId();
+
+        windowHandle()->setScreen(screen);
+        m_pixel_ratio = screen->devicePixelRatio();
+    }
+#endif
+
+    if (!legacy)
+        pixel_ratio = screen ? screen->devicePixelRatio() : m_pixel_ratio;
+    else
+        pixel_ratio = m_pixel_ratio;
+
+    window_geom.moveTop(qFloor(window_geom.y() / pixel_ratio));
+    window_geom.moveLeft(qFloor(window_geom.x() / pixel_ratio));
+    window_geom.setWidth(qFloor(window_geom.width() / pixel_ratio));
+    window_geom.setHeight(qFloor(window_geom.height() / pixel_ratio));
+
+#ifdef Q_OS_WIN
+    m_rect_normal = window_geom;
+#endif
+
+    setGeometry(window_geom);
+
+    //While hidden the state is only recorded, show() maps the window in it.
+    if (minimized)
+        setWindowState(Qt::WindowMinimized);
+    else if (maximized)
+        setWindowState(Qt::WindowMaximized);
+    else if (fullscreen)
+        setWindowState(Qt::WindowFullScreen);
+
+    return true;
+#else
+    return QMainWindow::restoreGeometry(geometry);
+#endif
+}
+
+bool QGoodWindow::restoreGeometryAndShow(const QByteArray &geometry)
+{
+    if (isVisible())
+        return false;
+
+    if (!restoreGeometry(geometry))
+        return false;
+
+    show();
+
+    return true;
+}
+
+bool QGoodWindow::event(QEvent *event)
+{
+#if defined Q_OS_LINUX || defined Q_OS_MAC
+    switch (event->type())
+    {
+    case QEvent::Leave:
+    {
+        buttonLeave(m_last_caption_button_hovered);
+        m_last_move_button = -1;
+
+        break;
+    }
+    case QEvent::Hide:
+    case QEvent::HoverLeave:
+    {
+        if (QApplication::overrideCursor())
+            QApplication::restoreOverrideCursor();
+
+        break;
+    }
+    default:
+        break;
+    }
+#endif
+#ifdef Q_OS_WIN
+    switch (event->type())
+    {
+    case QEvent::ChildPolished:
+    {
+        QChildEvent *child_event = static_cast<QChildEvent*>(event);
+
+        QWidget *widget = qobject_cast<QWidget*>(child_event->child());
+
+        if (!widget)
+            break;
+
+//Catch QMenu show event to fix show bug.
+#if defined QT_VERSION_QT5 && QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+        for (QWidget *widget : widget->findChildren<QWidget*>())
+        {
+            if (widget->metaObject()->className() == QStringLiteral("QMenu") ||
+                widget->metaObject()->className() == QStringLiteral("QComboBoxPrivateContainer"))
+            {
+                widget->installEventFilter(this);
+            }
+        }
+#endif
+
+        if (!widget->isWindow())
+            break;
+
+        if (!widget->isModal())
+            break;
+
+        bool is_file_dialog = bool(qobject_cast<QFileDialog*>(widget));
+
+        widget->adjustSize();
+        widget->installEventFilter(this);
+        widget->setParent(bestParentForModalWindow(),
+                          (!is_file_dialog ? widget->windowFlags() : Qt::WindowFlags(0)));
+
+        break;
+    }
+    case QEvent::WindowBlocked:
+    {
+        EnableWindow(m_hwnd, FALSE);
+        break;
+    }
+    case QEvent::WindowUnblocked:
+    {
+        EnableWindow(m_hwnd, TRUE);
+        break;
+    }
+    case QEvent::Show:
+    case QEvent::WindowStateChange:
+    {
+        bool window_no_state = windowState().testFlag(Qt::WindowNoState);
+
+        for (QSizeGrip *size_grip : m_size_grip_set)
+        {
+            if (!size_grip->window()->windowFlags().testFlag(Qt::SubWindow))
+                size_grip->setVisible(window_no_state);
+        }
+
+        break;
+    }
+    case QEvent::Resize:
+    {
+        internalWidgetResize();
+
+        break;
+    }
+    case QEvent::Close:
+    {
+        if (m_closed)
+        {
+            hide();
+            return true;
+        }
+
+        break;
+    }
+    default:
+        break;
+    }
+#endif
+#ifdef Q_OS_LINUX
+    switch (event->type())
+    {
+    case QEvent::WinIdChange:
+    {
+        if (!windowHandle())
+            break;
+
+        //Track the ratio of the screen the window is on, instead of querying it on every event.
+        //Connect on every native window creation, setWindowFlags() replaces the window handle.
+        connect(windowHandle(), &QWindow::screenChanged, this, &QGoodWindow::updatePixelRatio, Qt::UniqueConnection);
+        updatePixelRatio();
+
+        QGoodWindowUtils::registerThemeChangeNotification();
+
+        setupFrameSync();
+
+        break;
+    }
+#if QT_VERSION >= QT_VERSION_CHECK(6, 6, 0)
+    case QEvent::DevicePixelRatioChange:
+    {
+        //The ratio of the screen changed without the window changing screen.
+        updatePixelRatio();
+        break;
+    }
+#endif
+    case QEvent::UpdateRequest:
+    {
+        if (m_sync_counter == None)
+            break;
+
+        //While the window manager resizes the window, don't paint a new frame until the compositor
+        //has drawn the previous one, sizes that become obsolete meanwhile are never painted.
+        const bool hold_frames = m_live_resize;
+
+        if (hold_frames && m_frame_pending)
+        {
+            m_update_deferred = true;
+            return true;
+        }
+
+        const quint64 value = startFrameSync();
+
+        const bool return_value = QMainWindow::event(event);
+
+        setFrameSyncCounter(value + 1);
+
+        if (hold_frames)
+        {
+            m_frame_pending = true;
+
+            //Don't wait forever if the compositor doesn't answer.
+            QTimer::singleShot(FRAMEDRAWNTIMEOUT, this, [=]{
+                frameDrawn(value + 1);
+            });
+        }
+
+        return return_value;
+    }
+    case QEvent::Show:
+    case QEvent::Hide:
+    case QEvent::WindowActivate:
+    case QEvent::WindowDeactivate:
+    case QEvent::WindowStateChange:
+    case QEvent::Resize:
+    case QEvent::Move:
+    {
+        updateMask();
+
+        if (isVisible() && windowState().testFlag(Qt::WindowNoState))
+        {
+            sizeMoveBorders();
+
+            if (isActiveWindow())
+            {
+                m_shadow->showLater();
+            }
+        }
+        else
+        {
+            m_shadow->hide();
+        }
+
+        break;
+    }
+    case QEvent::WindowBlocked:
+    {
+        if (FIXED_SIZE(this))
+            break;
+
+        if (!windowState().testFlag(Qt::WindowNoState))
+            break;
+
+        m_shadow->hide();
+
+        break;
+    }
+    case QEvent::WindowUnblocked:
+    {
+        if (FIXED_SIZE(this))
+            break;
+
+        activateWindow();
+
+        if (!windowState().testFlag(Qt::WindowNoState))
+            break;
+
+        m_shadow->show();
+
+        break;
+    }
+    default:
+        break;
+    }
+#endif
+#ifdef Q_OS_MAC
+    switch (event->type())
+    {
+    case QEvent::WinIdChange:
+    {
+        QTimer::singleShot(0, this, [=]{
+            notification.unregisterNotification();
+
+            notification.registerNotification("NSWindowWillEnterFullScreenNotification", winId());
+            notification.registerNotification("NSWindowWillExitFullScreenNotification", winId());
+            notification.registerNotification("NSWindowDidExitFullScreenNotification", winId());
+        });
+
+        break;
+    }
+    case QEvent::Show:
+    {
+        if (isFullScreen())
+            break;
+
+        setMacOSStyle(int(macOSNative::StyleType::NoState));
+
+        break;
+    }
+    default:
+        break;
+    }
+#endif
+    return QMainWindow::event(event);
+}
+
+bool QGoodWindow::eventFilter(QObject *watched, QEvent *event)
+{
+#ifdef QGOODWINDOW
+    //The window and its descendants are watched, keep the size grip registry up to date.
+    switch (event->type())
+    {
+    case QEvent::ChildAdded:
+    case QEvent::ChildPolished:
+    case QEvent::ChildRemoved:
+    {
+        QWidget *widget = qobject_cast<QWidget*>(watched);
+
+        if (widget && widget->window() == this)
+            updateSizeGrips(static_cast<QChildEvent*>(event));
+
+        break;
+    }
+    default:
+        break;
+    }
+#endif
+#ifdef Q_OS_WIN
+    if (watched == m_main_window)
+    {
+        switch (event->type())
+        {
+        case QEvent::Show:
+        {
+            //Prevent send multiple show events at the window show event.
+            if (!m_self_generated_show_event)
+                return true;
+
+            //Don't propagate show event if already visible.
+            if (m_visible)
+                return true;
+
+            m_visible = true;
+
+            break;
+        }
+        case QEvent::Hide:
+        {
+            //Don't propagate hide event if already invisible.
+            if (!m_visible)
+                return true;
+
+            m_visible = false;
+
+            break;
+        }
+        case QEvent::WindowStateChange:
+        {
+            if (isMinimized())
+                m_visible = false;
+
+            break;
+        }
+        case QEvent::Close:
+        {
+            //Don't propagate close event if it is generated
+            //by QGoodWindow.
+            if (!m_self_generated_close_event)
+                return true;
+
+            break;
+        }
+        case QEvent::WindowActivate:
+        {
+            if (!m_main_window->isActiveWindow() || m_active_state)
+                return true;
+
+            m_active_state = true;
+
+            break;
+        }
+        case QEvent::WindowDeactivate:
+        {
+            if (m_main_window->isActiveWindow() || !m_active_state)
+                return true;
+
+            m_active_state = false;
+
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    else if (m_parent && (watched == m_parent))
+    {
+        switch (event->type())
+        {
+        case QEvent::Close:
+        {
+            if (event->isAccepted())
+                close();
+
+            break;
+        }
+        default:
+            break;
+        }
+    }
+#if defined QT_VERSION_QT5 && QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    else if (watched->metaObject()->className() == QStringLiteral("QMenu") ||
+               watched->metaObject()->className() == QStringLiteral("QComboBoxPrivateContainer"))
+    {
+        QWidget *widget = qobject_cast<QWidget*>(watched);
+
+        if (widget)
+        {
+            switch (event->type())
+            {
+            case QEvent::Polish:
+            {
+                if (!widget->windowHandle())
+                    widget->createWinId();
+
+                break;
+            }
+            case QEvent::Show:
+            {
+                if (qobject_cast<QMenu*>(widget->parentWidget()))
+                    break;
+
+                QScreen *screen = windowHandle()->screen();
+                widget->windowHandle()->setScreen(screen);
+
+                int x = qFloor(screen->geometry().x() / m_pixel_ratio);
+                int y = qFloor(screen->geometry().y() / m_pixel_ratio);
+
+                x += widget->x();
+                y += widget->y();
+
+                widget->move(x, y);
+
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+#endif
+    else if (QWidget *widget = qobject_cast<QWidget*>(watched))
+    {
+        if (widget->isWindow())
+        {
+            switch (event->type())
+            {
+            case QEvent::Show:
+            {
+                if (isMinimized())
+                    showNormal();
+
+                moveCenterWindow(widget);
+
+                break;
+            }
+            case QEvent::Resize:
+            {
+                if (!FIXED_SIZE(widget))
+                    break;
+
+                QTimer::singleShot(0, this, [=]{
+                    moveCenterWindow(widget);
+                });
+
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+#endif
+#ifdef Q_OS_LINUX
+    if (watched == windowHandle())
+    {
+        //Exposing the window after a resize paints and flushes it without an update request,
+        //answer a pending sync request once that frame is complete.
+        if (event->type() == QEvent::Expose && m_sync_counter != None && m_sync_request_pending)
+        {
+            const quint64 value = startFrameSync();
+
+            QTimer::singleShot(0, this, [=]{
+                if (m_sync_counter != None && m_sync_value == value)
+                    setFrameSyncCounter(value + 1);
+            });
+        }
+
+        return QMainWindow::eventFilter(watched, event);
+    }
+#endif
+#if defined Q_OS_LINUX || defined Q_OS_MAC
+    QWidget *modal_widget = qApp->activeModalWidget();
+
+    if (modal_widget && modal_widget->window() != this)
+        return QMainWindow::eventFilter(watched, event);
+
+    QWidget *widget = qobject_cast<QWidget*>(watched);
+
+    if (!widget)
+        return QMainWindow::eventFilter(watched, event);
+
+    if (widget->window() != this
+        #ifdef Q_OS_LINUX
+            && widget != m_shadow
+        #endif
+            )
+        return QMainWindow::eventFilter(watched, event);
+
+    QPoint cursor_pos = QCursor::pos();
+    qintptr button = ncHitTest(qFloor(cursor_pos.x() * m_pixel_ratio), qFloor(cursor_pos.y() * m_pixel_ratio));
+
+    switch (event->type())
+    {
+#ifdef Q_OS_MAC
+    case QEvent::ChildAdded:
+    case QEvent::ChildRemoved:
+    {
+        if (qApp->activeModalWidget())
+            break;
+
+        if (isFullScreen())
+            break;
+
+        if (m_on_animate_event)
+            break;
+
+        setMacOSStyle(int(macOSNative::StyleType::NoState));
+
+        break;
+    }
+#endif
+    case QEvent::ChildPolished:
+    {
+        QChildEvent *child_event = static_cast<QChildEvent*>(event);
+
+        QWidget *widget = qobject_cast<QWidget*>(child_event->child());
+
+        if (!widget)
+            break;
+
+        widget->setMouseTracking(true);
+        widget->installEventFilter(this);
+
+        for (QWidget *w : widget->findChildren<QWidget*>())
+        {
+            w->setMouseTracking(true);
+            w->installEventFilter(this);
+        }
+
+        break;
+    }
+    case QEvent::MouseButtonPress:
+    {
+        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
+
+        if (mouse_event->button() != Qt::LeftButton)
+            break;
+
+        switch (button)
+        {
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+        {
+            buttonPress(button);
+            break;
+        }
+        default:
+            break;
+        }
+
+        break;
+    }
+    case QEvent::MouseMove:
+    {
+        if (m_last_move_button != button)
+        {
+            m_last_move_button = button;
+
+            buttonLeave(m_last_caption_button_hovered);
+
+            switch (button)
+            {
+            case HTMINBUTTON:
+            case HTMAXBUTTON:
+            case HTCLOSE:
+            {
+                if (!m_is_caption_button_pressed || (button == m_caption_button_pressed))
+                    buttonEnter(button);
+
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        break;
+    }
+    case QEvent::MouseButtonRelease:
+    {
+        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
+
+        if (mouse_event->button() != Qt::LeftButton)
+            break;
+
+        m_last_move_button = -1;
+
+        buttonRelease(m_caption_button_pressed, (button == m_caption_button_pressed));
+
+        break;
+    }
+    default:
+        break;
+    }
+#endif
+#ifdef Q_OS_LINUX
+    if (m_is_caption_button_pressed)
+        return QMainWindow::eventFilter(watched, event);
+
+    switch (event->type())
+    {
+    case QEvent::MouseButtonDblClick:
+    {
+        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
+
+        if (mouse_event->button() == Qt::LeftButton)
+        {
+            if (m_margin == HTCAPTION)
+            {
+                if (!isMaximized())
+                    showMaximized();
+                else
+                    showNormal();
+            }
+        }
+
+        switch (m_margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    case QEvent::MouseButtonPress:
+    {
+        setCursorForCurrentPos();
+
+        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
+
+        //X server time of the event that may start a move or resize.
+        m_drag_timestamp = quint32(mouse_event->timestamp());
+
+        if (!m_resize_move && mouse_event->button() == Qt::LeftButton)
+        {
+            if (m_margin != HTNOWHERE)
+            {
+                m_resize_move = true;
+                m_press_margin = m_margin;
+                m_press_pos = m_cursor_pos;
+
+                //Borders have no click action, hand them to the window manager right away.
+                if (m_margin >= HTTOPLEFT && m_margin < HTCAPTION)
+                    sizeMove();
+            }
+        }
+
+        //The size grip is resized by the window manager, like the borders.
+        if (m_margin == HTBOTTOMRIGHT && qobject_cast<QSizeGrip*>(watched))
+            return true;
+
+        switch (m_margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    case QEvent::MouseMove:
+    {
+        setCursorForCurrentPos();
+
+        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
+
+        m_drag_timestamp = quint32(mouse_event->timestamp());
+
+        //The title bar also takes clicks, start moving once the pointer passes the drag distance.
+        if (m_resize_move && mouse_event->buttons() == Qt::LeftButton &&
+                (m_cursor_pos - m_press_pos).manhattanLength() >= QApplication::startDragDistance())
+            sizeMove();
+
+        //The size grip is resized by the window manager, like the borders.
+        if (m_margin == HTBOTTOMRIGHT && qobject_cast<QSizeGrip*>(watched))
+            return true;
+
+        switch (m_margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    case QEvent::MouseButtonRelease:
+    {
+        setCursorForCurrentPos();
+
+        QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
+
+        if (mouse_event->button() == Qt::LeftButton)
+            m_resize_move = false;
+
+        //The size grip is resized by the window manager, like the borders.
+        if (m_margin == HTBOTTOMRIGHT && qobject_cast<QSizeGrip*>(watched))
+            return true;
+
+        switch (m_margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    case QEvent::Leave:
+    {
+        setCursorForCurrentPos();
+
+        break;
+    }
+    case QEvent::Wheel:
+    {
+        switch (m_margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    case QEvent::ContextMenu:
+    {
+        switch (m_margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    default:
+        break;
+    }
+#endif
+#ifdef Q_OS_MAC
+    if (m_parent)
+        return QMainWindow::eventFilter(watched, event);
+
+    if (m_is_caption_button_pressed)
+        return QMainWindow::eventFilter(watched, event);
+
+    int margin = int(ncHitTest(qFloor(cursor_pos.x() * m_pixel_ratio), qFloor(cursor_pos.y() * m_pixel_ratio)));
+
+    switch (event->type())
+    {
+    case QEvent::MouseButtonDblClick:
+    {
+        if (margin == HTCAPTION)
+        {
+            QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
+
+            if (!isFullScreen())
+            {
+                if (mouse_event->button() == Qt::LeftButton)
+                {
+                    if (margin == HTCAPTION)
+                    {
+                        if (!isMaximized())
+                            showMaximized();
+                        else
+                            showNormal();
+                    }
+                }
+            }
+        }
+
+        switch (margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    case QEvent::MouseButtonPress:
+    {
+        if (margin == HTCAPTION)
+        {
+            QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
+
+            if (!isFullScreen())
+            {
+                if (mouse_event->button() == Qt::LeftButton)
+                {
+                    m_cursor_move_pos = cursor_pos - pos();
+                }
+            }
+        }
+
+        m_mouse_button_pressed = true;
+
+        switch (margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    case QEvent::MouseMove:
+    {
+        if (!m_cursor_move_pos.isNull())
+        {
+            QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
+
+            if (!isFullScreen())
+            {
+                if (mouse_event->buttons() == Qt::LeftButton)
+                {
+                    move(cursor_pos - m_cursor_move_pos);
+                }
+            }
+        }
+
+        if (!m_mouse_button_pressed)
+        {
+            QWidget *widget = QApplication::widgetAt(cursor_pos);
+
+            if (widget)
+            {
+                switch (margin)
+                {
+                case HTCAPTION:
+                case HTMINBUTTON:
+                case HTMAXBUTTON:
+                case HTCLOSE:
+                {
+                    if (QApplication::overrideCursor() &&
+                            QApplication::overrideCursor()->shape() == Qt::ArrowCursor)
+                        break;
+
+                    QApplication::setOverrideCursor(Qt::ArrowCursor);
+
+                    break;
+                }
+                case HTNOWHERE:
+                {
+                    if (!QApplication::overrideCursor())
+                        break;
+
+                    if (QApplication::overrideCursor()->shape() != Qt::ArrowCursor)
+                        break;
+
+                    QApplication::restoreOverrideCursor();
+
+                    break;
+                }
+                default:
+                    break;
+                }
+            }
+        }
+
+        switch (margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    case QEvent::MouseButtonRelease:
+    {
+        if (!m_cursor_move_pos.isNull())
+        {
+            QMouseEvent *mouse_event = static_cast<QMouseEvent*>(event);
+
+            QWidget *widget = QApplication::widgetAt(cursor_pos);
+
+            if (widget && !isFullScreen())
+            {
+                if (mouse_event->button() == Qt::LeftButton)
+                    m_cursor_move_pos = QPoint();
+            }
+        }
+
+        m_mouse_button_pressed = false;
+
+        switch (margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    case QEvent::Wheel:
+    {
+        switch (margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    case QEvent::ContextMenu:
+    {
+        switch (margin)
+        {
+        case HTCAPTION:
+        case HTMINBUTTON:
+        case HTMAXBUTTON:
+        case HTCLOSE:
+            return true;
+        default:
+            break;
+        }
+
+        break;
+    }
+    default:
+        break;
+    }
+#endif
+    return QMainWindow::eventFilter(watched, event);
+}
+
+bool QGoodWindow::nativeEvent(const QByteArray &eventType, void *message, qgoodintptr *result)
+{
+#ifdef Q_OS_LINUX
+    if (eventType == "xcb_generic_event_t")
+    {
+        xcb_generic_event_t *event = static_cast<xcb_generic_event_t*>(message);
+
+        if ((event->response_type & ~0x80) == XCB_CLIENT_MESSAGE && m_sync_counter != None)
+        {
+            xcb_client_message_event_t *client_message = reinterpret_cast<xcb_client_message_event_t*>(event);
+
+            Display *dpy = QX11Info::display();
+
+            static const Atom wm_protocols_atom = XInternAtom(dpy, "WM_PROTOCOLS", False);
+            static const Atom sync_request_atom = XInternAtom(dpy, "_NET_WM_SYNC_REQUEST", False);
+            static const Atom frame_drawn_atom = XInternAtom(dpy, "_NET_WM_FRAME_DRAWN", False);
+
+            const quint32 *data = client_message->data.data32;
+
+            if (client_message->type == wm_protocols_atom && data[0] == sync_request_atom && data[4] != 0)
+            {
+                //Request for the extended counter, answered when the next frame is complete,
+                //requests for the basic counter are answered by Qt.
+                m_sync_request_value = (quint64(data[3]) << 32) | quint64(data[2]);
+                m_sync_request_pending = true;
+
+                //Answer even if the size didn't change.
+                update();
+            }
+            else if (client_message->type == frame_drawn_atom)
+            {
+                frameDrawn((quint64(data[1]) << 32) | quint64(data[0]));
+            }
+        }
+        else if ((event->response_type & ~0x80) == XCB_BUTTON_RELEASE)
+        {
+            if (m_resize_move_started)
+                finishSystemMoveResize();
+        }
+        else if (event->response_type == XCB_GE_GENERIC)
+        {
+            //A release before or after the window manager grab ends the move or resize,
+            //while the button is held the poll timer checks it.
+            if (m_resize_move_started)
+            {
+                xcb_ge_generic_event_t *ge_event = reinterpret_cast<xcb_ge_generic_event_t*>(event);
+
+                static int xinput_opcode = -1;
+
+                if (xinput_opcode < 0)
+                {
+                    int event_base, error_base;
+
+                    if (!XQueryExtension(QX11Info::display(), "XInputExtension", &xinput_opcode,
+                                         &event_base, &error_base))
+                        xinput_opcode = 0;
+                }
+
+                if (ge_event->extension == xinput_opcode && ge_event->event_type == XI_ButtonRelease)
+                    finishSystemMoveResize();
+            }
+#ifdef QT_VERSION_QT5
+            else
+            {
+                //Fix no mouse event after moving mouse from resize borders.
+                QEvent event(QEvent::MouseMove);
+                QApplication::sendEvent(this, &event);
+            }
+#endif
+        }
+    }
+#endif
+    return QMainWindow::nativeEvent(eventType, message, result);
+}
+
+#ifdef Q_OS_WIN
+void QGoodWindow::initGW()
+{
+    setProperty("_q_embedded_native_parent_handle", WId(m_hwnd));
+    QMainWindow::setWindowFlags(Qt::FramelessWindowHint);
+
+    QEvent event(QEvent::EmbeddingControl);
+    QApplication::sendEvent(this, &event);
+}
+
+void QGoodWindow::destroyGW()
+{
+    QMainWindow::close();
+#ifdef QT_VERSION_QT5
+    QMainWindow::destroy(true, true);
+#endif
+#ifdef QT_VERSION_QT6
+    QMainWindow::destroy(false, false);
+#endif
+}
+
+void QGoodWindow::closeGW()
+{
+    if (m_shadow)
+    {
+        m_shadow->hide();
+
+        qApp->processEvents();
+
+        delete m_shadow;
+    }
+
+    if (m_helper_widget)
+        delete m_helper_widget;
+
+#ifdef QT_VERSION_QT6
+    if (m_helper_window)
+        delete m_helper_window;
+#endif
+
+    qDeleteAll(findChildren<QGoodDialog*>());
+
+    destroyGW();
+
+    SetWindowLongPtrW(m_hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(nullptr));
+}
+
+void QGoodWindow::setWindowStateWin()
+{
+    if (m_window_state.testFlag(Qt::WindowFullScreen))
+        showFullScreen();
+    else if (m_window_state.testFlag(Qt::WindowMaximized))
+        showMaximized();
+    else if (m_window_state.testFlag(Qt::WindowMinimized))
+        showMinimized();
+    else if (m_window_state.testFlag(Qt::WindowNoState))
+        showNormal();
+}
+
+LRESULT QGoodWindow::WndProc(HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
+{
+    QGoodWindow *gw = reinterpret_cast<QGoodWindow*>(GetWindowLongPtrW(hwnd, GWLP_USERDATA));
+
+    if (!gw)
+        return DefWindowProcW(hwnd, message, wParam, lParam);
+
+    switch (message)
+    {
+    case WM_ACTIVATE:
+    {
+        switch (wParam)
+        {
+        case WA_ACTIVE:
+        case WA_CLICKACTIVE:
+        {
+            QTimer::singleShot(0, gw, [=]{
+                gw->setWidgetFocus();
+                gw->handleActivation();
+            });
+
+            break;
+        }
+        case WA_INACTIVE:
+        {
+            if (gw->focusWidget())
+            {
+                //If app going to be inactive,
+                //save current focused widget
+                //to restore focus later.
+
+                gw->m_focus_widget = gw->focusWidget();
+            }
+
+            QTimer::singleShot(0, gw, [=]{
+                gw->handleDeactivation();
+            });
+
+            if (!IsWindowEnabled(hwnd))
+            {
+                if (gw->m_shadow)
+                    gw->m_shadow->hide();
+            }
+
+            break;
+        }
+        default:
+            break;
+        }
+
+        break;
+    }
+    case WM_SETFOCUS:
+    {
+        //Pass focus to last focused widget.
+        gw->setWidgetFocus();
+        gw->m_main_window->activateWindow();
+
+        break;
+    }
+    case WM_SIZE:
+    {
+        gw->sizeMoveWindow();
+
+        break;
+    }
+    case WM_MOVE:
+    {
+        gw->sizeMoveWindow();
+
+        QMoveEvent event(QPoint(gw->x(), gw->y()), QPoint());
+        QApplication::sendEvent(gw, &event);
+
+        break;
+    }
+    case WM_GETMINMAXINFO:
+    {
+        MINMAXINFO *mmi = reinterpret_cast<MINMAXINFO*>(lParam);
+
+        int border_width = 0;
+
+        if (gw->m_is_using_system_borders && gw->windowState().testFlag(Qt::WindowNoState))
+            border_width = BORDERWIDTH();
+
+        QSize minimum = gw->minimumSize();
+
+        QSize sizeHint = gw->minimumSizeHint();
+
+        mmi->ptMinTrackSize.x = qFloor(qMax(minimum.width(), sizeHint.width()) *
+                                       gw->m_pixel_ratio) + border_width * 2;
+        mmi->ptMinTrackSize.y = qFloor(qMax(minimum.height(), sizeHint.height()) *
+                                       gw->m_pixel_ratio) + border_width;
+
+        QSize maximum = gw->maximumSize();
+
+        mmi->ptMaxTrackSize.x = qFloor(maximum.width() * gw->m_pixel_ratio) + border_width * 2;
+        mmi->ptMaxTrackSize.y = qFloor(maximum.height() * gw->m_pixel_ratio) + border_width;
+
+        break;
+    }
+    case WM_CLOSE:
+    {
+        //Send Qt QCloseEvent to the window,
+        //which allows to accept or reject the window close.
+        gw->m_self_generated_close_event = true;
+        QCloseEvent event;
+        QApplication::sendEvent(gw, &event);
+        gw->m_self_generated_close_event = false;
+
+        if (!event.isAccepted())
+            return 0;
+
+        gw->hide();
+
+        gw->m_closed = true;
+
+        //Begin the cleanup.
+
+        gw->closeGW();
+
+        if (gw->testAttribute(Qt::WA_DeleteOnClose))
+            delete gw;
+
+        //End the cleanup.
+
+        return DefWindowProcW(hwnd, message, wParam, lParam);
+    }
+    case WM_DESTROY:
+    {
+        return DefWindowProcW(hwnd, message, wParam, lParam);
+    }
+    case WM_NCHITTEST:
+    {
+        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+
+        LRESULT lresult = LRESULT(gw->ncHitTest(pos.x(), pos.y()));
+
+        if (FIXED_SIZE(gw))
+        {
+            //If have fixed size, then only HTCAPTION hit test is valid,
+            //which means that only the title bar click and move is valid.
+
+            if (lresult != HTNOWHERE
+                    && lresult != HTSYSMENU
+                    && lresult != HTMINBUTTON
+                    && lresult != HTMAXBUTTON
+                    && lresult != HTCLOSE
+                    && lresult != HTCAPTION)
+                lresult = HTNOWHERE;
+
+            return lresult;
+        }
+        else if (FIXED_WIDTH(gw))
+        {
+            if (lresult != HTNOWHERE
+                    && lresult != HTSYSMENU
+                    && lresult != HTMINBUTTON
+                    && lresult != HTMAXBUTTON
+                    && lresult != HTCLOSE
+                    && lresult != HTCAPTION
+                    && lresult != HTTOP
+                    && lresult != HTBOTTOM)
+                lresult = HTNOWHERE;
+
+            return lresult;
+        }
+        else if (FIXED_HEIGHT(gw))
+        {
+            if (lresult != HTNOWHERE
+                    && lresult != HTSYSMENU
+                    && lresult != HTMINBUTTON
+                    && lresult != HTMAXBUTTON
+                    && lresult != HTCLOSE
+                    && lresult != HTCAPTION
+                    && lresult != HTLEFT
+                    && lresult != HTRIGHT)
+                lresult = HTNOWHERE;
+
+            return lresult;
+        }
+
+        return lresult;
+    }
+    case WM_NCMOUSELEAVE:
+    {
+        if (gw->m_is_caption_button_pressed)
+            break;
+
+        gw->buttonLeave(gw->m_last_caption_button_hovered);
+
+        break;
+    }
+    case WM_NCMOUSEMOVE:
+    {
+        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+
+        qintptr button = gw->ncHitTest(pos.x(), pos.y());
+
+        bool valid_caption_button = gw->winButtonHover(button);
+
+        if (valid_caption_button)
+        {
+            if (gw->m_is_caption_button_pressed)
+            {
+                if (GetCapture() != hwnd)
+                {
+                    SetCapture(hwnd);
+                }
+            }
+        }
+        else
+        {
+            gw->buttonLeave(gw->m_last_caption_button_hovered);
+        }
+
+        break;
+    }
+    case WM_MOUSEMOVE:
+    {
+        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+
+        const int border_width = (gw->m_is_win_11_or_greater &&
+                                  gw->windowState().testFlag(Qt::WindowNoState)) ? BORDERWIDTH() : 0;
+
+        pos.setX(qFloor(gw->x() * gw->m_pixel_ratio) + border_width + pos.x());
+        pos.setY(qFloor(gw->y() * gw->m_pixel_ratio) + pos.y());
+
+        qintptr button = gw->ncHitTest(pos.x(), pos.y());
+
+        bool valid_caption_button = gw->winButtonHover(button);
+
+        if (!valid_caption_button)
+        {
+            if (!gw->m_is_caption_button_pressed && GetCapture() == hwnd)
+            {
+                ReleaseCapture();
+            }
+
+            gw->buttonLeave(gw->m_last_caption_button_hovered);
+        }
+
+        break;
+    }
+    case WM_NCLBUTTONDBLCLK:
+    {
+        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+
+        qintptr button = gw->ncHitTest(pos.x(), pos.y());
+
+        if (button == HTSYSMENU)
+        {
+            QTimer::singleShot(0, gw, &QGoodWindow::close);
+            return 0;
+        }
+
+        break;
+    }
+    case WM_NCLBUTTONDOWN:
+    {
+        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+
+        qintptr button = gw->ncHitTest(pos.x(), pos.y());
+
+        if (button == HTSYSMENU)
+        {
+            gw->iconClicked();
+            return 0;
+        }
+
+        bool valid_caption_button = gw->buttonPress(button);
+
+        if (valid_caption_button)
+            return 0;
+
+        break;
+    }
+    case WM_NCLBUTTONUP:
+    {
+        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+
+        qintptr button = gw->ncHitTest(pos.x(), pos.y());
+
+        if (button == HTSYSMENU)
+        {
+            return 0;
+        }
+
+        bool valid_caption_button = gw->buttonRelease(gw->m_caption_button_pressed,
+                                                      (button == gw->m_caption_button_pressed));
+
+        if (valid_caption_button)
+            return 0;
+
+        break;
+    }
+    case WM_LBUTTONDOWN:
+    {
+        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+
+        const int border_width = (gw->m_is_win_11_or_greater &&
+                                  gw->windowState().testFlag(Qt::WindowNoState)) ? BORDERWIDTH() : 0;
+
+        pos.setX(qFloor(gw->x() * gw->m_pixel_ratio) + border_width + pos.x());
+        pos.setY(qFloor(gw->y() * gw->m_pixel_ratio) + pos.y());
+
+        qintptr button = gw->ncHitTest(pos.x(), pos.y());
+
+        gw->buttonPress(button);
+
+        break;
+    }
+    case WM_LBUTTONUP:
+    {
+        QPoint pos = QPoint(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+
+        const int border_width = (gw->m_is_win_11_or_greater &&
+                                  gw->windowState().testFlag(Qt::WindowNoState)) ? BORDERWIDTH() : 0;
+
+        pos.setX(qFloor(gw->x() * gw->m_pixel_ratio) + border_width + pos.x());
+        pos.setY(qFloor(gw->y() * gw->m_pixel_ratio) + pos.y());
+
+        qintptr button = gw->ncHitTest(pos.x(), pos.y());
+
+        if (button != gw->m_caption_button_pressed)
+            gw->buttonEnter(button);
+
+        gw->buttonRelease(gw->m_caption_button_pressed, (button == gw->m_caption_button_pressed));
+
+        break;
+    }
+    case WM_SYSKEYDOWN:
+    case WM_SYSKEYUP:
+    {
+        if ((GetKeyState(VK_SHIFT) & 0x8000) && wParam == VK_F10)
+        {
+            //When SHIFT+F10 is pressed.
+            gw->showContextMenu();
+            return 0;
+        }
+
+        if ((GetKeyState(VK_MENU) & 0x8000) && wParam == VK_SPACE)
+        {
+            //When ALT+SPACE is pressed.
+            gw->showContextMenu();
+            return 0;
+        }
+
+        break;
+    }
+    case WM_NCRBUTTONUP:
+    {
+        //Show context menu on right click on title bar.
+
+        int x = GET_X_LPARAM(lParam);
+        int y = GET_Y_LPARAM(lParam);
+
+        LRESULT lRet = LRESULT(gw->ncHitTest(x, y));
+
+        if (lRet == HTCAPTION || lRet == HTSYSMENU)
+            gw->showContextMenu(x, y);
+
+        break;
+    }
+    case WM_NCCALCSIZE:
+    {
+        if (gw->isFullScreen())
+            break;
+
+        if (gw->m_is_using_system_borders && !gw->isMaximized())
+        {
+            const int border_width = BORDERWIDTH();
+
+            RECT *rect = reinterpret_cast<RECT*>(lParam);
+            rect->left += border_width;
+            rect->bottom -= border_width;
+            rect->right -= border_width;
+        }
+
+        if (gw->isMaximized())
+        {
+            //Compensate window client area when maximized,
+            //by removing BORDERWIDTH value for all edges.
+
+            const int border_width = BORDERWIDTH();
+
+            InflateRect(reinterpret_cast<RECT*>(lParam), -border_width, -border_width);
+        }
+
+        //Make the whole window as client area.
+        return 0;
+    }
+#ifdef QT_VERSION_QT5
+    case WM_NCPAINT:
+    case WM_NCACTIVATE:
+    {
+        //Prevent undesired painting on window when DWM is not enabled.
+
+        if (!QtWin::isCompositionEnabled())
+            return TRUE;
+
+        break;
+    }
+#endif
+    case WM_WINDOWPOSCHANGING:
+    {
+        Qt::WindowState state;
+
+        if (gw->isMinimized())
+            state = Qt::WindowMinimized;
+        else if (gw->isMaximized())
+            state = Qt::WindowMaximized;
+        else if (gw->isFullScreen())
+            state = Qt::WindowFullScreen;
+        else
+            state = Qt::WindowNoState;
+
+        if (state != gw->m_last_state)
+        {
+            //If window state changed.
+
+            gw->m_window_state = state;
+
+            if (gw->m_last_state == Qt::WindowMinimized)
+            {
+                QTimer::singleShot(0, gw, [=]{
+                    gw->m_self_generated_show_event = true;
+                    QShowEvent event;
+                    QApplication::sendEvent(gw, &event);
+                    gw->m_self_generated_show_event = false;
+                });
+            }
+
+            QWindowStateChangeEvent event(gw->m_last_state);
+            QApplication::sendEvent(gw, &event);
+
+            gw->m_last_state = state;
+
+            if (gw->m_shadow)
+            {
+                if (state != Qt::WindowNoState)
+                {
+                    //Hide shadow if not on "normal" state.
+                    gw->m_shadow->hide();
+                }
+                else if (gw->isVisible())
+                {
+                    //Show shadow if switching to "normal" state, with delay.
+                    gw->m_shadow->showLater();
+                }
+            }
+
+            if (state == Qt::WindowMinimized)
+            {
+                if (gw->focusWidget())
+                {
+                    //If app going to be minimized,
+                    //save current focused widget
+                    //to restore focus later.
+
+                    gw->m_focus_widget = gw->focusWidget();
+                }
+            }
+        }
+
+        WINDOWPOS *pwp = reinterpret_cast<WINDOWPOS*>(lParam);
+
+        if (pwp->flags & SWP_SHOWWINDOW)
+        {
+            if (!gw->m_main_window->isVisible())
+            {
+                auto func_init = [=]
+                {
+                    gw->updateScreen(gw->screenForWindow(hwnd));
+                };
+
+                auto func_finish = [=]
+                {
+                    gw->internalWidgetResize();
+                    gw->m_window_ready_for_resize = true;
+                    gw->sizeMoveMainWindow();
+                };
+
+                auto func_show = [=]
+                {
+                    gw->m_main_window->show();
+                };
+
+                if (!gw->m_main_window->testAttribute(Qt::WA_NativeWindow))
+                {
+                    func_init();
+                    func_finish();
+                    func_show();
+                }
+                else
+                {
+                    QTimer::singleShot(0, gw, [=]{
+                        func_init();
+                        func_show();
+                        func_finish();
+                    });
+                }
+
+                gw->m_self_generated_show_event = true;
+                QShowEvent event;
+                QApplication::sendEvent(gw, &event);
+                gw->m_self_generated_show_event = false;
+
+                if (gw->m_shadow && gw->windowState().testFlag(Qt::WindowNoState))
+                    gw->m_shadow->showLater();
+            }
+
+#ifdef QT_VERSION_QT6
+            if (gw->m_helper_window)
+                gw->m_helper_window->show();
+#endif
+        }
+        else if (pwp->flags & SWP_HIDEWINDOW)
+        {
+            if (gw->focusWidget())
+            {
+                //If app have a valid focused widget,
+                //save them to restore focus later.
+
+                gw->m_focus_widget = gw->focusWidget();
+            }
+
+            if (gw->m_shadow)
+                gw->m_shadow->hide();
+
+#ifdef QT_VERSION_QT6
+            if (gw->m_helper_window)
+                gw->m_helper_window->hide();
+#endif
+
+            QHideEvent event;
+            QApplication::sendEvent(gw, &event);
+        }
+
+        if (pwp->flags == (SWP_NOSIZE + SWP_NOMOVE))
+        {
+            //Activate window to fix no activation
+            //problem when QGoodWindow isn't shown initially in
+            //active state.
+
+            if (gw->isMinimized() || !gw->isVisible())
+                break;
+
+            gw->m_main_window->activateWindow();
+
+            if (gw->windowState().testFlag(Qt::WindowNoState))
+            {
+                if (gw->m_shadow)
+                    gw->m_shadow->showLater();
+            }
+        }
+
+        break;
+    }
+#ifdef QT_VERSION_QT5
+    case WM_WINDOWPOSCHANGED:
+    {
+        if (!QtWin::isCompositionEnabled() && gw->isMaximized())
+        {
+            //Hack for prevent window goes to full screen when it's being maximized,
+            //enable WS_CAPTION and schedule for disable it,
+            //not mantaining WS_CAPTION all the time to prevent undesired painting on window
+            //when title or icon of the window is changed when DWM is not enabled.
+
+            gw->enableCaption();
+            QTimer::singleShot(0, gw, &QGoodWindow::disableCaption);
+        }
+
+        break;
+    }
+#endif
+    case WM_SETTEXT:
+    {
+        Q_EMIT gw->windowTitleChanged(gw->windowTitle());
+        break;
+    }
+    case WM_SETICON:
+    {
+        Q_EMIT gw->windowIconChanged(gw->windowIcon());
+        break;
+    }
+    case WM_ENTERSIZEMOVE:
+    {
+        gw->m_timer_move->stop();
+
+        break;
+    }
+    case WM_SIZING:
+    {
+        if (!gw->m_live_resize)
+        {
+            gw->m_live_resize = true;
+            Q_EMIT gw->liveResizeStarted();
+        }
+
+        break;
+    }
+    case WM_EXITSIZEMOVE:
+    {
+        if (gw->windowHandle()->screen() != gw->screenForWindow(hwnd))
+            gw->m_timer_move->start();
+
+        if (gw->m_live_resize)
+        {
+            gw->m_live_resize = false;
+            Q_EMIT gw->liveResizeFinished();
+        }
+
+        break;
+    }
+    case WM_DPICHANGED:
+    {
+        gw->m_timer_move->stop();
+
+        //Wait to refresh screen pixel ratio information.
+        qApp->processEvents();
+
+        QScreen *screen = gw->screenForWindow(hwnd);
+
+        if (!screen)
+            break;
+
+        gw->screenChangeMoveWindow(screen);
+        gw->updateScreen(screen);
+        gw->windowScaleChanged();
+
+        break;
+    }
+    case WM_DISPLAYCHANGE:
+    {
+        if (gw->isFullScreen())
+            gw->showNormal();
+
+        break;
+    }
+    case WM_SETTINGCHANGE:
+    {
+        if (QGoodWindowUtils::isWinXOrGreater(10, 0, 0)) //Windows 10 or later.
+        {
+            if (QString::fromWCharArray(LPCWSTR(lParam)) == "ImmersiveColorSet")
+            {
+                QTimer::singleShot(0, gw, &QGoodWindow::themeChanged);
+            }
+        }
+
+        break;
+    }
+#ifdef QT_VERSION_QT5
+    case WM_THEMECHANGED:
+    case WM_DWMCOMPOSITIONCHANGED:
+    {
+        //Send the window change event to m_helper_widget,
+        //this hack corrects the background color when switching between
+        //Windows composition modes or system themes.
+        SendMessageW(HWND(gw->m_helper_widget->winId()), message, 0, 0);
+
+        if (QtWin::isCompositionEnabled())
+        {
+            QTimer::singleShot(100, gw, [=]{
+                gw->enableCaption();
+                gw->frameChanged();
+                SetWindowRgn(hwnd, nullptr, TRUE);
+            });
+        }
+        else
+        {
+            QTimer::singleShot(100, gw, [=]{
+                gw->disableCaption();
+                gw->frameChanged();
+            });
+        }
+
+        QTimer::singleShot(100, gw, [=]{
+            gw->sizeMoveWindow();
+            gw->repaint();
+        });
+
+        break;
+    }
+#endif
+    default:
+        break;
+    }
+
+    MSG msg;
+    msg.hwnd = hwnd;
+    msg.message = message;
+    msg.lParam = lParam;
+    msg.wParam = wParam;
+
+    qgoodintptr result = 0;
+
+    bool return_value = gw->nativeEvent(QByteArray(), &msg, &result);
+
+    if (return_value)
+        return result;
+
+    return DefWindowProcW(hwnd, message, wParam, lParam);
+}
+
+void QGoodWindow::handleActivation()
+{
+    if (m_shadow)
+    {
+        if (windowState().testFlag(Qt::WindowNoState))
+        {
+            m_shadow->setActive(true);
+
+            //If in "normal" state, make shadow visible.
+            if (isVisible())
+                m_shadow->show();
+        }
+    }
+}
+
+void QGoodWindow::handleDeactivation()
+{
+    if (m_shadow)
+        m_shadow->setActive(false);
+
+    if (!isEnabled())
+        buttonLeave(m_last_caption_button_hovered);
+}
+
+void QGoodWindow::setWidgetFocus()
+{
+    if (!m_focus_widget)
+    {
+        bool have_focusable_widget = false;
+
+        for (QWidget *next_focus : findChildren<QWidget*>())
+        {
+            if (next_focus->focusPolicy() != Qt::NoFocus)
+            {
+                //Set focus to first focusable widget.
+                have_focusable_widget = true;
+                m_focus_widget = next_focus;
+                break;
+            }
+        }
+
+        if (!have_focusable_widget)
+        {
+            //If not have focusable widget
+            //set focus to m_main_window.
+            m_focus_widget = m_main_window;
+        }
+    }
+
+    if (m_focus_widget)
+    {
+        //If have a valid m_focus_widget,
+        //set the focus to this widget.
+        m_focus_widget->setFocus();
+    }
+}
+
+void QGoodWindow::enableCaption()
+{
+    SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) | WS_CAPTION);
+}
+
+void QGoodWindow::disableCaption()
+{
+    SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) & ~WS_CAPTION);
+}
+
+void QGoodWindow::disableMinimize()
+{
+    SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) & ~WS_MINIMIZEBOX);
+}
+
+void QGoodWindow::disableMaximize()
+{
+    SetWindowLongW(m_hwnd, GWL_STYLE, GetWindowLongW(m_hwnd, GWL_STYLE) & ~WS_MAXIMIZEBOX);
+}
+
+void QGoodWindow::frameChanged()
+{
+    SetWindowPos(m_hwnd, nullptr, 0, 0, 0, 0, SWP_NOSIZE | SWP_NOMOVE | SWP_NOACTIVATE | SWP_FRAMECHANGED);
+}
+
+void QGoodWindow::sizeMoveWindow()
+{
+    if (!isVisible() || isMinimized())
+        return;
+
+    if (windowState().testFlag(Qt::WindowNoState))
+        m_rect_normal = geometry();
+
+#ifdef QT_VERSION_QT5
+    setWindowMask();
+#endif
+
+    sizeMoveMainWindow();
+
+    moveShadow();
+}
+
+void QGoodWindow::sizeMoveMainWindow()
+{
+    bool opengl_adjust = false;
+
+#if defined QT_VERSION_QT5 && QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    QWidgetList list;
+    if (m_central_widget)
+    {
+        list.append(m_central_widget);
+        list.append(m_central_widget->findChildren<QWidget*>());
+    }
+
+    for (QWidget *widget : list)
+    {
+        QMetaObject *obj = const_cast<QMetaObject*>(widget->metaObject());
+
+        while (obj)
+        {
+            if (obj->className() == QStringLiteral("QOpenGLWidget"))
+            {
+                opengl_adjust = true;
+                break;
+            }
+            else if (obj->className() == QStringLiteral("QQuickWidget"))
+            {
+                opengl_adjust = true;
+                break;
+            }
+
+            obj = const_cast<QMetaObject*>(obj->superClass());
+        }
+
+        if (opengl_adjust)
+            break;
+    }
+#endif
+    //Move proxy widget.
+    int y = (opengl_adjust && (!qFuzzyCompare(m_pixel_ratio, qreal(1))) ? height() : 0);
+    m_proxy_widget->setGeometry(0, y, width(), height());
+
+    HWND hwnd = HWND(m_main_window->winId());
+
+    RECT win_rect;
+    GetClientRect(m_hwnd, &win_rect);
+    int w = win_rect.right - win_rect.left;
+    int h = win_rect.bottom - win_rect.top;
+
+    //Move main window widget inside native main window.
+    SetWindowPos(hwnd, nullptr, 0, 0, w, h, SWP_NOACTIVATE);
+}
+
+void QGoodWindow::setWindowMask()
+{
+#ifdef QT_VERSION_QT5
+    if (!QtWin::isCompositionEnabled())
+    {
+        QRect window_rect = rect();
+
+        window_rect.setWidth(qFloor(window_rect.width() * m_pixel_ratio));
+        window_rect.setHeight(qFloor(window_rect.height() * m_pixel_ratio));
+
+        const int border_width = BORDERWIDTH();
+
+        if (isMaximized())
+            window_rect.moveTopLeft(QPoint(border_width, border_width));
+
+        SetWindowRgn(m_hwnd, QtWin::toHRGN(window_rect), TRUE);
+    }
+    else
+    {
+        SetWindowRgn(m_hwnd, nullptr, TRUE);
+    }
+#endif
+#ifdef QT_VERSION_QT6
+    SetWindowRgn(m_hwnd, nullptr, TRUE);
+#endif
+}
+
+void QGoodWindow::moveShadow()
+{
+    if (!m_shadow)
+        return;
+
+    if (!windowState().testFlag(Qt::WindowNoState))
+        return;
+
+    const int shadow_width = m_shadow->shadowWidth();
+    const QPoint adjusted_pos = screenAdjustedPos();
+
+    int pos_x = x() - shadow_width + adjusted_pos.x();
+    int pos_y = y() - shadow_width + adjusted_pos.y();
+    int w = width() + shadow_width * 2;
+    int h = height() + shadow_width * 2;
+
+    m_shadow->setGeometry(pos_x, pos_y, w, h);
+
+    m_shadow->setActive(isActiveWindow());
+}
+
+void QGoodWindow::screenChangeMoveWindow(QScreen *screen)
+{
+    if (!screen)
+        return;
+
+    QRect screen_geom = screen->geometry();
+    qreal screen_pixel_ratio = screen->devicePixelRatio();
+    screen_geom.setWidth(qFloor(screen_geom.width() * screen_pixel_ratio));
+    screen_geom.setHeight(qFloor(screen_geom.height() * screen_pixel_ratio));
+
+    RECT rect;
+    GetWindowRect(m_hwnd, &rect);
+
+    QRect window_geom;
+    window_geom.moveTop(rect.top);
+    window_geom.moveLeft(rect.left);
+    window_geom.setWidth(rect.right - rect.left);
+    window_geom.setHeight(rect.bottom - rect.top);
+
+    QPoint center_pos = window_geom.center();
+    int border_width = m_is_using_system_borders ? BORDERWIDTH() : 0;
+
+    QSize window_size = size();
+    window_size.setWidth(qFloor(window_size.width() * screen_pixel_ratio) + border_width * 2);
+    window_size.setHeight(qFloor(window_size.height() * screen_pixel_ratio) + border_width);
+    window_geom.setSize(window_size);
+
+    //Keep X position.
+    center_pos.setY(window_geom.center().y());
+
+    const int top_dist = qAbs(screen_geom.top() - center_pos.y());
+    const int bottom_dist = qAbs(screen_geom.bottom() - center_pos.y());
+    const int left_dist = qAbs(screen_geom.left() - center_pos.x());
+    const int right_dist = qAbs(screen_geom.right() - center_pos.x());
+
+    const int margin = 10;
+
+    QRect center_rect;
+    center_rect.moveCenter(center_pos);
+    center_rect.adjust(-margin, -margin, margin, margin);
+
+    if (!screen_geom.contains(center_rect))
+    {
+        if (left_dist < right_dist)
+        {
+            if (left_dist < top_dist && left_dist < bottom_dist)
+            {
+                center_pos.setX(screen_geom.left() + margin);
+            }
+            else if (top_dist < bottom_dist)
+            {
+                center_pos.setY(screen_geom.top() + margin);
+            }
+            else
+            {
+                center_pos.setY(screen_geom.bottom() - margin);
+            }
+        }
+        else if (left_dist > right_dist)
+        {
+            if (right_dist < top_dist && right_dist < bottom_dist)
+            {
+                center_pos.setX(screen_geom.right() - margin);
+            }
+            else if (top_dist < bottom_dist)
+            {
+                center_pos.setY(screen_geom.top() + margin);
+            }
+            else
+            {
+                center_pos.setY(screen_geom.bottom() - margin);
+            }
+        }
+    }
+
+    window_geom.moveCenter(center_pos);
+
+    m_pixel_ratio = screen_pixel_ratio;
+
+    SetWindowPos(m_hwnd, nullptr, window_geom.x(), window_geom.y(),
+                 window_geom.width(), window_geom.height(), SWP_NOACTIVATE);
+
+    moveShadow();
+}
+
+void QGoodWindow::updateScreen(QScreen *screen)
+{
+    if (!screen)
+        return;
+
+    m_pixel_ratio = screen->devicePixelRatio();
+    setCurrentScreen(screen);
+}
+
+void QGoodWindow::setCurrentScreen(QScreen *screen)
+{
+    windowHandle()->setScreen(screen);
+
+    m_main_window->windowHandle()->setScreen(screen);
+
+    if (m_shadow)
+        m_shadow->windowHandle()->setScreen(screen);
+}
+
+void QGoodWindow::windowScaleChanged()
+{
+#ifdef QT_VERSION_QT6
+    internalWidgetResize();
+#endif
+
+    //Fix widget scale bug.
+    resize(width() + 1, height() + 1);
+    qApp->processEvents();
+    resize(width() - 1, height() - 1);
+    qApp->processEvents();
+
+    sizeMoveWindow();
+    moveShadow();
+}
+
+void QGoodWindow::internalWidgetResize()
+{
+    if (!windowState().testFlag(Qt::WindowNoState))
+        return;
+
+    if (!m_window_ready_for_resize)
+        return;
+
+    const QSize current_size = size();
+    QSize mw_size = m_main_window->size();
+
+#ifdef QT_VERSION_QT5
+    mw_size.setWidth(qFloor(mw_size.width() / m_pixel_ratio));
+    mw_size.setHeight(qFloor(mw_size.height() / m_pixel_ratio));
+#endif
+
+    if (current_size.width() < qFloor(mw_size.width() * m_pixel_ratio) ||
+        current_size.width() > qCeil(mw_size.width() * m_pixel_ratio))
+        return;
+
+    if (current_size.height() < qFloor(mw_size.height() * m_pixel_ratio) ||
+        current_size.height() > qCeil(mw_size.height() * m_pixel_ratio))
+        return;
+
+    resize(mw_size);
+}
+
+QScreen *QGoodWindow::screenForWindow(HWND hwnd)
+{
+    HMONITOR monitor = MonitorFromWindow(hwnd, MONITOR_DEFAULTTONEAREST);
+
+    MONITORINFO monitor_info;
+    memset(&monitor_info, 0, sizeof(MONITORINFO));
+    monitor_info.cbSize = sizeof(MONITORINFO);
+
+    GetMonitorInfoW(monitor, &monitor_info);
+
+    QPoint top_left;
+    top_left.setX(monitor_info.rcMonitor.left);
+    top_left.setY(monitor_info.rcMonitor.top);
+
+    for (QScreen *screen : qApp->screens())
+    {
+        if (screen->geometry().topLeft() == top_left)
+        {
+            return screen;
+        }
+    }
+
+    return nullptr;
+}
+
+QPoint QGoodWindow::screenAdjustedPos()
+{
+    const QRect screen_geom = windowHandle()->screen()->geometry();
+
+    int adjust_x = qFloor(screen_geom.x() - (screen_geom.x() / m_pixel_ratio));
+    int adjust_y = qFloor(screen_geom.y() - (screen_geom.y() / m_pixel_ratio));
+
+    return QPoint(adjust_x, adjust_y);
+}
+
+QScreen *QGoodWindow::screenForPoint(const QPoint &pos)
+{
+    POINT point;
+    point.x = pos.x();
+    point.y = pos.y();
+
+    HMONITOR monitor = MonitorFromPoint(point, MONITOR_DEFAULTTONEAREST);
+
+    MONITORINFO monitor_info;
+    memset(&monitor_info, 0, sizeof(MONITORINFO));
+    monitor_info.cbSize = sizeof(MONITORINFO);
+
+    GetMonitorInfoW(monitor, &monitor_info);
+
+    QPoint top_left;
+    top_left.setX(monitor_info.rcMonitor.left);
+    top_left.setY(monitor_info.rcMonitor.top);
+
+    for (QScreen *screen : qApp->screens())
+    {
+        if (screen->geometry().topLeft() == top_left)
+        {
+            return screen;
+        }
+    }
+
+    return nullptr;
+}
+
+void QGoodWindow::showContextMenu(int x, int y)
+{
+    HMENU menu = GetSystemMenu(m_hwnd, FALSE);
+
+    if (!menu)
+        return;
+
+    MENUITEMINFOW mi;
+    memset(&mi, 0, sizeof(MENUITEMINFOW));
+    mi.cbSize = sizeof(MENUITEMINFOW);
+    mi.fMask = MIIM_STATE;
+
+    mi.fState = MF_ENABLED;
+
+    SetMenuItemInfoW(menu, SC_RESTORE, FALSE, &mi);
+    SetMenuItemInfoW(menu, SC_SIZE, FALSE, &mi);
+    SetMenuItemInfoW(menu, SC_MOVE, FALSE, &mi);
+    SetMenuItemInfoW(menu, SC_MAXIMIZE, FALSE, &mi);
+    SetMenuItemInfoW(menu, SC_MINIMIZE, FALSE, &mi);
+
+    mi.fState = MF_GRAYED;
+
+    WINDOWPLACEMENT wp;
+    GetWindowPlacement(m_hwnd, &wp);
+
+    switch (wp.showCmd)
+    {
+    case SW_SHOWMAXIMIZED:
+    {
+        SetMenuItemInfoW(menu, SC_SIZE, FALSE, &mi);
+        SetMenuItemInfoW(menu, SC_MOVE, FALSE, &mi);
+        SetMenuItemInfoW(menu, SC_MAXIMIZE, FALSE, &mi);
+        SetMenuDefaultItem(menu, SC_CLOSE, FALSE);
+        break;
+    }
+    case SW_SHOWMINIMIZED:
+    {
+        SetMenuItemInfoW(menu, SC_MINIMIZE, FALSE, &mi);
+        SetMenuDefaultItem(menu, SC_RESTORE, FALSE);
+        break;
+    }
+    case SW_SHOWNORMAL:
+    {
+        SetMenuItemInfoW(menu, SC_RESTORE, FALSE, &mi);
+        SetMenuDefaultItem(menu, SC_CLOSE, FALSE);
+        break;
+    }
+    default:
+        break;
+    }
+
+    if (!(GetWindowLongW(m_hwnd, GWL_STYLE) & WS_MAXIMIZEBOX))
+    {
+        SetMenuItemInfoW(menu, SC_MAXIMIZE, FALSE, &mi);
+        SetMenuItemInfoW(menu, SC_RESTORE, FALSE, &mi);
+    }
+
+    if (!(GetWindowLongW(m_hwnd, GWL_STYLE) & WS_MINIMIZEBOX))
+    {
+        SetMenuItemInfoW(menu, SC_MINIMIZE, FALSE, &mi);
+    }
+
+    if (FIXED_SIZE(this))
+    {
+        SetMenuItemInfoW(menu, SC_SIZE, FALSE, &mi);
+    }
+
+    int cmd = int(TrackPopupMenu(menu, TPM_RIGHTBUTTON | TPM_NONOTIFY | TPM_RETURNCMD,
+                                 x, y, 0, m_hwnd, nullptr));
+
+    if (cmd)
+    {
+        SendMessageW(m_hwnd, WM_SYSCOMMAND, WPARAM(cmd), 0);
+    }
+}
+
+void QGoodWindow::showContextMenu()
+{
+    int pos_x = x();
+    int pos_y = y() + titleBarHeight();
+
+    if (m_is_using_system_borders && windowState().testFlag(Qt::WindowNoState))
+        pos_x += BORDERWIDTH();
+
+    pos_x = qFloor(pos_x * m_pixel_ratio);
+    pos_y = qFloor(pos_y * m_pixel_ratio);
+
+    showContextMenu(pos_x, pos_y);
+}
+
+QWidget *QGoodWindow::bestParentForModalWindow()
+{
+    return new QGoodWindowUtils::ParentWindow(this);
+}
+
+void QGoodWindow::moveCenterWindow(QWidget *widget)
+{
+    QGoodWindow *child_gw = qobject_cast<QGoodWindow*>(widget);
+
+    const int title_bar_height = titleBarHeight();
+
+    int border_width = 0;
+
+    if (m_is_using_system_borders && windowState().testFlag(Qt::WindowNoState))
+        border_width = BORDERWIDTH();
+
+    QRect rect;
+
+    if (!isMinimized() && isVisible())
+        rect = frameGeometry();
+    else
+        rect = m_window_handle->screen()->availableGeometry();
+
+    QRect screen_rect = m_window_handle->screen()->availableGeometry();
+
+    QRect window_rect;
+
+    if (child_gw)
+        window_rect = child_gw->frameGeometry();
+    else
+        window_rect = widget->frameGeometry();
+
+    window_rect.moveCenter(rect.center());
+
+    if (child_gw)
+    {
+        window_rect.moveLeft(qMax(window_rect.left(), screen_rect.left()));
+        window_rect.moveTop(qMax(window_rect.top(), screen_rect.top()));
+        window_rect.moveRight(qMin(window_rect.right(), screen_rect.right()));
+        window_rect.moveBottom(qMin(window_rect.bottom(), screen_rect.bottom()));
+    }
+    else
+    {
+        window_rect.moveLeft(qMax(window_rect.left(), screen_rect.left() + border_width));
+        window_rect.moveTop(qMax(window_rect.top() + titleBarHeight(), screen_rect.top() + title_bar_height));
+        window_rect.moveRight(qMin(window_rect.right(), screen_rect.right() - border_width));
+        window_rect.moveBottom(qMin(window_rect.bottom(), screen_rect.bottom() - border_width));
+    }
+
+    if (child_gw)
+        child_gw->setGeometry(window_rect);
+    else
+        widget->setGeometry(window_rect);
+}
+
+bool QGoodWindow::winButtonHover(qintptr button)
+{
+    if (button == -1)
+        return false;
+
+    switch (button)
+    {
+    case HTMINBUTTON:
+    case HTMAXBUTTON:
+    case HTCLOSE:
+    {
+        if (!m_is_caption_button_pressed)
+        {
+            if (button != m_last_caption_button_hovered)
+                buttonLeave(m_last_caption_button_hovered);
+
+            if (isEnabled())
+                buttonEnter(button);
+        }
+        else
+        {
+            if (button != m_last_caption_button_hovered)
+                buttonLeave(m_last_caption_button_hovered);
+
+            if (!m_is_caption_button_pressed || (button == m_caption_button_pressed))
+                buttonEnter(button);
+        }
+
+        return true;
+    }
+    default:
+    {
+        buttonLeave(m_last_caption_button_hovered);
+        return false;
+    }
+    }
+}
+
+void QGoodWindow::iconClicked()
+{
+    if (!m_is_menu_visible)
+    {
+        m_is_menu_visible = true;
+
+        m_timer_menu->start();
+
+        showContextMenu();
+
+        QTimer::singleShot(qApp->doubleClickInterval(), this, [=]{
+            m_is_menu_visible = false;
+        });
+    }
+
+    if (m_timer_menu->isActive())
+        QTimer::singleShot(0, this, &QGoodWindow::close);
+}
+#endif
+#ifdef Q_OS_LINUX
+void QGoodWindow::setCursorForCurrentPos()
+{
+    const QPoint cursor_pos = QCursor::pos();
+    const int margin = int(ncHitTest(qFloor(cursor_pos.x() * m_pixel_ratio), qFloor(cursor_pos.y() * m_pixel_ratio)));
+
+    m_cursor_pos = cursor_pos;
+    m_margin = margin;
+
+    QWidget *widget = QApplication::widgetAt(cursor_pos);
+
+    if (!widget || (widget->window() != m_shadow && widget->window() != qApp->activeModalWidget()))
+    {
+        QApplication::restoreOverrideCursor();
+        return;
+    }
+
+    Display *dpy = QX11Info::display();
+
+    switch (margin)
+    {
+    case HTTOPLEFT:
+    {
+        const Cursor cursor = QGoodWindowUtils::fontCursor(!FIXED_SIZE(this) ? XC_top_left_corner : XC_arrow);
+
+        XDefineCursor(dpy, Window(widget->winId()), cursor);
+
+        XFlush(dpy);
+
+        break;
+    }
+    case HTTOP:
+    {
+        const Cursor cursor = QGoodWindowUtils::fontCursor(!FIXED_HEIGHT(this) ? XC_top_side : XC_arrow);
+
+        XDefineCursor(dpy, Window(widget->winId()), cursor);
+
+        XFlush(dpy);
+
+        break;
+    }
+    case HTTOPRIGHT:
+    {
+        const Cursor cursor = QGoodWindowUtils::fontCursor(!FIXED_SIZE(this) ? XC_top_right_corner : XC_arrow);
+
+        XDefineCursor(dpy, Window(widget->winId()), cursor);
+
+        XFlush(dpy);
+
+        break;
+    }
+    case HTLEFT:
+    {
+        const Cursor cursor = QGoodWindowUtils::fontCursor(!FIXED_WIDTH(this) ? XC_left_side : XC_arrow);
+
+        XDefineCursor(dpy, Window(widget->winId()), cursor);
+
+        XFlush(dpy);
+
+        break;
+    }
+    case HTRIGHT:
+    {
+        const Cursor cursor = QGoodWindowUtils::fontCursor(!FIXED_WIDTH(this) ? XC_right_side : XC_arrow);
+
+        XDefineCursor(dpy, Window(widget->winId()), cursor);
+
+        XFlush(dpy);
+
+        break;
+    }
+    case HTBOTTOMLEFT:
+    {
+        const Cursor cursor = QGoodWindowUtils::fontCursor(!FIXED_SIZE(this) ? XC_bottom_left_corner : XC_arrow);
+
+        XDefineCursor(dpy, Window(widget->winId()), cursor);
+
+        XFlush(dpy);
+
+        break;
+    }
+    case HTBOTTOM:
+    {
+        const Cursor cursor = QGoodWindowUtils::fontCursor(!FIXED_HEIGHT(this) ? XC_bottom_side : XC_arrow);
+
+        XDefineCursor(dpy, Window(widget->winId()), cursor);
+
+        XFlush(dpy);
+
+        break;
+    }
+    case HTBOTTOMRIGHT:
+    {
+        const Cursor cursor = QGoodWindowUtils::fontCursor(!FIXED_SIZE(this) ? XC_bottom_right_corner : XC_arrow);
+
+        XDefineCursor(dpy, Window(widget->winId()), cursor);
+
+        XFlush(dpy);
+
+        break;
+    }
+    case HTCAPTION:
+    case HTMINBUTTON:
+    case HTMAXBUTTON:
+    case HTCLOSE:
+    {
+        if (QApplication::overrideCursor() &&
+                QApplication::overrideCursor()->shape() == Qt::ArrowCursor)
+            break;
+
+        QApplication::setOverrideCursor(Qt::ArrowCursor);
+
+        break;
+    }
+    case HTNOWHERE:
+    {
+        if (!QApplication::overrideCursor())
+            break;
+
+        if (QApplication::overrideCursor()->shape() != Qt::ArrowCursor)
+            break;
+
+        QApplication::restoreOverrideCursor();
+
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void QGoodWindow::startSystemMoveResize()
+{
+    const int margin = m_press_margin;
+
+    if (margin == HTNOWHERE)
+        return;
+
+    if (FIXED_SIZE(this) && margin != HTCAPTION)
+        return;
+
+    //The window manager expects the position of the button press.
+    QPoint cursor_pos = QPoint(qFloor(m_press_pos.x() * m_pixel_ratio), qFloor(m_press_pos.y() * m_pixel_ratio));
+
+    Display *dpy = QX11Info::display();
+
+    static const Atom move_resize_atom = XInternAtom(dpy, "_NET_WM_MOVERESIZE", False);
+
+    XClientMessageEvent xmsg;
+    memset(&xmsg, 0, sizeof(XClientMessageEvent));
+
+    xmsg.type = ClientMessage;
+    xmsg.window = Window(winId());
+    xmsg.message_type = move_resize_atom;
+    xmsg.format = 32;
+    xmsg.data.l[0] = long(cursor_pos.x());
+    xmsg.data.l[1] = long(cursor_pos.y());
+
+    if (margin == HTCAPTION)
+        xmsg.data.l[2] = MOVERESIZE_MOVE;
+    else
+        xmsg.data.l[2] = long(margin);
+
+    xmsg.data.l[3] = 0;
+    xmsg.data.l[4] = 0;
+
+    XSendEvent(dpy, QX11Info::appRootWindow(), False,
+               SubstructureRedirectMask | SubstructureNotifyMask,
+               reinterpret_cast<XEvent*>(&xmsg));
+
+    XUngrabPointer(dpy, QX11Info::appTime());
+    XFlush(dpy);
+
+    //Measured on demand by moveResizeLatency(), without a round trip to the X server here.
+    m_move_resize_timestamp = m_drag_timestamp;
+    m_move_resize_latency = -1;
+    m_move_resize_sent_timer.start();
+
+    m_resize_move_started = true;
+    m_move_resize_timer->start();
+
+    if (margin != HTCAPTION && !m_live_resize)
+    {
+        m_live_resize = true;
+        Q_EMIT liveResizeStarted();
+    }
+}
+
+void QGoodWindow::checkSystemMoveResizeFinished()
+{
+    if (!m_resize_move_started)
+        return;
+
+    Display *dpy = QX11Info::display();
+
+    Window root_return;
+    Window child_return;
+    int root_x, root_y, win_x, win_y;
+    unsigned int mask = 0;
+
+    //The window manager ends the move or resize when the button is released,
+    //while a button is held it's either still running or about to start.
+    if (dpy)
+        XQueryPointer(dpy, QX11Info::appRootWindow(), &root_return, &child_return,
+                      &root_x, &root_y, &win_x, &win_y, &mask);
+
+    if (mask & (Button1Mask | Button2Mask | Button3Mask))
+    {
+        m_move_resize_timer->start();
+        return;
+    }
+
+    finishSystemMoveResize();
+}
+
+void QGoodWindow::finishSystemMoveResize()
+{
+    if (!m_resize_move_started)
+        return;
+
+    m_move_resize_timer->stop();
+    m_resize_move_started = false;
+
+    //Fix mouse problems after resize or move.
+    QTest::mouseClick(windowHandle(), Qt::NoButton, Qt::NoModifier);
+
+    if (m_live_resize)
+    {
+        m_live_resize = false;
+        Q_EMIT liveResizeFinished();
+    }
+}
+
+void QGoodWindow::sizeMove()
+{
+    if (!m_resize_move)
+        return;
+
+    m_resize_move = false;
+
+    startSystemMoveResize();
+}
+
+void QGoodWindow::updatePixelRatio()
+{
+    QScreen *screen = windowHandle() ? windowHandle()->screen() : nullptr;
+
+    if (!screen)
+        return;
+
+    const qreal pixel_ratio = screen->devicePixelRatio();
+
+    if (qFuzzyCompare(pixel_ratio, m_pixel_ratio))
+        return;
+
+    m_pixel_ratio = pixel_ratio;
+
+    //The mask and the borders depend on the ratio, rebuild them only now.
+    m_mask_size = QSize();
+    clearMask();
+
+    updateMask();
+
+    if (isVisible() && windowState().testFlag(Qt::WindowNoState))
+        sizeMoveBorders();
+}
+
+void QGoodWindow::updateMask()
+{
+    if (!isVisible() || !windowState().testFlag(Qt::WindowNoState))
+    {
+        if (!mask().isEmpty())
+            clearMask();
+
+        return;
+    }
+
+    //The rounded mask only depends on the window size, keep it while the size doesn't change.
+    if (m_mask_size != size())
+    {
+        const int radius = 8;
+
+        QBitmap bmp(size());
+        bmp.clear();
+
+        QPainter painter;
+        painter.begin(&bmp);
+        painter.setRenderHints(QPainter::Antialiasing);
+        painter.setPen(Qt::color1);
+        painter.setBrush(Qt::color1);
+        painter.drawRoundedRect(rect(), radius, radius, Qt::AbsoluteSize);
+        painter.end();
+
+        m_mask_rgn = bmp;
+        m_mask_size = size();
+    }
+
+    if (mask() != m_mask_rgn)
+        setMask(m_mask_rgn);
+}
+
+void QGoodWindow::setupFrameSync()
+{
+    releaseFrameSync();
+
+    Display *dpy = QX11Info::display();
+
+    int event_base, error_base;
+
+    if (!XSyncQueryExtension(dpy, &event_base, &error_base))
+        return;
+
+    int major_version, minor_version;
+
+    if (!XSyncInitialize(dpy, &major_version, &minor_version))
+        return;
+
+    //The extended counter is only useful if the compositor tells when frames are drawn.
+    static const Atom supported_atom = XInternAtom(dpy, "_NET_SUPPORTED", False);
+    static const Atom frame_drawn_atom = XInternAtom(dpy, "_NET_WM_FRAME_DRAWN", False);
+
+    Atom supported_type;
+    int supported_format;
+    unsigned long supported_count;
+    unsigned long supported_bytes_after;
+    unsigned char *supported_data = nullptr;
+
+    bool frame_drawn_supported = false;
+
+    if (XGetWindowProperty(dpy, QX11Info::appRootWindow(), supported_atom, 0, 1024, False, XA_ATOM,
+                           &supported_type, &supported_format, &supported_count,
+                           &supported_bytes_after, &supported_data) == Success)
+    {
+        if (supported_data && supported_format == 32)
+        {
+            const Atom *atoms = reinterpret_cast<Atom*>(supported_data);
+
+            for (unsigned long i = 0; i < supported_count; i++)
+            {
+                if (atoms[i] == frame_drawn_atom)
+                {
+                    frame_drawn_supported = true;
+                    break;
+                }
+            }
+        }
+
+        if (supported_data)
+            XFree(supported_data);
+    }
+
+    if (!frame_drawn_supported)
+        return;
+
+    static const Atom counter_atom = XInternAtom(dpy, "_NET_WM_SYNC_REQUEST_COUNTER", False);
+
+    //Qt sets the basic counter and answers its requests, the extended counter is appended to it.
+    Atom type;
+    int format;
+    unsigned long count;
+    unsigned long bytes_after;
+    unsigned char *data = nullptr;
+
+    if (XGetWindowProperty(dpy, Window(winId()), counter_atom, 0, 2, False, XA_CARDINAL,
+                           &type, &format, &count, &bytes_after, &data) != Success)
+        return;
+
+    unsigned long basic_counter = None;
+
+    if (data && format == 32 && count > 0)
+        basic_counter = reinterpret_cast<unsigned long*>(data)[0];
+
+    if (data)
+        XFree(data);
+
+    if (basic_counter == None)
+        return;
+
+    m_sync_value = 0;
+
+    XSyncValue initial_value;
+    XSyncIntToValue(&initial_value, 0);
+
+    m_sync_counter = XSyncCreateCounter(dpy, initial_value);
+
+    unsigned long counters[2] = {basic_counter, m_sync_counter};
+
+    XChangeProperty(dpy, Window(winId()), counter_atom, XA_CARDINAL, 32, PropModeReplace,
+                    reinterpret_cast<unsigned char*>(counters), 2);
+
+    XFlush(dpy);
+
+    //Watch the expose events of the native window, see startFrameSync().
+    windowHandle()->installEventFilter(this);
+}
+
+void QGoodWindow::releaseFrameSync()
+{
+    m_sync_request_pending = false;
+    m_frame_pending = false;
+    m_update_deferred = false;
+
+    if (m_sync_counter == None)
+        return;
+
+    XSyncDestroyCounter(QX11Info::display(), m_sync_counter);
+
+    m_sync_counter = None;
+}
+
+quint64 QGoodWindow::startFrameSync()
+{
+    //An odd counter value tells that a frame is being drawn,
+    //an even value that it's complete and matches the window size.
+    quint64 value = m_sync_value;
+
+    if (m_sync_request_pending)
+    {
+        m_sync_request_pending = false;
+
+        //Finish the frame on the requested value.
+        if (m_sync_request_value > 0)
+            value = qMax(value, m_sync_request_value - 1);
+    }
+
+    if (value % 2 == 0)
+        value++;
+
+    setFrameSyncCounter(value);
+
+    return value;
+}
+
+void QGoodWindow::setFrameSyncCounter(quint64 value)
+{
+    Display *dpy = QX11Info::display();
+
+    XSyncValue sync_value;
+    XSyncIntsToValue(&sync_value, uint(value & 0xFFFFFFFF), int(value >> 32));
+
+    XSyncSetCounter(dpy, m_sync_counter, sync_value);
+    XFlush(dpy);
+
+    m_sync_value = value;
+}
+
+void QGoodWindow::frameDrawn(quint64 value)
+{
+    //Ignore notifications of older frames.
+    if (!m_frame_pending || value < m_sync_value)
+        return;
+
+    m_frame_pending = false;
+
+    if (m_update_deferred)
+    {
+        m_update_deferred = false;
+        QCoreApplication::postEvent(this, new QEvent(QEvent::UpdateRequest), Qt::LowEventPriority);
+    }
+}
+
+void QGoodWindow::sizeMoveBorders()
+{
+    if (!windowState().testFlag(Qt::WindowNoState))
+        return;
+
+    const int border_width = BORDERWIDTHDPI;
+
+    QRegion visible_rgn;
+
+    for (const QScreen *screen : qApp->screens())
+    {
+        visible_rgn += screen->availableGeometry();
+    }
+
+    QRect frame_geom = frameGeometry();
+    frame_geom.adjust(-border_width, -border_width, border_width, border_width);
+
+    QRegion rgn = m_shadow->rect();
+    rgn = rgn.subtracted(mask().translated(border_width, border_width));
+
+    rgn.translate(frame_geom.topLeft());
+
+    rgn = rgn.intersected(visible_rgn);
+
+    rgn.translate(-rgn.boundingRect().topLeft());
+
+    m_shadow->setMask(rgn);
+
+    m_shadow->setGeometry(frame_geom);
+}
+#endif
+#ifdef Q_OS_MAC
+void QGoodWindow::setMacOSStyle(int style_type)
+{
+    macOSNative::Style *style = static_cast<macOSNative::Style*>(style_ptr);
+    style->m_style = macOSNative::StyleType(style_type);
+    macOSNative::setStyle(long(winId()), style);
+}
+
+void QGoodWindow::notificationReceiver(const QByteArray &notification)
+{
+    if (notification == "NSWindowWillEnterFullScreenNotification")
+    {
+        m_on_animate_event = true;
+
+        setMacOSStyle(int(macOSNative::StyleType::Fullscreen));
+    }
+    else if (notification == "NSWindowWillExitFullScreenNotification")
+    {
+        setMacOSStyle(int(macOSNative::StyleType::NoState));
+    }
+    else if (notification == "NSWindowDidExitFullScreenNotification")
+    {
+        setMacOSStyle(int(macOSNative::StyleType::NoState));
+
+        m_on_animate_event = false;
+    }
+    else if (notification == "AppleInterfaceThemeChangedNotification")
+    {
+        QTimer::singleShot(0, this, &QGoodWindow::themeChanged);
+    }
+}
+#endif
+
+#ifdef QGOODWINDOW
+void QGoodWindow::updateSizeGrips(QChildEvent *event)
+{
+    switch (event->type())
+    {
+    case QEvent::ChildAdded:
+    {
+        QWidget *widget = qobject_cast<QWidget*>(event->child());
+
+        if (!widget)
+            break;
+
+#ifdef Q_OS_WIN
+        //Watch descendants for their own children, windows are handled on their own.
+        if (!widget->isWindow())
+            widget->installEventFilter(this);
+#endif
+        //A new widget has no children yet, a widget moved here may bring size grips with it.
+        for (QWidget *child : widget->findChildren<QWidget*>())
+        {
+#ifdef Q_OS_WIN
+            if (!child->isWindow())
+                child->installEventFilter(this);
+#endif
+            addSizeGrip(child);
+        }
+
+        break;
+    }
+    case QEvent::ChildPolished:
+    {
+        //Every widget is polished once fully constructed, including size grips.
+        addSizeGrip(qobject_cast<QWidget*>(event->child()));
+        break;
+    }
+    case QEvent::ChildRemoved:
+    {
+        removeSizeGrips(event->child());
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void QGoodWindow::addSizeGrip(QWidget *widget)
+{
+    QSizeGrip *size_grip = qobject_cast<QSizeGrip*>(widget);
+
+    if (!size_grip || size_grip->window() != this)
+        return;
+
+    m_size_grip_set.insert(size_grip);
+    connect(size_grip, &QObject::destroyed, this, &QGoodWindow::sizeGripDestroyed, Qt::UniqueConnection);
+}
+
+void QGoodWindow::removeSizeGrips(QObject *object)
+{
+    //While being destroyed the object is no longer a widget,
+    //its size grips are removed by sizeGripDestroyed().
+    QWidget *widget = qobject_cast<QWidget*>(object);
+
+    if (!widget)
+        return;
+
+    for (auto it = m_size_grip_set.begin(); it != m_size_grip_set.end();)
+    {
+        if (*it == widget || widget->isAncestorOf(*it))
+            it = m_size_grip_set.erase(it);
+        else
+            ++it;
+    }
+}
+
+void QGoodWindow::sizeGripDestroyed(QObject *object)
+{
+    //Only the address is used, the size grip is already partially destroyed.
+    m_size_grip_set.remove(static_cast<QSizeGrip*>(object));
+}
+
+qintptr QGoodWindow::ncHitTest(int pos_x, int pos_y)
+{
+    if (isFullScreen())
+    {
+        //If on full screen, the whole window can be clicked.
+        return HTNOWHERE;
+    }
+
+    int border_width = 0;
+
+#ifdef Q_OS_WIN
+    if (windowState().testFlag(Qt::WindowNoState))
+    {
+        if (m_is_using_system_borders)
+            border_width = qFloor(BORDERWIDTH() / m_pixel_ratio); //in pixels.
+        else
+            border_width = qFloor(1 * m_pixel_ratio); //in pixels.
+    }
+#endif
+
+//Get the window rectangle.
+#ifndef Q_OS_MAC
+    QRect window_rect = frameGeometry();
+#else
+    //Get the correct window rectangle for macOS.
+    QRect window_rect;
+
+    if (isVisible())
+    {
+        int x, y, w, h;
+        macOSNative::frameGeometry(long(winId()), &x, &y, &w, &h);
+        window_rect = QRect(x, y, w, h);
+    }
+#endif
+
+    //Get the point coordinates for the hit test.
+    const QPoint cursor_pos = QPoint(qFloor(pos_x / m_pixel_ratio), qFloor(pos_y / m_pixel_ratio));
+
+    //Get the mapped point coordinates for the hit test without border width.
+    const QPoint cursor_pos_map = QPoint(cursor_pos.x() - window_rect.x() - border_width, cursor_pos.y() - window_rect.y());
+
+#if defined Q_OS_WIN || defined Q_OS_LINUX
+    for (QSizeGrip *size_grip : m_size_grip_set)
+    {
+        if (size_grip->isEnabled() && size_grip->isVisible() &&
+                !size_grip->window()->windowFlags().testFlag(Qt::SubWindow))
+        {
+            QPoint cursor_pos_map_widget = size_grip->parentWidget()->mapFromGlobal(cursor_pos);
+#ifdef Q_OS_WIN
+            QPoint adjusted_pos = screenAdjustedPos();
+
+            cursor_pos_map_widget.setX(cursor_pos_map_widget.x() + adjusted_pos.x());
+            cursor_pos_map_widget.setY(cursor_pos_map_widget.y() + adjusted_pos.y());
+#endif
+            if (size_grip->geometry().contains(cursor_pos_map_widget))
+                return HTBOTTOMRIGHT;
+        }
+    }
+#endif
+
+    const int title_bar_height = titleBarHeight();
+
+#ifdef Q_OS_WIN
+    const int icon_width = iconWidth();
+#endif
+
+    //Determine if the hit test is for resizing. Default middle (1,1).
+    int row = 1;
+    int col = 1;
+    bool on_resize_border = false;
+
+    //Determine if the point is at the top or bottom of the window.
+    if (cursor_pos.y() < window_rect.top() + title_bar_height)
+    {
+        on_resize_border = (cursor_pos.y() < (window_rect.top() + border_width));
+        row = 0; //top border.
+    }
+    else if (cursor_pos.y() > window_rect.bottom() - border_width)
+    {
+        row = 2; //bottom border.
+    }
+
+    //Determine if the point is at the left or right of the window.
+    if (cursor_pos.x() < window_rect.left() + border_width)
+    {
+        col = 0; //left border.
+    }
+    else if (cursor_pos.x() > window_rect.right() - border_width)
+    {
+        col = 2; //right border.
+    }
+    else if (row == 0 && !on_resize_border)
+    {
+        if (m_cls_mask.contains(cursor_pos_map))
+            return HTCLOSE; //title bar close button.
+        else if (m_max_mask.contains(cursor_pos_map))
+            return HTMAXBUTTON; //title bar maximize button.
+        else if (m_min_mask.contains(cursor_pos_map))
+            return HTMINBUTTON; //title bar minimize button.
+#ifdef Q_OS_WIN
+        else if (cursor_pos_map.x() <= icon_width)
+            return HTSYSMENU; //title bar icon.
+#endif
+        else if (m_title_bar_mask.contains(cursor_pos_map))
+            return HTNOWHERE; //user title bar mask.
+    }
+
+    //Hit test (HTTOPLEFT, ... HTBOTTOMRIGHT)
+    qintptr hitTests[3][3] =
+    {
+        {HTTOPLEFT, on_resize_border ? HTTOP : HTCAPTION, HTTOPRIGHT},
+        {HTLEFT, HTNOWHERE, HTRIGHT},
+        {HTBOTTOMLEFT, HTBOTTOM, HTBOTTOMRIGHT},
+    };
+
+    return hitTests[row][col];
+}
+
+void QGoodWindow::buttonEnter(qintptr button)
+{
+    if (button == -1)
+        return;
+
+    if (button == m_last_caption_button_hovered)
+        return;
+
+    m_last_caption_button_hovered = button;
+
+    switch (button)
+    {
+    case HTMINBUTTON:
+    {
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::MinimizeHoverEnter);
+
+        break;
+    }
+    case HTMAXBUTTON:
+    {
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::MaximizeHoverEnter);
+
+        break;
+    }
+    case HTCLOSE:
+    {
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::CloseHoverEnter);
+
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void QGoodWindow::buttonLeave(qintptr button)
+{
+    if (button == -1)
+        return;
+
+    if (button != m_last_caption_button_hovered)
+        return;
+
+    m_last_caption_button_hovered = -1;
+
+    switch (button)
+    {
+    case HTMINBUTTON:
+    {
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::MinimizeHoverLeave);
+
+        break;
+    }
+    case HTMAXBUTTON:
+    {
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::MaximizeHoverLeave);
+
+        break;
+    }
+    case HTCLOSE:
+    {
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::CloseHoverLeave);
+
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+bool QGoodWindow::buttonPress(qintptr button)
+{
+    if (button == -1)
+        return false;
+
+    switch (button)
+    {
+    case HTMINBUTTON:
+    {
+        m_is_caption_button_pressed = true;
+        m_caption_button_pressed = HTMINBUTTON;
+
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::MinimizePress);
+
+        activateWindow();
+
+        return true;
+    }
+    case HTMAXBUTTON:
+    {
+        m_is_caption_button_pressed = true;
+        m_caption_button_pressed = HTMAXBUTTON;
+
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::MaximizePress);
+
+        activateWindow();
+
+        return true;
+    }
+    case HTCLOSE:
+    {
+        m_is_caption_button_pressed = true;
+        m_caption_button_pressed = HTCLOSE;
+
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::ClosePress);
+
+        activateWindow();
+
+        return true;
+    }
+    default:
+        break;
+    }
+
+    return false;
+}
+
+bool QGoodWindow::buttonRelease(qintptr button, bool valid_click)
+{
+    if (button == -1)
+        return false;
+
+    if (!m_is_caption_button_pressed)
+        return false;
+
+    if (m_hover_timer->isActive())
+        return false;
+
+    m_is_caption_button_pressed = false;
+    m_caption_button_pressed = -1;
+
+    switch (button)
+    {
+    case HTMINBUTTON:
+    {
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::MinimizeRelease);
+
+        if (valid_click)
+        {
+            buttonLeave(button);
+            Q_EMIT captionButtonStateChanged(CaptionButtonState::MinimizeClicked);
+            m_hover_timer->start();
+        }
+
+        return true;
+    }
+    case HTMAXBUTTON:
+    {
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::MaximizeRelease);
+
+        if (valid_click)
+        {
+            buttonLeave(button);
+            Q_EMIT captionButtonStateChanged(CaptionButtonState::MaximizeClicked);
+            m_hover_timer->start();
+        }
+
+        return true;
+    }
+    case HTCLOSE:
+    {
+        Q_EMIT captionButtonStateChanged(CaptionButtonState::CloseRelease);
+
+        if (valid_click)
+        {
+            buttonLeave(button);
+            Q_EMIT captionButtonStateChanged(CaptionButtonState::CloseClicked);
+            m_hover_timer->start();
+        }
+
+        return true;
+    }
+    default:
+        break;
+    }
+
+    return false;
+}
+#endif
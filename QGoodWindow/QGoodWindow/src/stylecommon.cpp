@@ -1,121 +1,793 @@
-/*
-The MIT License (MIT)
-
-Copyright © 2022-2023 Antonio Dias (https://github.com/antonypro)
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#ifdef _WIN32
-
-#ifdef NTDDI_VERSION
-#undef NTDDI_VERSION
-#endif
-
-#ifdef _WIN32_WINNT
-#undef _WIN32_WINNT
-#endif
-
-#define NTDDI_VERSION NTDDI_VISTA
-#define _WIN32_WINNT _WIN32_WINNT_VISTA
-
-#include <windows.h>
-#include <shellapi.h>
-
-#include "stylecommon.h"
-
-QPixmap StyleCommon::winStandardPixmap(QStyle::StandardPixmap standardPixmap)
-{
-    QPixmap pixmap;
-
-    HICON hicon = nullptr;
-
-    LPCWSTR icon_handle_xp = nullptr;
-    SHSTOCKICONID icon_handle_vista = SIID_INVALID;
-
-    switch (standardPixmap)
-    {
-    case QStyle::SP_MessageBoxInformation:
-    {
-        icon_handle_xp = IDI_INFORMATION;
-        icon_handle_vista = SIID_INFO;
-        break;
-    }
-    case QStyle::SP_MessageBoxWarning:
-    {
-        icon_handle_xp = IDI_WARNING;
-        icon_handle_vista = SIID_WARNING;
-        break;
-    }
-    case QStyle::SP_MessageBoxCritical:
-    {
-        icon_handle_xp = IDI_ERROR;
-        icon_handle_vista = SIID_ERROR;
-        break;
-    }
-    case QStyle::SP_MessageBoxQuestion:
-    {
-        icon_handle_xp = IDI_QUESTION;
-        icon_handle_vista = SIID_HELP;
-        break;
-    }
-    default:
-        break;
-    }
-
-    typedef HRESULT(STDAPICALLTYPE *tSHGetStockIconInfo)(SHSTOCKICONID siid, UINT uFlags, SHSTOCKICONINFO *psii);
-    tSHGetStockIconInfo pSHGetStockIconInfo = tSHGetStockIconInfo(QLibrary::resolve("shell32", "SHGetStockIconInfo"));
-
-    if (pSHGetStockIconInfo)
-    {
-        if (icon_handle_vista != SIID_INVALID)
-        {
-            SHSTOCKICONINFO sii;
-            memset(&sii, 0, sizeof(SHSTOCKICONINFO));
-            sii.cbSize = sizeof(sii);
-
-            if (SUCCEEDED(pSHGetStockIconInfo(icon_handle_vista, SHGSI_ICON | SHGSI_LARGEICON, &sii)))
-            {
-                hicon = sii.hIcon;
-            }
-        }
-    }
-    else
-    {
-        if (icon_handle_xp)
-        {
-            hicon = LoadIconW(nullptr, icon_handle_xp);
-        }
-    }
-
-    if (hicon)
-    {
-#ifdef QT_VERSION_QT5
-        pixmap = QtWin::fromHICON(hicon);
-#endif
-#ifdef QT_VERSION_QT6
-        pixmap = QPixmap::fromImage(QImage::fromHICON(hicon));
-#endif
-        DestroyIcon(hicon);
-    }
-
-    return pixmap;
-}
-
-#endif
+/*
+The MIT License (MIT)
+
+Copyright © 2022-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifdef _WIN32
+
+#ifdef NTDDI_VERSION
+#undef NTDDI_VERSION
+#endif
+
+#ifdef _WIN32_WINNT
+#undef _WIN32_WINNT
+#endif
+
+#define NTDDI_VERSION NTDDI_VISTA
+#define _WIN32_WINNT _WIN32_WINNT_VISTA
+
+#include <windows.h>
+#include <shellapi.h>
+#endif
+
+#include "stylecommon.h"
+
+#ifdef _WIN32
+#ifdef QT_VERSION_QT5
+#include <QtWinExtras>
+#endif
+
+QPixmap StyleCommon::winStandardPixmap(QStyle::StandardPixmap standardPixmap)
+{
+    QPixmap pixmap;
+
+    HICON hicon = nullptr;
+
+    LPCWSTR icon_handle_xp = nullptr;
+    SHSTOCKICONID icon_handle_vista = SIID_INVALID;
+
+    switch (standardPixmap)
+    {
+    case QStyle::SP_MessageBoxInformation:
+    {
+        icon_handle_xp = IDI_INFORMATION;
+        icon_handle_vista = SIID_INFO;
+        break;
+    }
+    case QStyle::SP_MessageBoxWarning:
+    {
+        icon_handle_xp = IDI_WARNING;
+        icon_handle_vista = SIID_WARNING;
+        break;
+    }
+    case QStyle::SP_MessageBoxCritical:
+    {
+        icon_handle_xp = IDI_ERROR;
+        icon_handle_vista = SIID_ERROR;
+        break;
+    }
+    case QStyle::SP_MessageBoxQuestion:
+    {
+        icon_handle_xp = IDI_QUESTION;
+        icon_handle_vista = SIID_HELP;
+        break;
+    }
+    default:
+        break;
+    }
+
+    typedef HRESULT(STDAPICALLTYPE *tSHGetStockIconInfo)(SHSTOCKICONID siid, UINT uFlags, SHSTOCKICONINFO *psii);
+    tSHGetStockIconInfo pSHGetStockIconInfo = tSHGetStockIconInfo(QLibrary::resolve("shell32", "SHGetStockIconInfo"));
+
+    if (pSHGetStockIconInfo)
+    {
+        if (icon_handle_vista != SIID_INVALID)
+        {
+            SHSTOCKICONINFO sii;
+            memset(&sii, 0, sizeof(SHSTOCKICONINFO));
+            sii.cbSize = sizeof(sii);
+
+            if (SUCCEEDED(pSHGetStockIconInfo(icon_handle_vista, SHGSI_ICON | SHGSI_LARGEICON, &sii)))
+            {
+                hicon = sii.hIcon;
+            }
+        }
+    }
+    else
+    {
+        if (icon_handle_xp)
+        {
+            hicon = LoadIconW(nullptr, icon_handle_xp);
+        }
+    }
+
+    if (hicon)
+    {
+#ifdef QT_VERSION_QT5
+        pixmap = QtWin::fromHICON(hicon);
+#endif
+#ifdef QT_VERSION_QT6
+        pixmap = QPixmap::fromImage(QImage::fromHICON(hicon));
+#endif
+        DestroyIcon(hicon);
+    }
+
+    return pixmap;
+}
+
+#endif
+
+CommonStyle::CommonStyle(QStyle *style, const StyleCommon::Colors &colors) : QProxyStyle(style)
+{
+    m_colors = colors;
+}
+
+CommonStyle::~CommonStyle()
+{
+
+}
+
+QLinearGradient CommonStyle::panelGradient(const QRect &rect, Qt::Edge edge) const
+{
+    //The darker color starts at edge.
+    QLinearGradient gradient;
+
+    switch (edge)
+    {
+    case Qt::TopEdge:
+    {
+        gradient = QLinearGradient(rect.topLeft(), rect.bottomLeft());
+        break;
+    }
+    case Qt::BottomEdge:
+    {
+        gradient = QLinearGradient(rect.bottomLeft(), rect.topLeft());
+        break;
+    }
+    case Qt::LeftEdge:
+    {
+        gradient = QLinearGradient(rect.topLeft(), rect.topRight());
+        break;
+    }
+    case Qt::RightEdge:
+    {
+        gradient = QLinearGradient(rect.topRight(), rect.topLeft());
+        break;
+    }
+    }
+
+    gradient.setColorAt(0, m_colors.gradient_dark);
+    gradient.setColorAt(1, m_colors.gradient_light);
+
+    return gradient;
+}
+
+void CommonStyle::drawPrimitive(PrimitiveElement element, const QStyleOption *option, QPainter *painter, const QWidget *widget) const
+{
+    switch (element)
+    {
+    case PE_PanelTipLabel:
+    {
+        //The tool tip palette is not updated with the application palette.
+        const QPalette palette = QApplication::palette();
+
+        painter->save();
+        painter->fillRect(option->rect, palette.base());
+        painter->setPen(palette.highlight().color());
+        painter->drawRect(option->rect.adjusted(0, 0, -1, -1));
+        painter->restore();
+
+        return;
+    }
+    case PE_PanelStatusBar:
+    {
+        painter->fillRect(option->rect, panelGradient(option->rect, Qt::TopEdge));
+        return;
+    }
+    case PE_PanelMenu:
+    {
+        painter->fillRect(option->rect, option->palette.window());
+        return;
+    }
+    case PE_FrameMenu:
+    {
+        painter->save();
+        painter->setPen(option->palette.shadow().color());
+        painter->drawRect(option->rect.adjusted(0, 0, -1, -1));
+        painter->restore();
+
+        return;
+    }
+    case PE_IndicatorDockWidgetResizeHandle:
+    {
+        if (option->state & State_MouseOver)
+        {
+            painter->fillRect(option->rect, option->palette.highlight());
+            return;
+        }
+
+        break;
+    }
+    case PE_FrameTabWidget:
+    {
+        QColor frame = m_colors.frame;
+        frame.setAlpha(127);
+
+        QColor border = m_colors.border;
+        border.setAlpha(127);
+
+        painter->save();
+        painter->fillRect(option->rect, frame);
+        painter->setPen(border);
+        painter->drawLine(option->rect.topLeft(), option->rect.topRight());
+        painter->restore();
+
+        return;
+    }
+    case PE_FrameTabBarBase:
+    {
+        QColor border = m_colors.border;
+        border.setAlpha(127);
+
+        painter->save();
+        painter->setPen(border);
+        painter->drawLine(option->rect.bottomLeft(), option->rect.bottomRight());
+        painter->restore();
+
+        return;
+    }
+    case PE_IndicatorTabClose:
+    {
+        const bool enabled = (option->state & State_Enabled);
+        const bool pressed = (option->state & State_Sunken);
+        const bool hover = (option->state & State_MouseOver);
+
+        if (enabled && (pressed || hover))
+        {
+            QLinearGradient gradient;
+
+            if (pressed)
+            {
+                gradient = panelGradient(option->rect, Qt::BottomEdge);
+            }
+            else
+            {
+                QColor hover_dark = m_colors.button_hover;
+                QColor hover_light = m_colors.button_hover;
+                hover_light.setAlpha(75);
+
+                gradient = QLinearGradient(option->rect.topLeft(), option->rect.bottomLeft());
+                gradient.setColorAt(0, hover_dark);
+                gradient.setColorAt(1, hover_light);
+            }
+
+            painter->save();
+            painter->setRenderHint(QPainter::Antialiasing);
+            painter->setPen(option->palette.base().color());
+            painter->setBrush(gradient);
+            painter->drawRoundedRect(QRectF(option->rect).adjusted(0.5, 0.5, -0.5, -0.5), 2, 2);
+            painter->restore();
+        }
+
+        break;
+    }
+    case PE_PanelItemViewRow:
+    {
+        //Alternate rows of tree and table views use the window color.
+        const QStyleOptionViewItem *item = qstyleoption_cast<const QStyleOptionViewItem*>(option);
+
+        if (item && (item->features & QStyleOptionViewItem::Alternate) &&
+                (qobject_cast<const QTreeView*>(widget) || qobject_cast<const QTableView*>(widget)))
+        {
+            QStyleOptionViewItem row = *item;
+            row.palette.setBrush(QPalette::AlternateBase, row.palette.window());
+            QProxyStyle::drawPrimitive(element, &row, painter, widget);
+            return;
+        }
+
+        break;
+    }
+    default:
+        break;
+    }
+
+    QProxyStyle::drawPrimitive(element, option, painter, widget);
+}
+
+void CommonStyle::drawControl(ControlElement element, const QStyleOption *option, QPainter *painter, const QWidget *widget) const
+{
+    switch (element)
+    {
+    case CE_MenuBarEmptyArea:
+    {
+        //Transparent.
+        return;
+    }
+    case CE_MenuBarItem:
+    {
+        const QStyleOptionMenuItem *menu_item = qstyleoption_cast<const QStyleOptionMenuItem*>(option);
+
+        if (!menu_item)
+            break;
+
+        const bool enabled = (option->state & State_Enabled);
+        const bool pressed = (option->state & State_Sunken);
+        const bool selected = (option->state & State_Selected);
+
+        QPalette::ColorRole text_role = QPalette::WindowText;
+
+        painter->save();
+
+        if (enabled && pressed)
+        {
+            QColor border = m_colors.border;
+            border.setAlpha(127);
+
+            painter->fillRect(option->rect, option->palette.highlight());
+            painter->setPen(border);
+            painter->drawLine(option->rect.topLeft(), option->rect.bottomLeft());
+            painter->drawLine(option->rect.topRight(), option->rect.bottomRight());
+
+            text_role = QPalette::HighlightedText;
+        }
+        else if (enabled && selected)
+        {
+            painter->fillRect(option->rect, m_colors.menu_bar_selected);
+        }
+
+        QPalette palette = menu_item->palette;
+        palette.setColor(QPalette::HighlightedText, QColor(255, 255, 255));
+
+        int alignment = Qt::AlignCenter | Qt::TextShowMnemonic | Qt::TextDontClip | Qt::TextSingleLine;
+
+        if (!proxy()->styleHint(SH_UnderlineShortcut, option, widget))
+            alignment |= Qt::TextHideMnemonic;
+
+        if (!menu_item->icon.isNull())
+        {
+            const int icon_size = proxy()->pixelMetric(PM_SmallIconSize, option, widget);
+            const QPixmap pixmap = menu_item->icon.pixmap(QSize(icon_size, icon_size),
+                                                          enabled ? QIcon::Normal : QIcon::Disabled);
+
+            proxy()->drawItemPixmap(painter, option->rect, alignment, pixmap);
+        }
+        else
+        {
+            proxy()->drawItemText(painter, option->rect, alignment, palette, enabled, menu_item->text, text_role);
+        }
+
+        painter->restore();
+
+        return;
+    }
+    case CE_MenuItem:
+    {
+        const QStyleOptionMenuItem *menu_item = qstyleoption_cast<const QStyleOptionMenuItem*>(option);
+
+        if (!menu_item)
+            break;
+
+        if (menu_item->menuItemType == QStyleOptionMenuItem::Separator)
+        {
+            const int y = option->rect.center().y();
+
+            painter->fillRect(QRect(option->rect.left() + 5, y, option->rect.width() - 10, 1),
+                              option->palette.alternateBase());
+
+            return;
+        }
+
+        if (!(option->state & State_Enabled))
+            painter->fillRect(option->rect, m_colors.menu_item_disabled);
+
+        QStyleOptionMenuItem item = *menu_item;
+        item.palette.setColor(QPalette::HighlightedText, QColor(255, 255, 255));
+        QProxyStyle::drawControl(element, &item, painter, widget);
+
+        return;
+    }
+    case CE_ToolBar:
+    {
+        const QStyleOptionToolBar *tool_bar = qstyleoption_cast<const QStyleOptionToolBar*>(option);
+
+        if (!tool_bar)
+            break;
+
+        Qt::Edge edge = Qt::TopEdge;
+
+        switch (tool_bar->toolBarArea)
+        {
+        case Qt::BottomToolBarArea:
+        {
+            edge = Qt::BottomEdge;
+            break;
+        }
+        case Qt::LeftToolBarArea:
+        {
+            edge = Qt::LeftEdge;
+            break;
+        }
+        case Qt::RightToolBarArea:
+        {
+            edge = Qt::RightEdge;
+            break;
+        }
+        default:
+            break;
+        }
+
+        painter->fillRect(option->rect, panelGradient(option->rect, edge));
+
+        return;
+    }
+    case CE_Splitter:
+    {
+        if (option->state & State_MouseOver)
+        {
+            painter->fillRect(option->rect, option->palette.highlight());
+            return;
+        }
+
+        break;
+    }
+    case CE_DockWidgetTitle:
+    {
+        QColor border = m_colors.border;
+        border.setAlpha(75);
+
+        const QRect rect = option->rect;
+
+        painter->save();
+        painter->fillRect(rect, panelGradient(rect, Qt::BottomEdge));
+        painter->setPen(border);
+        painter->drawRect(rect.adjusted(0, 0, -1, -1));
+        painter->fillRect(QRect(rect.left(), rect.bottom() - 1, rect.width(), 2), border);
+        painter->restore();
+
+        break;
+    }
+    case CE_TabBarTabShape:
+    {
+        const QStyleOptionTab *tab = qstyleoption_cast<const QStyleOptionTab*>(option);
+
+        if (!tab || (tab->shape != QTabBar::RoundedNorth && tab->shape != QTabBar::TriangularNorth))
+            break;
+
+        const bool selected = (option->state & State_Selected);
+        const bool hover = (option->state & State_MouseOver);
+
+        QRect rect = option->rect;
+
+        if (!selected)
+            rect.adjust(0, 2, 0, 0);
+
+        QLinearGradient gradient;
+
+        if (selected || hover)
+        {
+            gradient = QLinearGradient(rect.topLeft(), rect.bottomLeft());
+            gradient.setColorAt(0, m_colors.tab_dark);
+            gradient.setColorAt(1, m_colors.tab_light);
+        }
+        else
+        {
+            gradient = panelGradient(rect, Qt::BottomEdge);
+        }
+
+        QColor border = m_colors.border;
+        border.setAlpha(75);
+
+        painter->save();
+
+        //Only the top corners are rounded.
+        painter->setClipRect(rect);
+        painter->setRenderHint(QPainter::Antialiasing);
+        painter->setPen(border);
+        painter->setBrush(gradient);
+        painter->drawRoundedRect(QRectF(rect).adjusted(0.5, 0.5, -0.5, 4), 4, 4);
+
+        if (selected)
+        {
+            const QColor underline = (option->state & State_Enabled) ?
+                        option->palette.highlight().color() : QColor(127, 127, 127);
+
+            painter->fillRect(QRect(rect.left(), rect.bottom() - 1, rect.width(), 2), underline);
+        }
+
+        painter->restore();
+
+        return;
+    }
+    case CE_HeaderSection:
+    {
+        //Only headers of tree and table views.
+        const QWidget *view = widget ? widget->parentWidget() : nullptr;
+
+        if (!qobject_cast<const QTreeView*>(view) && !qobject_cast<const QTableView*>(view))
+            break;
+
+        painter->save();
+        painter->fillRect(option->rect, panelGradient(option->rect, Qt::BottomEdge));
+        painter->setPen(option->palette.dark().color());
+        painter->drawLine(option->rect.bottomLeft(), option->rect.bottomRight());
+        painter->restore();
+
+        return;
+    }
+    default:
+        break;
+    }
+
+    QProxyStyle::drawControl(element, option, painter, widget);
+}
+
+void CommonStyle::drawComplexControl(ComplexControl control, const QStyleOptionComplex *option, QPainter *painter, const QWidget *widget) const
+{
+    switch (control)
+    {
+    case CC_GroupBox:
+    {
+        const QStyleOptionGroupBox *group_box = qstyleoption_cast<const QStyleOptionGroupBox*>(option);
+
+        if (!group_box)
+            break;
+
+        QStyleOptionGroupBox box = *group_box;
+
+        QColor border = m_colors.border;
+        border.setAlpha(127);
+
+        painter->save();
+        painter->setRenderHint(QPainter::Antialiasing);
+
+        if (box.subControls & SC_GroupBoxFrame)
+        {
+            QColor frame = m_colors.frame;
+            frame.setAlpha(127);
+
+            const QRect frame_rect = proxy()->subControlRect(control, option, SC_GroupBoxFrame, widget);
+
+            painter->setPen(border);
+            painter->setBrush(frame);
+            painter->drawRoundedRect(QRectF(frame_rect).adjusted(0.5, 0.5, -0.5, -0.5), 4, 4);
+
+            box.subControls &= ~SC_GroupBoxFrame;
+        }
+
+        if ((box.subControls & SC_GroupBoxLabel) && !box.text.isEmpty())
+        {
+            QRect title_rect = proxy()->subControlRect(control, option, SC_GroupBoxLabel, widget);
+
+            if (box.subControls & SC_GroupBoxCheckBox)
+                title_rect |= proxy()->subControlRect(control, option, SC_GroupBoxCheckBox, widget);
+
+            title_rect.adjust(-6, -4, 6, 4);
+
+            QColor title_border = m_colors.border;
+            title_border.setAlpha(75);
+
+            painter->setClipRect(title_rect);
+            painter->setPen(title_border);
+            painter->setBrush(panelGradient(title_rect, Qt::BottomEdge));
+            painter->drawRoundedRect(QRectF(title_rect).adjusted(0.5, 0.5, -0.5, 4), 4, 4);
+            painter->setClipping(false);
+            painter->fillRect(QRect(title_rect.left(), title_rect.bottom() - 1, title_rect.width(), 2), QColor(127, 127, 127));
+        }
+
+        painter->restore();
+
+        QProxyStyle::drawComplexControl(control, &box, painter, widget);
+
+        return;
+    }
+    case CC_ScrollBar:
+    {
+        painter->fillRect(option->rect, option->palette.base());
+
+        const QRect slider = proxy()->subControlRect(control, option, SC_ScrollBarSlider, widget);
+
+        if ((option->subControls & SC_ScrollBarSlider) && slider.isValid())
+        {
+            const QStyleOptionSlider *bar = qstyleoption_cast<const QStyleOptionSlider*>(option);
+            const bool horizontal = (bar && bar->orientation == Qt::Horizontal);
+            const bool active = (option->activeSubControls & SC_ScrollBarSlider) &&
+                    (option->state & (State_MouseOver | State_Sunken));
+
+            const QRect handle = horizontal ? slider.adjusted(2, 4, -2, -4) : slider.adjusted(4, 2, -4, -2);
+
+            painter->save();
+            painter->setRenderHint(QPainter::Antialiasing);
+            painter->setPen(Qt::NoPen);
+            painter->setBrush(active ? option->palette.highlight() : option->palette.alternateBase());
+            painter->drawRoundedRect(handle, 2, 2);
+            painter->restore();
+        }
+
+        return;
+    }
+    case CC_Slider:
+    {
+        const QStyleOptionSlider *slider = qstyleoption_cast<const QStyleOptionSlider*>(option);
+
+        if (!slider || slider->orientation != Qt::Horizontal)
+            break;
+
+        const QRect groove = proxy()->subControlRect(control, option, SC_SliderGroove, widget);
+        const QRect handle = proxy()->subControlRect(control, option, SC_SliderHandle, widget);
+
+        if (option->subControls & SC_SliderGroove)
+        {
+            const QRect bar(groove.left(), groove.center().y() - 2, groove.width(), 4);
+
+            QRect sub_page = bar;
+            QRect add_page = bar;
+
+            if (slider->upsideDown)
+            {
+                sub_page.setLeft(handle.center().x());
+                add_page.setRight(handle.center().x());
+            }
+            else
+            {
+                sub_page.setRight(handle.center().x());
+                add_page.setLeft(handle.center().x());
+            }
+
+            const QColor sub_page_color = (option->state & State_Enabled) ?
+                        option->palette.highlight().color() : QColor(80, 80, 80);
+
+            painter->fillRect(add_page, option->palette.base());
+            painter->fillRect(sub_page, sub_page_color);
+        }
+
+        if (option->subControls & SC_SliderTickmarks)
+        {
+            QStyleOptionSlider tick_marks = *slider;
+            tick_marks.subControls = SC_SliderTickmarks;
+            QProxyStyle::drawComplexControl(control, &tick_marks, painter, widget);
+        }
+
+        if (option->subControls & SC_SliderHandle)
+        {
+            const bool active = (option->activeSubControls & SC_SliderHandle) &&
+                    (option->state & (State_MouseOver | State_Sunken));
+
+            painter->save();
+            painter->setRenderHint(QPainter::Antialiasing);
+            painter->setPen(m_colors.handle_border);
+            painter->setBrush(active ? option->palette.highlight() : option->palette.alternateBase());
+            painter->drawRoundedRect(QRectF(handle).adjusted(0.5, 0.5, -0.5, -0.5), 4, 4);
+            painter->restore();
+        }
+
+        return;
+    }
+    default:
+        break;
+    }
+
+    QProxyStyle::drawComplexControl(control, option, painter, widget);
+}
+
+QRect CommonStyle::subControlRect(ComplexControl control, const QStyleOptionComplex *option, SubControl sub_control, const QWidget *widget) const
+{
+    if (control == CC_ScrollBar)
+    {
+        //Scroll bars without arrow buttons.
+        const QStyleOptionSlider *bar = qstyleoption_cast<const QStyleOptionSlider*>(option);
+
+        if (bar)
+        {
+            const QRect rect = bar->rect;
+            const bool horizontal = (bar->orientation == Qt::Horizontal);
+            const int length = horizontal ? rect.width() : rect.height();
+            const int range = bar->maximum - bar->minimum;
+
+            int slider_length = length;
+
+            if (range > 0)
+            {
+                const int slider_min = proxy()->pixelMetric(PM_ScrollBarSliderMin, option, widget);
+                slider_length = int(qint64(bar->pageStep) * length / (qint64(range) + bar->pageStep));
+                slider_length = qBound(qMin(slider_min, length), slider_length, length);
+            }
+
+            const int slider_start = sliderPositionFromValue(bar->minimum, bar->maximum, bar->sliderPosition,
+                                                             length - slider_length, bar->upsideDown);
+
+            int start = 0;
+            int end = 0;
+
+            switch (sub_control)
+            {
+            case SC_ScrollBarSubLine:
+            case SC_ScrollBarAddLine:
+            {
+                return QRect();
+            }
+            case SC_ScrollBarGroove:
+            {
+                start = 0;
+                end = length;
+                break;
+            }
+            case SC_ScrollBarSlider:
+            {
+                start = slider_start;
+                end = slider_start + slider_length;
+                break;
+            }
+            case SC_ScrollBarSubPage:
+            {
+                start = 0;
+                end = slider_start;
+                break;
+            }
+            case SC_ScrollBarAddPage:
+            {
+                start = slider_start + slider_length;
+                end = length;
+                break;
+            }
+            default:
+                return QProxyStyle::subControlRect(control, option, sub_control, widget);
+            }
+
+            const QRect sub_rect = horizontal ?
+                        QRect(rect.left() + start, rect.top(), end - start, rect.height()) :
+                        QRect(rect.left(), rect.top() + start, rect.width(), end - start);
+
+            return visualRect(bar->direction, rect, sub_rect);
+        }
+    }
+
+    return QProxyStyle::subControlRect(control, option, sub_control, widget);
+}
+
+int CommonStyle::pixelMetric(PixelMetric metric, const QStyleOption *option, const QWidget *widget) const
+{
+    switch (metric)
+    {
+    case PM_ScrollBarExtent:
+        return 16;
+    case PM_ScrollBarSliderMin:
+        return 20;
+    case PM_SplitterWidth:
+        return 10;
+    case PM_DockWidgetSeparatorExtent:
+        return 6;
+    case PM_MenuPanelWidth:
+        return 1;
+    case PM_IndicatorWidth:
+    case PM_IndicatorHeight:
+    case PM_ExclusiveIndicatorWidth:
+    case PM_ExclusiveIndicatorHeight:
+        return 18;
+    default:
+        break;
+    }
+
+    return QProxyStyle::pixelMetric(metric, option, widget);
+}
+
+void CommonStyle::polish(QWidget *widget)
+{
+    QProxyStyle::polish(widget);
+
+    if (widget && widget->inherits("QTipLabel"))
+    {
+        //The tool tip palette is not updated with the application palette.
+        QPalette palette = widget->palette();
+        palette.setColor(QPalette::ToolTipText, QApplication::palette().color(QPalette::Text));
+        widget->setPalette(palette);
+    }
+}
@@ -1,46 +1,91 @@
-/*
-The MIT License (MIT)
-
-Copyright © 2022-2023 Antonio Dias (https://github.com/antonypro)
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#ifndef STYLECOMMON
-#define STYLECOMMON
-
-#ifdef _WIN32
-
-#include <QtCore>
-#include <QtGui>
-#include <QtWidgets>
-
-#ifdef QT_VERSION_QT5
-#include <QtWinExtras>
-#endif
-
-namespace StyleCommon
-{
-QPixmap winStandardPixmap(QStyle::StandardPixmap standardPixmap);
-}
-
-#endif
-
-#endif // STYLECOMMON
-
+/*
+The MIT License (MIT)
+
+Copyright © 2022-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef STYLECOMMON
+#define STYLECOMMON
+
+#include <QtCore>
+#include <QtGui>
+#include <QtWidgets>
+
+#include "qgoodwindow_global.h"
+
+namespace StyleCommon
+{
+//\cond HIDDEN_SYMBOLS
+//Colors of the panels painted by CommonStyle on top of the palette.
+struct Colors
+{
+    QColor gradient_dark;
+    QColor gradient_light;
+    QColor border;
+    QColor frame;
+    QColor tab_dark;
+    QColor tab_light;
+    QColor menu_bar_selected;
+    QColor menu_item_disabled;
+    QColor button_hover;
+    QColor handle_border;
+};
+//\endcond
+
+#ifdef _WIN32
+QPixmap winStandardPixmap(QStyle::StandardPixmap standardPixmap);
+#endif
+}
+
+//\cond HIDDEN_SYMBOLS
+class QGOODWINDOW_SHARED_EXPORT CommonStyle : public QProxyStyle
+{
+    Q_OBJECT
+public:
+    explicit CommonStyle(QStyle *style, const StyleCommon::Colors &colors);
+
+    ~CommonStyle();
+
+    void drawPrimitive(PrimitiveElement element, const QStyleOption *option, QPainter *painter, const QWidget *widget) const;
+
+    void drawControl(ControlElement element, const QStyleOption *option, QPainter *painter, const QWidget *widget) const;
+
+    void drawComplexControl(ComplexControl control, const QStyleOptionComplex *option, QPainter *painter, const QWidget *widget) const;
+
+    QRect subControlRect(ComplexControl control, const QStyleOptionComplex *option, SubControl sub_control, const QWidget *widget) const;
+
+    int pixelMetric(PixelMetric metric, const QStyleOption *option, const QWidget *widget) const;
+
+    void polish(QWidget *widget);
+
+    using QProxyStyle::polish;
+
+private:
+    //Functions
+    QLinearGradient panelGradient(const QRect &rect, Qt::Edge edge) const;
+
+    //Variables
+    StyleCommon::Colors m_colors;
+};
+//\endcond
+
+#endif // STYLECOMMON
+
@@ -0,0 +1,303 @@
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "xsettings.h"
+
+#include <climits>
+#include <X11/Xlib.h>
+
+//Reads the theme from the XSETTINGS manager (gnome-settings-daemon, xsettingsd, xfsettingsd...),
+//see https://specifications.freedesktop.org/xsettings-spec/xsettings-latest.html.
+//Uses its own display connection, so the event masks selected here
+//never interfere with the ones Qt selects on the same windows.
+
+#define DISPLAY static_cast<Display*>(m_display)
+
+enum XSettingType
+{
+    XSettingTypeInteger = 0,
+    XSettingTypeString = 1,
+    XSettingTypeColor = 2
+};
+
+XSettings *XSettings::instance()
+{
+    static QPointer<XSettings> instance;
+
+    if (!instance)
+        instance = new XSettings(qApp);
+
+    return instance;
+}
+
+XSettings::XSettings(QObject *parent) : QObject(parent)
+{
+    m_display = XOpenDisplay(nullptr);
+    m_root = 0;
+    m_owner = 0;
+    m_selection_atom = 0;
+    m_settings_atom = 0;
+    m_manager_atom = 0;
+    m_dark = false;
+
+    if (!m_display)
+        return;
+
+    const QByteArray selection_name = QByteArray("_XSETTINGS_S") + QByteArray::number(DefaultScreen(DISPLAY));
+
+    m_root = DefaultRootWindow(DISPLAY);
+    m_selection_atom = XInternAtom(DISPLAY, selection_name.constData(), False);
+    m_settings_atom = XInternAtom(DISPLAY, "_XSETTINGS_SETTINGS", False);
+    m_manager_atom = XInternAtom(DISPLAY, "MANAGER", False);
+
+    //A new settings manager announces itself with a MANAGER client message to the root window.
+    XSelectInput(DISPLAY, m_root, StructureNotifyMask);
+
+    m_notifier = new QSocketNotifier(ConnectionNumber(DISPLAY), QSocketNotifier::Read, this);
+    connect(m_notifier, &QSocketNotifier::activated, this, &XSettings::processEvents);
+
+    updateOwner();
+
+    processEvents();
+}
+
+XSettings::~XSettings()
+{
+    if (m_display)
+        XCloseDisplay(DISPLAY);
+}
+
+bool XSettings::isValid() const
+{
+    return (m_owner != 0);
+}
+
+bool XSettings::isThemeDark() const
+{
+    return m_dark;
+}
+
+void XSettings::updateOwner()
+{
+    XGrabServer(DISPLAY);
+
+    m_owner = XGetSelectionOwner(DISPLAY, m_selection_atom);
+
+    if (m_owner)
+        XSelectInput(DISPLAY, m_owner, StructureNotifyMask | PropertyChangeMask);
+
+    XUngrabServer(DISPLAY);
+
+    XFlush(DISPLAY);
+
+    if (m_owner)
+        readSettings();
+}
+
+void XSettings::readSettings()
+{
+    Atom type;
+    int format;
+    unsigned long items;
+    unsigned long bytes_after;
+    unsigned char *data = nullptr;
+
+    if (XGetWindowProperty(DISPLAY, m_owner, m_settings_atom, 0, LONG_MAX, False,
+                           m_settings_atom, &type, &format, &items, &bytes_after, &data) != Success)
+        return;
+
+    const QByteArray settings = (data && format == 8) ?
+                QByteArray(reinterpret_cast<const char*>(data), int(items)) : QByteArray();
+
+    if (data)
+        XFree(data);
+
+    if (settings.size() < 12)
+        return;
+
+    //First byte is the byte order of the manager, LSBFirst or MSBFirst.
+    const bool big_endian = (settings.at(0) == MSBFirst);
+
+    const uchar *bytes = reinterpret_cast<const uchar*>(settings.constData());
+    const int size = settings.size();
+
+    auto card16 = [=](int offset)->quint16{
+        return big_endian ? qFromBigEndian<quint16>(bytes + offset) : qFromLittleEndian<quint16>(bytes + offset);
+    };
+
+    auto card32 = [=](int offset)->quint32{
+        return big_endian ? qFromBigEndian<quint32>(bytes + offset) : qFromLittleEndian<quint32>(bytes + offset);
+    };
+
+    auto pad = [](int length)->int{
+        return (length + 3) & ~3;
+    };
+
+    QString theme_name;
+    QString color_scheme;
+
+    const quint32 count = card32(8);
+
+    int offset = 12;
+
+    for (quint32 i = 0; i < count; i++)
+    {
+        if (offset + 4 > size)
+            break;
+
+        const int type = bytes[offset];
+        const int name_length = card16(offset + 2);
+
+        offset += 4;
+
+        if (offset + pad(name_length) + 4 > size)
+            break;
+
+        const QByteArray name = settings.mid(offset, name_length);
+
+        //Skip name and last change serial.
+        offset += pad(name_length) + 4;
+
+        switch (type)
+        {
+        case XSettingTypeInteger:
+        {
+            if (offset + 4 > size)
+                return;
+
+            //Integer form of the color scheme, 0 no preference, 1 prefer dark, 2 prefer light.
+            if (name == "Net/ColorScheme")
+            {
+                switch (qint32(card32(offset)))
+                {
+                case 1:
+                {
+                    color_scheme = "prefer-dark";
+                    break;
+                }
+                case 2:
+                {
+                    color_scheme = "prefer-light";
+                    break;
+                }
+                default:
+                {
+                    color_scheme = "default";
+                    break;
+                }
+                }
+            }
+
+            offset += 4;
+
+            break;
+        }
+        case XSettingTypeString:
+        {
+            if (offset + 4 > size)
+                return;
+
+            const int value_length = int(card32(offset));
+
+            offset += 4;
+
+            if (value_length < 0 || offset + pad(value_length) > size)
+                return;
+
+            const QString value = QString::fromUtf8(settings.mid(offset, value_length));
+
+            if (name == "Net/ThemeName")
+                theme_name = value;
+            else if (name == "Net/ColorScheme")
+                color_scheme = value;
+
+            offset += pad(value_length);
+
+            break;
+        }
+        case XSettingTypeColor:
+        {
+            offset += 8;
+            break;
+        }
+        default:
+            return;
+        }
+    }
+
+    m_theme_name = theme_name;
+    m_color_scheme = color_scheme;
+
+    bool dark = m_theme_name.endsWith("Dark", Qt::CaseInsensitive);
+
+    //Color scheme preference takes precedence over the theme name when announced.
+    if (m_color_scheme.contains("dark", Qt::CaseInsensitive))
+        dark = true;
+    else if (m_color_scheme.contains("light", Qt::CaseInsensitive))
+        dark = false;
+
+    if (m_dark != dark)
+    {
+        m_dark = dark;
+        Q_EMIT themeChanged();
+    }
+}
+
+void XSettings::processEvents()
+{
+    while (XPending(DISPLAY))
+    {
+        XEvent event;
+        XNextEvent(DISPLAY, &event);
+
+        switch (event.type)
+        {
+        case PropertyNotify:
+        {
+            if (event.xproperty.window == m_owner && event.xproperty.atom == m_settings_atom)
+                readSettings();
+
+            break;
+        }
+        case ClientMessage:
+        {
+            if (event.xclient.message_type == m_manager_atom &&
+                    Atom(event.xclient.data.l[1]) == m_selection_atom)
+                updateOwner();
+
+            break;
+        }
+        case DestroyNotify:
+        {
+            //The manager exited, keep the last known theme until a new one starts.
+            if (event.xdestroywindow.window == m_owner)
+                updateOwner();
+
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
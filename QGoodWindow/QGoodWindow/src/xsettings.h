@@ -0,0 +1,67 @@
+/*
+The MIT License (MIT)
+
+Copyright © 2018-2023 Antonio Dias (https://github.com/antonypro)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef XSETTINGS_H
+#define XSETTINGS_H
+
+#include <QtCore>
+
+//\cond HIDDEN_SYMBOLS
+class XSettings : public QObject
+{
+    Q_OBJECT
+public:
+    static XSettings *instance();
+
+Q_SIGNALS:
+    void themeChanged();
+
+public Q_SLOTS:
+    bool isValid() const;
+    bool isThemeDark() const;
+
+private:
+    explicit XSettings(QObject *parent);
+    ~XSettings();
+
+    //Functions
+    void updateOwner();
+    void readSettings();
+    void processEvents();
+
+    //Variables
+    void *m_display;
+    unsigned long m_root;
+    unsigned long m_owner;
+    unsigned long m_selection_atom;
+    unsigned long m_settings_atom;
+    unsigned long m_manager_atom;
+    QPointer<QSocketNotifier> m_notifier;
+    QString m_theme_name;
+    QString m_color_scheme;
+    bool m_dark;
+};
+//\endcond
+
+#endif // XSETTINGS_H
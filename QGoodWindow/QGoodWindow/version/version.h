@@ -1,6 +1,6 @@
-#ifndef VERSION_H
-#define VERSION_H
-
-#define QGOODWINDOW_VERSION "2.4.2"
-
-#endif // VERSION_H
+#ifndef VERSION_H
+#define VERSION_H
+
+#define QGOODWINDOW_VERSION "2.4.2"
+
+#endif // VERSION_H